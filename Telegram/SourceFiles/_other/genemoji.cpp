@@ -45,6 +45,30 @@ struct EmojiData {
 	int category, index;
 };
 
+// perfect hash for getEmoji(): codes are spread to buckets by one multiplicative hash, each bucket
+// gets a displacement xor-ed with the other hash so that all codes land in distinct slots
+const uint32 emojiHashBuckets = 256, emojiHashSlots = 1024;
+inline uint32 emojiHashBucket(uint32 code) {
+	return (code * 0x9E3779B1U) >> 24;
+}
+inline uint32 emojiHashSlot(uint32 code) {
+	return (code * 0x85EBCA6BU) >> 22;
+}
+
+void writeEmojiHashTable(QTextStream &tcpp, const QVector<uint32> &values) {
+	for (int i = 0, l = values.size(); i < l; ++i) {
+		if (i % 16) {
+			tcpp << ", ";
+		} else {
+			tcpp << "\t\t";
+		}
+		tcpp << values.at(i);
+		if (i % 16 == 15 || i + 1 == l) {
+			tcpp << ((i + 1 < l) ? ",\n" : "\n");
+		}
+	}
+}
+
 // copied from emojibox.cpp
 struct EmojiReplace {
 	uint32 code;
@@ -1093,7 +1117,6 @@ void writeEmojiCategory(QTextStream &tcpp, uint64 *emojiCategory, uint32 size, c
 
 bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_png) {
 	int currentRow = 0, currentColumn = 0;
-	uint32 min1 = 0xFFFFFFFFU, max1 = 0, min2 = 0xFFFFFFFFU, max2 = 0;
 
 	QImage sprites[5];
 	int emojisInRow[] = { 27, 29, 33, 34, 34 };	// [[7,27],[4,29],[7,33],[3,34],[6,34]]
@@ -1138,18 +1161,6 @@ bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_p
 				++currentRow;
 				currentColumn = 0;
 			}
-			uint32 high = data.code >> 16;
-			if (!high) { // small codes
-				if (data.code == 169 || data.code == 174) { // two small
-				} else {
-					if (data.code < min1) min1 = data.code;
-					if (data.code > max1) max1 = data.code;
-				}
-			} else if (high == 35 || (high >= 48 && high < 58)) { // digits
-			} else {
-				if (data.code < min2) min2 = data.code;
-				if (data.code > max2) max2 = data.code;
-			}
 			EmojisData::const_iterator k = emojisData.constFind(data.code);
 			if (k != emojisData.cend()) {
 				cout << QString("Bad emoji code (duplicate) %1 %2 and %3 %4").arg(data.code).arg(data.code2).arg(k->code).arg(k->code2).toUtf8().constData() << "\n";
@@ -1165,6 +1176,47 @@ bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_p
 		return true;
 	}
 
+	QVector<uint32> hashDisplace(emojiHashBuckets, 0), hashSlots(emojiHashSlots, 0);
+	{
+		QVector<QVector<uint32> > buckets(emojiHashBuckets);
+		QMap<uint32, uint32> indices;
+		uint32 index = 0;
+		for (EmojisData::const_iterator i = emojisData.cbegin(), e = emojisData.cend(); i != e; ++i) {
+			buckets[emojiHashBucket(i->code)].push_back(i->code);
+			indices.insert(i->code, ++index);
+		}
+
+		QVector<QPair<int, uint32> > order; // place the biggest buckets first
+		for (uint32 i = 0; i < emojiHashBuckets; ++i) {
+			if (!buckets.at(i).isEmpty()) order.push_back(qMakePair(-buckets.at(i).size(), i));
+		}
+		qSort(order);
+
+		for (int i = 0, l = order.size(); i < l; ++i) {
+			const QVector<uint32> &bucket(buckets.at(order.at(i).second));
+			uint32 displace = 0;
+			for (; displace < emojiHashSlots; ++displace) {
+				QVector<uint32> taken;
+				for (int j = 0, s = bucket.size(); j < s; ++j) {
+					uint32 slot = emojiHashSlot(bucket.at(j)) ^ displace;
+					if (hashSlots.at(slot) || taken.contains(slot)) break;
+					taken.push_back(slot);
+				}
+				if (taken.size() == bucket.size()) {
+					for (int j = 0, s = bucket.size(); j < s; ++j) {
+						hashSlots[taken.at(j)] = indices.value(bucket.at(j));
+					}
+					break;
+				}
+			}
+			if (displace == emojiHashSlots) {
+				cout << "Could not build emoji hash, try other multipliers!\n";
+				return false;
+			}
+			hashDisplace[order.at(i).second] = displace;
+		}
+	}
+
 	for (int variantIndex = 0; variantIndex < variantsCount; variantIndex++) {
 		int imSize = imSizes[variantIndex];
 
@@ -1271,54 +1323,21 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
             tcpp << "\t};\n";
 			tcpp << "};\n\n";
 
+			tcpp << "namespace {\n";
+			tcpp << "\t// perfect hash of the emoji codes, see getEmoji()\n";
+			tcpp << "\tconst uint16 emojisHashDisplace[" << emojiHashBuckets << "] = {\n";
+			writeEmojiHashTable(tcpp, hashDisplace);
+			tcpp << "\t};\n";
+			tcpp << "\tconst uint16 emojisHashSlots[" << emojiHashSlots << "] = { // emoji index + 1, 0 for empty slots\n";
+			writeEmojiHashTable(tcpp, hashSlots);
+			tcpp << "\t};\n";
+			tcpp << "}\n\n";
+
 			tcpp << "const EmojiData *getEmoji(uint32 code) {\n"; // getter
 			tcpp << "\tif (!emojis) return 0;\n\n";
-			tcpp << "\tuint32 highCode = code >> 16;\n";
-
-			uint32 index = 0;
-			EmojisData::const_iterator i = emojisData.cbegin(), e = emojisData.cend();
-
-			tcpp << "\tif (!highCode) {\n"; // small codes
-			tcpp << "\t\tswitch (code) {\n";
-			for (; i != e; ++i) { // two small
-				if (i->code2) break;
-				if (i->code != 169 && i->code != 174) break;
-
-                tcpp << "\t\t\tcase 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U: return &emojis[" << (index++) << "];\n";
-			}
-			tcpp << "\t\t}\n\n";
-            tcpp << "\t\tif (code < 0x" << QString("%1").arg(min1, 0, 16).toUpper().toUtf8().constData() << "U || code > 0x" << QString("%1").arg(max1, 0, 16).toUpper().toUtf8().constData() << "U) return 0;\n\n";
-			tcpp << "\t\tswitch (code) {\n";
-			for (; i != e; ++i) {
-				if (i->code2 || (i->code >> 16)) break;
-                tcpp << "\t\t\tcase 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U: return &emojis[" << (index++) << "];\n";
-			}
-			tcpp << "\t\t}\n\n";
-			tcpp << "\t\treturn 0;\n";
-			tcpp << "\t}\n\n";
-
-			tcpp << "\tif (highCode == 35 || (highCode >= 48 && highCode < 58)) {\n"; // digits
-            tcpp << "\t\tif ((code & 0xFFFFU) != 0x20E3U) return 0;\n\n";
-			tcpp << "\t\tswitch (code) {\n";
-			for (; i != e; ++i) {
-				if (i->code2) break;
-				uint32 high = i->code >> 16;
-				if (high != 35 && (high < 48 || high >= 58)) break;
-
-                tcpp << "\t\t\tcase 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U: return &emojis[" << (index++) << "];\n";
-			}
-			tcpp << "\t\t}\n\n";
-			tcpp << "\t\treturn 0;\n";
-			tcpp << "\t}\n\n";
-
-            tcpp << "\tif (code < 0x" << QString("%1").arg(min2, 0, 16).toUpper().toUtf8().constData() << "U || code > 0x" << QString("%1").arg(max2, 0, 16).toUpper().toUtf8().constData() << "U) return 0;\n\n";
-			tcpp << "\tswitch (code) {\n";
-			for (; i != e; ++i) {
-                tcpp << "\tcase 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U: return &emojis[" << (index++) << "];\n";
-			}
-			tcpp << "\t}\n\n";
-
-			tcpp << "\treturn 0;\n";
+			tcpp << "\t// bucket by one hash, xor the other hash with the bucket displacement to get the slot\n";
+			tcpp << "\tuint32 index = emojisHashSlots[((code * 0x85EBCA6BU) >> 22) ^ emojisHashDisplace[(code * 0x9E3779B1U) >> 24]];\n";
+			tcpp << "\treturn (index && emojis[index - 1].code == code) ? &emojis[index - 1] : 0;\n";
 			tcpp << "}\n\n";
 
 			// emoji autoreplace
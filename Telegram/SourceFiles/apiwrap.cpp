@@ -30,6 +30,7 @@ ApiWrap::ApiWrap(QObject *parent) : QObject(parent) {
 	App::initBackground();
 
 	connect(&_replyToTimer, SIGNAL(timeout()), this, SLOT(resolveReplyTo()));
+	connect(&_fullRequestsTimer, SIGNAL(timeout()), this, SLOT(resolveFullPeers()));
 	connect(&_webPagesTimer, SIGNAL(timeout()), this, SLOT(resolveWebPages()));
 }
 
@@ -39,17 +40,18 @@ void ApiWrap::init() {
 
 void ApiWrap::itemRemoved(HistoryItem *item) {
 	if (HistoryReply *reply = item->toHistoryReply()) {
-		ReplyToRequests::iterator i = _replyToRequests.find(reply->replyToId());
-		if (i != _replyToRequests.cend()) {
-			for (QList<HistoryReply*>::iterator j = i->replies.begin(); j != i->replies.end();) {
+		ReplyToWaiters::iterator i = _replyToWaiters.find(reply->replyToId());
+		if (i != _replyToWaiters.cend()) {
+			for (QList<HistoryReply*>::iterator j = i->begin(); j != i->end();) {
 				if ((*j) == reply) {
-					j = i->replies.erase(j);
+					j = i->erase(j);
 				} else {
 					++j;
 				}
 			}
-			if (i->replies.isEmpty()) {
-				_replyToRequests.erase(i);
+			if (i->isEmpty()) {
+				_replyToRequests.remove(i.key());
+				_replyToWaiters.erase(i);
 			}
 		}
 	}
@@ -57,47 +59,75 @@ void ApiWrap::itemRemoved(HistoryItem *item) {
 
 void ApiWrap::itemReplaced(HistoryItem *oldItem, HistoryItem *newItem) {
 	if (HistoryReply *reply = oldItem->toHistoryReply()) {
-		ReplyToRequests::iterator i = _replyToRequests.find(reply->replyToId());
-		if (i != _replyToRequests.cend()) {
-			for (QList<HistoryReply*>::iterator j = i->replies.begin(); j != i->replies.end();) {
+		ReplyToWaiters::iterator i = _replyToWaiters.find(reply->replyToId());
+		if (i != _replyToWaiters.cend()) {
+			for (QList<HistoryReply*>::iterator j = i->begin(); j != i->end();) {
 				if ((*j) == reply) {
 					if (HistoryReply *newReply = newItem->toHistoryReply()) {
 						*j = newReply;
 						++j;
 					} else {
-						j = i->replies.erase(j);
+						j = i->erase(j);
 					}
 				} else {
 					++j;
 				}
 			}
-			if (i->replies.isEmpty()) {
-				_replyToRequests.erase(i);
+			if (i->isEmpty()) {
+				_replyToRequests.remove(i.key());
+				_replyToWaiters.erase(i);
 			}
 		}
 	}
 }
 
 void ApiWrap::requestReplyTo(HistoryReply *reply, MsgId to) {
-	ReplyToRequest &req(_replyToRequests[to]);
-	req.replies.append(reply);
-	if (!req.req) _replyToTimer.start(1);
+	_replyToWaiters[to].append(reply);
+	if (_replyToRequests.add(to) && !_replyToTimer.isActive()) {
+		_replyToTimer.start(ApiBatchDelay);
+	}
 }
 
 void ApiWrap::requestFullPeer(PeerData *peer) {
-	if (_fullRequests.contains(peer)) return;
-	mtpRequestId req;
-	if (peer->chat) {
-		req = MTP::send(MTPmessages_GetFullChat(MTP_int(App::chatFromPeer(peer->id))), rpcDone(&ApiWrap::gotChatFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
-	} else {
-		req = MTP::send(MTPusers_GetFullUser(peer->asUser()->inputUser), rpcDone(&ApiWrap::gotUserFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
+	if (_fullRequests.add(peer) && !_fullRequestsTimer.isActive()) {
+		_fullRequestsTimer.start(ApiBatchDelay);
+	}
+}
+
+void ApiWrap::resolveFullPeers() {
+	int32 left = ApiFullPeersInFlight - _fullRequests.requestsInFlight();
+	if (left <= 0) return; // will be resolved when some of the sent are done
+
+	QList<PeerData*> peers(_fullRequests.take(left));
+	for (QList<PeerData*>::const_iterator i = peers.cbegin(), e = peers.cend(); i != e; ++i) {
+		PeerData *peer = *i;
+		mtpRequestId req;
+		if (peer->chat) {
+			req = MTP::send(MTPmessages_GetFullChat(MTP_int(App::chatFromPeer(peer->id))), rpcDone(&ApiWrap::gotChatFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer), 0, 0, 0, MTPRequestBackground);
+		} else {
+			req = MTP::send(MTPusers_GetFullUser(peer->asUser()->inputUser), rpcDone(&ApiWrap::gotUserFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer), 0, 0, 0, MTPRequestBackground);
+		}
+		_fullRequests.sent(QList<PeerData*>() << peer, req);
+		static MetricHandle apiFullPeerRequestsMetric = metricCounter(qsl("api.full_peer_requests"));
+		metricAdd(apiFullPeerRequestsMetric);
+	}
+}
+
+void ApiWrap::fullPeerDone(PeerData *peer) {
+	_fullRequests.remove(peer);
+	if (_fullRequests.hasPending() && !_fullRequestsTimer.isActive()) {
+		_fullRequestsTimer.start(ApiBatchDelay);
 	}
-	_fullRequests.insert(peer, req);
 }
 
 void ApiWrap::requestWebPageDelayed(WebPageData *page) {
 	if (page->pendingTill <= 0) return;
-	_webPagesPending.insert(page, 0);
+	WebPagesPending::const_iterator i = _webPagesPending.constFind(page);
+	if (i == _webPagesPending.cend()) {
+		_webPagesPending.insert(page, 0);
+	} else if (i.value()) { // already requested
+		return;
+	}
 	int32 left = (page->pendingTill - unixtime()) * 1000;
 	if (!_webPagesTimer.isActive() || left <= _webPagesTimer.remainingTime()) {
 		_webPagesTimer.start((left < 0 ? 0 : left) + 1);
@@ -129,7 +159,7 @@ void ApiWrap::gotChatFull(PeerData *peer, const MTPmessages_ChatFull &result) {
 	}
 	App::main()->gotNotifySetting(MTP_inputNotifyPeer(peer->input), d.vfull_chat.c_chatFull().vnotify_settings);
 
-	_fullRequests.remove(peer);
+	fullPeerDone(peer);
 	emit fullPeerLoaded(peer);
 }
 
@@ -139,61 +169,64 @@ void ApiWrap::gotUserFull(PeerData *peer, const MTPUserFull &result) {
 	App::feedUserLink(MTP_int(App::userFromPeer(peer->id)), d.vlink.c_contacts_link().vmy_link, d.vlink.c_contacts_link().vforeign_link);
 	App::main()->gotNotifySetting(MTP_inputNotifyPeer(peer->input), d.vnotify_settings);
 
-	_fullRequests.remove(peer);
+	fullPeerDone(peer);
 	emit fullPeerLoaded(peer);
 }
 
 bool ApiWrap::gotPeerFailed(PeerData *peer, const RPCError &error) {
 	if (error.type().startsWith(qsl("FLOOD_WAIT_"))) return false;
 
-	_fullRequests.remove(peer);
+	fullPeerDone(peer);
 	return true;
 }
 
 void ApiWrap::resolveReplyTo() {
-	if (_replyToRequests.isEmpty()) return;
+	while (_replyToRequests.hasPending()) {
+		QList<MsgId> keys(_replyToRequests.take(ApiBatchMaxIds));
 
-	QVector<MTPint> ids;
-	ids.reserve(_replyToRequests.size());
-	for (ReplyToRequests::const_iterator i = _replyToRequests.cbegin(), e = _replyToRequests.cend(); i != e; ++i) {
-		if (!i.value().req) {
-			ids.push_back(MTP_int(i.key()));
-		}
-	}
-	if (!ids.isEmpty()) {
-		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotReplyTo));
-		for (ReplyToRequests::iterator i = _replyToRequests.begin(), e = _replyToRequests.end(); i != e; ++i) {
-			i.value().req = req;
+		QVector<MTPint> ids;
+		ids.reserve(keys.size());
+		for (QList<MsgId>::const_iterator i = keys.cbegin(), e = keys.cend(); i != e; ++i) {
+			ids.push_back(MTP_int(*i));
 		}
+		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotReplyTo), rpcFail(&ApiWrap::gotReplyToFailed), 0, 0, 0, MTPRequestBackground);
+		_replyToRequests.sent(keys, req);
+		static MetricHandle apiReplyToRequestsMetric = metricCounter(qsl("api.reply_to_requests"));
+		metricAdd(apiReplyToRequestsMetric);
 	}
 }
 
 void ApiWrap::resolveWebPages() {
 	QVector<MTPint> ids;
+	QList<WebPageData*> pages;
 	const WebPageItems &items(App::webPageItems());
-	ids.reserve(_webPagesPending.size());
+	ids.reserve(qMin(_webPagesPending.size(), int(ApiBatchMaxIds)));
 	int32 t = unixtime(), m = INT_MAX;
 	for (WebPagesPending::const_iterator i = _webPagesPending.cbegin(), e = _webPagesPending.cend(); i != e; ++i) {
 		if (i.value()) continue;
 		if (i.key()->pendingTill <= t) {
 			WebPageItems::const_iterator j = items.constFind(i.key());
 			if (j != items.cend() && !j.value().isEmpty()) {
+				if (ids.size() == ApiBatchMaxIds) { // the rest is requested right after this request
+					m = 0;
+					break;
+				}
 				ids.push_back(MTP_int(j.value().begin().key()->id));
+				pages.push_back(i.key());
 			}
 		} else {
 			m = qMin(m, i.key()->pendingTill - t);
 		}
 	}
 	if (!ids.isEmpty()) {
-		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotWebPages));
-		for (WebPagesPending::iterator i = _webPagesPending.begin(); i != _webPagesPending.cend(); ++i) {
-			if (i.value()) continue;
-			if (i.key()->pendingTill <= t) {
-				i.value() = req;
-			}
+		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotWebPages), RPCFailHandlerPtr(), 0, 0, 0, MTPRequestBackground);
+		for (QList<WebPageData*>::const_iterator i = pages.cbegin(), e = pages.cend(); i != e; ++i) {
+			_webPagesPending[*i] = req;
 		}
+		static MetricHandle apiWebPageRequestsMetric = metricCounter(qsl("api.web_page_requests"));
+		metricAdd(apiWebPageRequestsMetric);
 	}
-	if (m < INT_MAX) _webPagesTimer.start(m * 1000);
+	if (m < INT_MAX) _webPagesTimer.start(m ? (m * 1000) : ApiBatchDelay);
 }
 
 void ApiWrap::gotReplyTo(const MTPmessages_Messages &msgs, mtpRequestId req) {
@@ -210,18 +243,30 @@ void ApiWrap::gotReplyTo(const MTPmessages_Messages &msgs, mtpRequestId req) {
 		App::feedMsgs(msgs.c_messages_messagesSlice().vmessages, -1);
 		break;
 	}
-	for (ReplyToRequests::iterator i = _replyToRequests.begin(); i != _replyToRequests.cend();) {
-		if (i.value().req == req) {
-			for (QList<HistoryReply*>::const_iterator j = i.value().replies.cbegin(), e = i.value().replies.cend(); j != e; ++j) {
-				if (*j) {
-					(*j)->updateReplyTo(true);
-				} else {
-					App::main()->updateReplyTo();
-				}
+	replyToDone(req);
+}
+
+bool ApiWrap::gotReplyToFailed(const RPCError &error, mtpRequestId req) {
+	if (error.type().startsWith(qsl("FLOOD_WAIT_"))) return false;
+
+	replyToDone(req); // same as not found messages
+	return true;
+}
+
+void ApiWrap::replyToDone(mtpRequestId req) {
+	QList<MsgId> ids(_replyToRequests.done(req));
+	for (QList<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+		ReplyToWaiters::iterator j = _replyToWaiters.find(*i);
+		if (j == _replyToWaiters.end()) continue;
+
+		QList<HistoryReply*> replies(j.value());
+		_replyToWaiters.erase(j);
+		for (QList<HistoryReply*>::const_iterator k = replies.cbegin(), end = replies.cend(); k != end; ++k) {
+			if (*k) {
+				(*k)->updateReplyTo(true);
+			} else {
+				App::main()->updateReplyTo();
 			}
-			i = _replyToRequests.erase(i);
-		} else {
-			++i;
 		}
 	}
 }
@@ -244,12 +289,7 @@ void ApiWrap::gotWebPages(const MTPmessages_Messages &msgs, mtpRequestId req) {
 
 	QMap<int32, int32> msgsIds; // copied from feedMsgs
 	for (int32 i = 0, l = v->size(); i < l; ++i) {
-		const MTPMessage &msg(v->at(i));
-		switch (msg.type()) {
-		case mtpc_message: msgsIds.insert(msg.c_message().vid.v, i); break;
-		case mtpc_messageEmpty: msgsIds.insert(msg.c_messageEmpty().vid.v, i); break;
-		case mtpc_messageService: msgsIds.insert(msg.c_messageService().vid.v, i); break;
-		}
+		msgsIds.insert(App::idFromMessage(v->at(i)), i);
 	}
 
 	MainWidget *m = App::main();
@@ -17,6 +17,86 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 */
 #pragma once
 
+template <typename Key>
+class ApiBatch { // collects keys until flush, each key is requested only once at a time
+public:
+
+	ApiBatch() : _pending(0) {
+	}
+
+	bool add(const Key &key) { // false if the key is already waiting or requested
+		if (_keys.contains(key)) return false;
+		_keys.insert(key, 0);
+		++_pending;
+		return true;
+	}
+
+	QList<Key> take(int32 max) const { // not requested keys, sent(keys, req) must be called after
+		QList<Key> result;
+		for (typename Keys::const_iterator i = _keys.cbegin(), e = _keys.cend(); i != e && result.size() < max; ++i) {
+			if (!i.value()) result.push_back(i.key());
+		}
+		return result;
+	}
+
+	void sent(const QList<Key> &keys, mtpRequestId req) {
+		for (typename QList<Key>::const_iterator i = keys.cbegin(), e = keys.cend(); i != e; ++i) {
+			typename Keys::iterator j = _keys.find(*i);
+			if (j != _keys.end() && !j.value()) {
+				j.value() = req;
+				++_requests[req];
+				--_pending;
+			}
+		}
+	}
+
+	QList<Key> done(mtpRequestId req) { // removes and returns all keys of the request
+		QList<Key> result;
+		if (!_requests.remove(req)) return result;
+
+		for (typename Keys::iterator i = _keys.begin(); i != _keys.end();) {
+			if (i.value() == req) {
+				result.push_back(i.key());
+				i = _keys.erase(i);
+			} else {
+				++i;
+			}
+		}
+		return result;
+	}
+
+	void remove(const Key &key) {
+		typename Keys::iterator i = _keys.find(key);
+		if (i == _keys.end()) return;
+
+		if (i.value()) {
+			Requests::iterator j = _requests.find(i.value());
+			if (j != _requests.end() && !--j.value()) {
+				_requests.erase(j);
+			}
+		} else {
+			--_pending;
+		}
+		_keys.erase(i);
+	}
+
+	bool hasPending() const {
+		return _pending > 0;
+	}
+	int32 requestsInFlight() const {
+		return _requests.size();
+	}
+
+private:
+
+	typedef QMap<Key, mtpRequestId> Keys;
+	Keys _keys; // 0 - waiting for flush, else the sent request
+	typedef QMap<mtpRequestId, int32> Requests;
+	Requests _requests; // keys count in each sent request
+	int32 _pending;
+
+};
+
 class ApiWrap : public QObject, public RPCSender {
 	Q_OBJECT
 
@@ -45,26 +125,25 @@ signals:
 public slots:
 
 	void resolveReplyTo();
+	void resolveFullPeers();
 	void resolveWebPages();
 
 private:
 
 	void gotReplyTo(const MTPmessages_Messages &result, mtpRequestId req);
-	struct ReplyToRequest {
-		ReplyToRequest() : req(0) {
-		}
-		mtpRequestId req;
-		QList<HistoryReply*> replies;
-	};
-	typedef QMap<MsgId, ReplyToRequest> ReplyToRequests;
-	ReplyToRequests _replyToRequests;
+	bool gotReplyToFailed(const RPCError &error, mtpRequestId req);
+	void replyToDone(mtpRequestId req);
+	typedef QMap<MsgId, QList<HistoryReply*> > ReplyToWaiters;
+	ReplyToWaiters _replyToWaiters;
+	ApiBatch<MsgId> _replyToRequests;
 	SingleTimer _replyToTimer;
 
 	void gotChatFull(PeerData *peer, const MTPmessages_ChatFull &result);
 	void gotUserFull(PeerData *peer, const MTPUserFull &result);
 	bool gotPeerFailed(PeerData *peer, const RPCError &err);
-	typedef QMap<PeerData*, mtpRequestId> FullRequests;
-	FullRequests _fullRequests;
+	void fullPeerDone(PeerData *peer);
+	ApiBatch<PeerData*> _fullRequests;
+	SingleTimer _fullRequestsTimer;
 
 	void gotWebPages(const MTPmessages_Messages &result, mtpRequestId req);
 	typedef QMap<WebPageData*, mtpRequestId> WebPagesPending;
@@ -29,6 +29,16 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 namespace {
 	bool quiting = false;
 
+	struct IdVisitor { // every constructor of message and user types has an id
+		IdVisitor() : id(0) {
+		}
+		template <typename T>
+		void operator()(const T &d) {
+			id = d.vid.v;
+		}
+		int32 id;
+	};
+
 	UserData *self = 0;
 
 	typedef QHash<PeerId, PeerData*> PeersData;
@@ -75,6 +85,7 @@ namespace {
 	typedef QMap<uint32, QPixmap> EmojisMap;
 	EmojisMap mainEmojisMap;
 	QMap<int32, EmojisMap> otherEmojisMap;
+	QList<int32> otherEmojisHeights; // last used first
 
 	int32 serviceImageCacheSize = 0;
 
@@ -199,6 +210,18 @@ namespace App {
         return (peer_id & 0x100000000L) ? int32(peer_id & 0xFFFFFFFFL) : 0;
     }
 
+	int32 idFromMessage(const MTPmessage &msg) {
+		IdVisitor visitor;
+		mtpVisit(msg, visitor);
+		return visitor.id;
+	}
+
+	int32 idFromUser(const MTPuser &user) {
+		IdVisitor visitor;
+		mtpVisit(user, visitor);
+		return visitor.id;
+	}
+
 	int32 onlineForSort(int32 online, int32 now) {
 		if (online <= 0) {
 			switch (online) {
@@ -464,6 +487,7 @@ namespace App {
 				if (data->version < d.vversion.v) {
 					data->version = d.vversion.v;
 					data->participants = ChatData::Participants();
+					data->participantsUpdated();
 				}
 			} break;
 			case mtpc_chatForbidden: {
@@ -548,6 +572,7 @@ namespace App {
 						}
 					}
 				}
+				chat->participantsUpdated();
 				if (App::main()) App::main()->peerUpdated(chat);
 			}
 		} break;
@@ -564,6 +589,7 @@ namespace App {
 					chat->count++;
 				} else if (chat->participants.find(user) == chat->participants.end()) {
 					chat->participants[user] = (chat->participants.isEmpty() ? 1 : chat->participants.begin().value());
+					chat->participantAdded(user);
 					if (d.vinviter_id.v == MTP::authedId()) {
 						chat->cankick[user] = true;
 					} else {
@@ -573,6 +599,7 @@ namespace App {
 				}
 			} else {
 				chat->participants = ChatData::Participants();
+				chat->participantsUpdated();
 				chat->count++;
 			}
 			if (App::main()) App::main()->peerUpdated(chat);
@@ -591,11 +618,13 @@ namespace App {
 					ChatData::Participants::iterator i = chat->participants.find(user);
 					if (i != chat->participants.end()) {
 						chat->participants.erase(i);
+						chat->participantRemoved(user);
 						chat->count--;
 					}
 				}
 			} else {
 				chat->participants = ChatData::Participants();
+				chat->participantsUpdated();
 				chat->count--;
 			}
 			if (App::main()) App::main()->peerUpdated(chat);
@@ -606,12 +635,7 @@ namespace App {
 		const QVector<MTPMessage> &v(msgs.c_vector().v);
 		QMap<int32, int32> msgsIds;
 		for (int32 i = 0, l = v.size(); i < l; ++i) {
-			const MTPMessage &msg(v.at(i));
-			switch (msg.type()) {
-			case mtpc_message: msgsIds.insert(msg.c_message().vid.v, i); break;
-			case mtpc_messageEmpty: msgsIds.insert(msg.c_messageEmpty().vid.v, i); break;
-			case mtpc_messageService: msgsIds.insert(msg.c_messageService().vid.v, i); break;
-			}
+			msgsIds.insert(idFromMessage(v.at(i)), i);
 		}
 		for (QMap<int32, int32>::const_iterator i = msgsIds.cbegin(), e = msgsIds.cend(); i != e; ++i) {
 			histories().addToBack(v.at(*i), msgsState);
@@ -693,15 +717,7 @@ namespace App {
 		for (QVector<MTPcontacts_Link>::const_iterator i = v.cbegin(), e = v.cend(); i != e; ++i) {
 			const MTPDcontacts_link &dv(i->c_contacts_link());
 			feedUsers(MTP_vector<MTPUser>(1, dv.vuser));
-			MTPint userId(MTP_int(0));
-			switch (dv.vuser.type()) {
-			case mtpc_userEmpty: userId = dv.vuser.c_userEmpty().vid; break;
-			case mtpc_userDeleted: userId = dv.vuser.c_userDeleted().vid; break;
-			case mtpc_userContact: userId = dv.vuser.c_userContact().vid; break;
-			case mtpc_userSelf: userId = dv.vuser.c_userSelf().vid; break;
-			case mtpc_userRequest: userId = dv.vuser.c_userRequest().vid; break;
-			case mtpc_userForeign: userId = dv.vuser.c_userForeign().vid; break;
-			}
+			MTPint userId(MTP_int(idFromUser(dv.vuser)));
 			if (userId.v) {
 				feedUserLink(userId, dv.vmy_link, dv.vforeign_link);
 			}
@@ -1457,6 +1473,7 @@ namespace App {
 		webPagesData.clear();
 		if (api()) api()->clearWebPageRequests();
 		cSetRecentStickers(RecentStickerPack());
+		Local::forgetRecentStickers();
 		cSetStickersHash(QByteArray());
 		cSetStickers(AllStickers());
 		cSetEmojiStickers(EmojiStickersMap());
@@ -1511,8 +1528,9 @@ namespace App {
 	}
 
 	void initMedia() {
+		TraceSpan span("App::initMedia");
+
 		deinitMedia(false);
-		audioInit();
 
 		if (!::sprite) {
 			if (rtl()) {
@@ -1522,11 +1540,13 @@ namespace App {
 			}
             if (cRetina()) ::sprite->setDevicePixelRatio(cRetinaFactor());
 		}
-		if (!::emojis) {
-			::emojis = new QPixmap(st::emojisFile);
-            if (cRetina()) ::emojis->setDevicePixelRatio(cRetinaFactor());
-		}
-		initEmoji();
+		initEmoji(); // emoji atlas is loaded in emojis() when the first emoji is painted
+	}
+
+	void initMediaDelayed() {
+		TraceSpan span("App::initMediaDelayed");
+
+		audioInit();
 	}
 	
 	void deinitMedia(bool completely) {
@@ -1544,6 +1564,7 @@ namespace App {
 			::emojis = 0;
 			mainEmojisMap.clear();
 			otherEmojisMap.clear();
+			otherEmojisHeights.clear();
 
 			clearAllImages();
 		} else {
@@ -1607,11 +1628,27 @@ namespace App {
 	}
 
 	const QPixmap &emojis() {
+		if (!::emojis) {
+			TraceSpan span("App::emojis");
+			::emojis = new QPixmap(st::emojisFile);
+			if (cRetina()) ::emojis->setDevicePixelRatio(cRetinaFactor());
+		}
 		return *::emojis;
 	}
 
 	const QPixmap &emojiSingle(const EmojiData *emoji, int32 fontHeight) {
-		EmojisMap *map = &(fontHeight == st::taDefFlat.font->height ? mainEmojisMap : otherEmojisMap[fontHeight]);
+		EmojisMap *map = &mainEmojisMap;
+		if (fontHeight != st::taDefFlat.font->height) {
+			if (otherEmojisHeights.isEmpty() || otherEmojisHeights.front() != fontHeight) {
+				otherEmojisHeights.removeOne(fontHeight);
+				otherEmojisHeights.push_front(fontHeight);
+				while (otherEmojisHeights.size() > EmojiSingleOtherHeights) {
+					otherEmojisMap.remove(otherEmojisHeights.back());
+					otherEmojisHeights.pop_back();
+				}
+			}
+			map = &otherEmojisMap[fontHeight];
+		}
 		EmojisMap::const_iterator i = map->constFind(emoji->code);
 		if (i == map->cend()) {
 			QImage img(st::emojiImgSize + st::emojiPadding * cIntRetinaFactor() * 2, fontHeight * cIntRetinaFactor(), QImage::Format_ARGB32_Premultiplied);
@@ -1632,6 +1669,8 @@ namespace App {
 	}
 
 	void checkImageCacheSize() {
+		clearUnusedImageAtlases();
+
 		int64 nowImageCacheSize = imageCacheSize();
 		if (nowImageCacheSize > serviceImageCacheSize + MemoryForImageCache) {
 			App::forgetMedia();
@@ -66,6 +66,8 @@ namespace App {
 	MTPpeer peerToMTP(const PeerId &peer_id);
     int32 userFromPeer(const PeerId &peer_id);
     int32 chatFromPeer(const PeerId &peer_id);
+	int32 idFromMessage(const MTPmessage &msg);
+	int32 idFromUser(const MTPuser &user);
 
 	int32 onlineForSort(int32 online, int32 now);
 	int32 onlineWillChangeIn(int32 onlineOnServer, int32 nowOnServer);
@@ -159,6 +161,7 @@ namespace App {
 	const QPixmap &emojiSingle(const EmojiData *emoji, int32 fontHeight);
 
 	void initMedia();
+	void initMediaDelayed(); // audio device is opened after the first frame is shown
 	void deinitMedia(bool completely = true);
 	void playSound();
 
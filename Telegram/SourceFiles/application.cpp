@@ -79,6 +79,7 @@ namespace {
 Application::Application(int &argc, char **argv) : PsApplication(argc, argv),
     serverName(psServerPrefix() + cGUIDStr()), closing(false),
 	updateRequestId(0), updateReply(0), updateThread(0), updateDownloader(0), _translator(0) {
+	TraceSpan span("Application::Application");
 
 	DEBUG_LOG(("Application Info: creation.."));
 
@@ -146,13 +147,17 @@ Application::Application(int &argc, char **argv) : PsApplication(argc, argv),
 
 	installTranslator(_translator = new Translator());
 
+	traceBegin("style::startManager");
 	style::startManager();
+	traceEnd("style::startManager");
 	anim::startManager();
 	historyInit();
 
 	DEBUG_LOG(("Application Info: inited.."));
 
+	traceBegin("Window::Window");
     window = new Window();
+	traceEnd("Window::Window");
 
 	psInstallEventFilter();
 
@@ -344,7 +349,7 @@ void Application::peerClearPhoto(PeerId peer) {
 
 void Application::killDownloadSessionsStart(int32 dc) {
 	if (killDownloadSessionTimes.constFind(dc) == killDownloadSessionTimes.cend()) {
-		killDownloadSessionTimes.insert(dc, getms() + MTPAckSendWaiting + MTPKillFileSessionTimeout);
+		killDownloadSessionTimes.insert(dc, getms()); // idle since
 	}
 	if (!killDownloadSessionsTimer.isActive()) {
 		killDownloadSessionsTimer.start(MTPAckSendWaiting + MTPKillFileSessionTimeout + 5);
@@ -368,19 +373,28 @@ void Application::onAppStateChanged(Qt::ApplicationState state) {
 }
 
 void Application::killDownloadSessions() {
-	uint64 ms = getms(), left = MTPAckSendWaiting + MTPKillFileSessionTimeout;
+	uint64 ms = getms(), left = MTPAckSendWaiting + MTPKeepFileSessionTimeout;
+	uint64 killExtraAfter = MTPAckSendWaiting + MTPKillFileSessionTimeout, killAllAfter = MTPAckSendWaiting + MTPKeepFileSessionTimeout;
 	for (QMap<int32, uint64>::iterator i = killDownloadSessionTimes.begin(); i != killDownloadSessionTimes.end(); ) {
-		if (i.value() <= ms) {
+		uint64 idle = (ms > i.value()) ? (ms - i.value()) : 0, wait = 0;
+		if (idle >= killAllAfter) {
 			for (int j = 0; j < MTPDownloadSessionsCount; ++j) {
 				MTP::stopSession(MTP::dld[j] + i.key());
 			}
 			i = killDownloadSessionTimes.erase(i);
-		} else {
-			if (i.value() - ms < left) {
-				left = i.value() - ms;
+			continue;
+		} else if (idle >= killExtraAfter) { // first session is kept warm for the next burst
+			for (int j = 1; j < MTPDownloadSessionsCount; ++j) {
+				MTP::stopSession(MTP::dld[j] + i.key());
 			}
-			++i;
+			wait = killAllAfter - idle;
+		} else {
+			wait = killExtraAfter - idle;
+		}
+		if (wait < left) {
+			left = wait;
 		}
+		++i;
 	}
 	if (!killDownloadSessionTimes.isEmpty()) {
 		killDownloadSessionsTimer.start(left);
@@ -676,27 +690,35 @@ void Application::checkMapVersion() {
 }
 
 void Application::startApp() {
+	TraceSpan span("Application::startApp");
+
 	cChangeTimeFormat(QLocale::system().timeFormat(QLocale::ShortFormat));
 
 	DEBUG_LOG(("Application Info: starting app.."));
 
 	QMimeDatabase().mimeTypeForName(qsl("text/plain")); // create mime database
 
+	traceBegin("Window::init");
 	window->createWinId();
 	window->init();
+	traceEnd("Window::init");
 
 	DEBUG_LOG(("Application Info: window created.."));
 
 	initImageLinkManager();
 	App::initMedia();
 
+	traceBegin("Local::readMap");
 	Local::ReadMapState state = Local::readMap(QByteArray());
+	traceEnd("Local::readMap");
 	if (state == Local::ReadMapPassNeeded) {
 		cSetHasPasscode(true);
 		DEBUG_LOG(("Application Info: passcode nneded.."));
 	} else {
 		DEBUG_LOG(("Application Info: local map read.."));
+		traceBegin("MTP::start");
 		MTP::start();
+		traceEnd("MTP::start");
 	}
 
 	MTP::setStateChangedHandler(mtpStateChanged);
@@ -714,7 +736,9 @@ void Application::startApp() {
 			window->setupIntro(false);
 		}
 	}
+	traceBegin("Window::firstShow");
 	window->firstShow();
+	traceEnd("Window::firstShow");
 
 	if (cStartToSettings()) {
 		window->showSettings();
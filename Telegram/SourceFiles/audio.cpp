@@ -197,6 +197,7 @@ _fader(new VoiceMessagesFader(&_faderThread)), _loader(new VoiceMessagesLoader(&
 	connect(this, SIGNAL(faderOnTimer()), _fader, SLOT(onTimer()));
 	connect(this, SIGNAL(loaderOnStart(AudioData*)), _loader, SLOT(onStart(AudioData*)));
 	connect(this, SIGNAL(loaderOnCancel(AudioData*)), _loader, SLOT(onCancel(AudioData*)));
+	connect(this, SIGNAL(loaderOnPreload(AudioData*,quint64,const QString&,const QByteArray&)), _loader, SLOT(onPreload(AudioData*,quint64,const QString&,const QByteArray&)));
 	connect(&_faderThread, SIGNAL(started()), _fader, SLOT(onInit()));
 	connect(&_loaderThread, SIGNAL(started()), _loader, SLOT(onInit()));
 	connect(&_faderThread, SIGNAL(finished()), _fader, SLOT(deleteLater()));
@@ -326,6 +327,13 @@ void VoiceMessages::pauseresume() {
 	emit faderOnTimer();
 }
 
+void VoiceMessages::preload(AudioData *audio) {
+	QString fname = audio->already(true);
+	if (fname.isEmpty() && audio->data.isEmpty()) return;
+
+	emit loaderOnPreload(audio, audio->id, fname, audio->data);
+}
+
 void VoiceMessages::currentState(AudioData **audio, VoiceMessageState *state, int64 *position, int64 *duration) {
 	QMutexLocker lock(&voicemsgsMutex);
 	if (audio) *audio = _data[_current].audio;
@@ -482,19 +490,23 @@ void VoiceMessagesFader::processContext() {
 }
 
 struct VoiceMessagesLoader::Loader {
+	AudioId audioId;
 	QString fname;
 	QByteArray data;
 	OggOpusFile *file;
+	int64 position; // samples already passed to OpenAL
 	ogg_int64_t pcm_offset;
 	ogg_int64_t pcm_print_offset;
 	int prev_li;
 
-	Loader() : file(0), pcm_offset(0), pcm_print_offset(0), prev_li(-1) {
-
+	Loader() : audioId(0), file(0), position(0), pcm_offset(0), pcm_print_offset(0), prev_li(-1) {
+	}
+	~Loader() {
+		if (file) op_free(file);
 	}
 };
 
-VoiceMessagesLoader::VoiceMessagesLoader(QThread *thread) {
+VoiceMessagesLoader::VoiceMessagesLoader(QThread *thread) : _pcmCacheSize(0), _pcmCacheTick(0) {
 	moveToThread(thread);
 }
 
@@ -523,97 +535,44 @@ void VoiceMessagesLoader::loadError(Loaders::iterator i) {
 	_loaders.erase(i);
 }
 
-void VoiceMessagesLoader::onLoad(AudioData *audio) {
-	bool started = false;
-	int32 audioindex = -1;
-	Loader *l = 0;
-	Loaders::iterator j = _loaders.end();
-	{
-		QMutexLocker lock(&voicemsgsMutex);
-		VoiceMessages *voice = audioVoice();
-		if (!voice) return;
-
-		for (int32 i = 0; i < AudioVoiceMsgSimultaneously; ++i) {
-			VoiceMessages::Msg &m(voice->_data[i]);
-			if (m.audio != audio || !m.loading) continue;
-
-			audioindex = i;
-			j = _loaders.find(audio);
-			if (j != _loaders.end() && (j.value()->fname != m.fname || j.value()->data.size() != m.data.size())) {
-				delete j.value();
-				_loaders.erase(j);
-				j = _loaders.end();
-			}
-			if (j == _loaders.end()) {
-				l = (j = _loaders.insert(audio, new Loader())).value();
-				l->fname = m.fname;
-				l->data = m.data;
-				
-				int ret;
-				if (m.data.isEmpty()) {
-					l->file = op_open_file(m.fname.toUtf8().constData(), &ret);
-				} else {
-					l->file = op_open_memory((const unsigned char*)m.data.constData(), m.data.size(), &ret);
-				}
-				if (!l->file) {
-					LOG(("Audio Error: op_open_file failed for '%1', data size '%2', error code %3").arg(m.fname).arg(m.data.size()).arg(ret));
-					m.state = VoiceMessageStopped;
-					return loadError(j);
-				}
-				ogg_int64_t duration = op_pcm_total(l->file, -1);
-				if (duration < 0) {
-					LOG(("Audio Error: op_pcm_total failed to get full duration for '%1', data size '%2', error code %3").arg(m.fname).arg(m.data.size()).arg(duration));
-					m.state = VoiceMessageStopped;
-					return loadError(j);
-				}
-				m.duration = duration;
-				m.skipStart = 0;
-				m.skipEnd = duration;
-				m.position = 0;
-				m.started = 0;
-				started = true;
-			} else {
-				if (!m.skipEnd) continue;
-				l = j.value();
-			}
-			break;
+bool VoiceMessagesLoader::prepareFile(Loader *l) {
+	if (!l->file) {
+		int ret = 0;
+		if (l->data.isEmpty()) {
+			l->file = op_open_file(l->fname.toUtf8().constData(), &ret);
+		} else {
+			l->file = op_open_memory((const unsigned char*)l->data.constData(), l->data.size(), &ret);
+		}
+		if (!l->file) {
+			LOG(("Audio Error: op_open_file failed for '%1', data size '%2', error code %3").arg(l->fname).arg(l->data.size()).arg(ret));
+			return false;
 		}
-	}
-
-	if (j == _loaders.end()) {
-		LOG(("Audio Error: trying to load part of audio, that is not playing at the moment"));
-		emit error(audio);
-		return;
-	}
-	if (started) {
 		l->pcm_offset = op_pcm_tell(l->file);
 		l->pcm_print_offset = l->pcm_offset - AudioVoiceMsgFrequency;
 	}
+	if (op_pcm_tell(l->file) != l->position) { // first chunks were taken from cache
+		int ret = op_pcm_seek(l->file, l->position);
+		if (ret < 0) {
+			LOG(("Audio Error: op_pcm_seek failed for '%1', data size '%2', offset %3, error code %4").arg(l->fname).arg(l->data.size()).arg(l->position).arg(ret));
+			return false;
+		}
+		l->pcm_offset = op_pcm_tell(l->file);
+		l->prev_li = -1;
+	}
+	return true;
+}
 
-	bool finished = false;
-    DEBUG_LOG(("Audio Info: reading buffer for file '%1', data size '%2', current pcm_offset %3").arg(l->fname).arg(l->data.size()).arg(l->pcm_offset));
+bool VoiceMessagesLoader::readChunk(Loader *l, AudioData *audio, int32 audioindex, QByteArray &result, int64 &samplesAdded, bool &finished) {
+	DEBUG_LOG(("Audio Info: reading buffer for file '%1', data size '%2', current pcm_offset %3").arg(l->fname).arg(l->data.size()).arg(l->pcm_offset));
 
-	QByteArray result;
-	int64 samplesAdded = 0;
 	while (result.size() < AudioVoiceMsgBufferSize) {
 		opus_int16 pcm[AudioVoiceMsgFrequency * AudioVoiceMsgChannels];
 
 		int ret = op_read_stereo(l->file, pcm, sizeof(pcm) / sizeof(*pcm));
 		if (ret < 0) {
-			/*{
-				QMutexLocker lock(&voicemsgsMutex);
-				VoiceMessages *voice = audioVoice();
-				if (voice) {
-					VoiceMessages::Msg &m(voice->_data[audioindex]);
-					if (m.audio == audio) {
-						m.state = VoiceMessageStopped;
-					}
-				}
-			}*/
 			LOG(("Audio Error: op_read_stereo failed, error code %1 (corrupted voice message?)").arg(ret));
 			finished = true;
 			break;
-//			return loadError(j);
 		}
 
 		int li = op_current_link(l->file);
@@ -648,19 +607,146 @@ void VoiceMessagesLoader::onLoad(AudioData *audio) {
 		l->prev_li = li;
 		samplesAdded += ret;
 
-		{
+		if (audioindex >= 0) {
 			QMutexLocker lock(&voicemsgsMutex);
 			VoiceMessages *voice = audioVoice();
-			if (!voice) return;
+			if (!voice) return false;
 
 			VoiceMessages::Msg &m(voice->_data[audioindex]);
 			if (m.audio != audio || !m.loading || m.fname != l->fname || m.data.size() != l->data.size()) {
 				LOG(("Audio Error: playing changed while loading"));
 				m.state = VoiceMessageStopped;
-				return loadError(j);
+				loadError(_loaders.find(audio));
+				return false;
 			}
 		}
 	}
+	return true;
+}
+
+const VoiceMessagesLoader::PcmChunk *VoiceMessagesLoader::cachedChunk(AudioId audioId, int64 offset) {
+	PcmCache::iterator i = _pcmCache.find(PcmKey(audioId, offset));
+	if (i == _pcmCache.end()) return 0;
+
+	_pcmCacheOrder.remove(i.value().tick);
+	i.value().tick = ++_pcmCacheTick;
+	_pcmCacheOrder.insert(i.value().tick, i.key());
+	return &i.value();
+}
+
+void VoiceMessagesLoader::cacheChunk(AudioId audioId, int64 offset, const QByteArray &data, int64 samples, bool last) {
+	if (data.size() > AudioVoiceMsgCacheSize / 4) return;
+
+	PcmKey key(audioId, offset);
+	PcmCache::iterator i = _pcmCache.find(key);
+	if (i != _pcmCache.end()) {
+		_pcmCacheSize -= i.value().data.size();
+		_pcmCacheOrder.remove(i.value().tick);
+		_pcmCache.erase(i);
+	}
+	_pcmCacheSize += data.size();
+	while (_pcmCacheSize > AudioVoiceMsgCacheSize && !_pcmCacheOrder.isEmpty()) { // evict least recently used chunks
+		PcmCache::iterator oldest = _pcmCache.find(_pcmCacheOrder.cbegin().value());
+		_pcmCacheOrder.erase(_pcmCacheOrder.begin());
+		if (oldest != _pcmCache.end()) {
+			_pcmCacheSize -= oldest.value().data.size();
+			_pcmCache.erase(oldest);
+		}
+	}
+
+	PcmChunk &chunk(_pcmCache[key]);
+	chunk.data = data;
+	chunk.samples = samples;
+	chunk.last = last;
+	chunk.tick = ++_pcmCacheTick;
+	_pcmCacheOrder.insert(chunk.tick, key);
+}
+
+void VoiceMessagesLoader::onLoad(AudioData *audio) {
+	uint64 ms = getms();
+	bool started = false;
+	int32 audioindex = -1;
+	Loader *l = 0;
+	Loaders::iterator j = _loaders.end();
+	{
+		QMutexLocker lock(&voicemsgsMutex);
+		VoiceMessages *voice = audioVoice();
+		if (!voice) return;
+
+		for (int32 i = 0; i < AudioVoiceMsgSimultaneously; ++i) {
+			VoiceMessages::Msg &m(voice->_data[i]);
+			if (m.audio != audio || !m.loading) continue;
+
+			audioindex = i;
+			j = _loaders.find(audio);
+			if (j != _loaders.end() && (j.value()->fname != m.fname || j.value()->data.size() != m.data.size())) {
+				delete j.value();
+				_loaders.erase(j);
+				j = _loaders.end();
+			}
+			if (j == _loaders.end()) {
+				l = (j = _loaders.insert(audio, new Loader())).value();
+				l->audioId = audio->id;
+				l->fname = m.fname;
+				l->data = m.data;
+
+				PcmDurations::const_iterator d = _pcmDurations.constFind(l->audioId);
+				ogg_int64_t duration = (d != _pcmDurations.cend() && _pcmCache.contains(PcmKey(l->audioId, 0))) ? d.value() : -1;
+				if (duration < 0) { // not cached, decoding from the start
+					if (!prepareFile(l)) {
+						m.state = VoiceMessageStopped;
+						return loadError(j);
+					}
+					duration = op_pcm_total(l->file, -1);
+					if (duration < 0) {
+						LOG(("Audio Error: op_pcm_total failed to get full duration for '%1', data size '%2', error code %3").arg(m.fname).arg(m.data.size()).arg(duration));
+						m.state = VoiceMessageStopped;
+						return loadError(j);
+					}
+					_pcmDurations.insert(l->audioId, duration);
+				}
+				m.duration = duration;
+				m.skipStart = 0;
+				m.skipEnd = duration;
+				m.position = 0;
+				m.started = 0;
+				started = true;
+			} else {
+				if (!m.skipEnd) continue;
+				l = j.value();
+			}
+			break;
+		}
+	}
+
+	if (j == _loaders.end()) {
+		LOG(("Audio Error: trying to load part of audio, that is not playing at the moment"));
+		emit error(audio);
+		return;
+	}
+
+	bool finished = false, fromCache = false;
+	QByteArray result;
+	int64 samplesAdded = 0;
+	if (const PcmChunk *chunk = cachedChunk(l->audioId, l->position)) {
+		result = chunk->data;
+		samplesAdded = chunk->samples;
+		finished = chunk->last;
+		fromCache = true;
+	} else {
+		if (!prepareFile(l)) {
+			QMutexLocker lock(&voicemsgsMutex);
+			VoiceMessages *voice = audioVoice();
+			if (voice && voice->_data[audioindex].audio == audio) {
+				voice->_data[audioindex].state = VoiceMessageStopped;
+			}
+			return loadError(j);
+		}
+		if (!readChunk(l, audio, audioindex, result, samplesAdded, finished)) return;
+
+		cacheChunk(l->audioId, l->position, result, samplesAdded, finished);
+	}
+	l->position += samplesAdded;
 
 	QMutexLocker lock(&voicemsgsMutex);
 	VoiceMessages *voice = audioVoice();
@@ -674,6 +760,7 @@ void VoiceMessagesLoader::onLoad(AudioData *audio) {
 	}
 
 	if (started) {
+		DEBUG_LOG(("Audio Info: first buffer for file '%1' is ready in %2ms%3").arg(l->fname).arg(getms() - ms).arg(fromCache ? qsl(" (from cache)") : QString()));
 		if (m.source) {
 			alSourceStop(m.source);
 			for (int32 i = 0; i < 3; ++i) {
@@ -755,3 +842,23 @@ void VoiceMessagesLoader::onCancel(AudioData *audio) {
 		}
 	}
 }
+
+void VoiceMessagesLoader::onPreload(AudioData *audio, quint64 audioId, const QString &fname, const QByteArray &data) {
+	if (_loaders.contains(audio) || _pcmCache.contains(PcmKey(audioId, 0))) return; // audio is only compared, it may be deleted already
+
+	Loader l;
+	l.fname = fname;
+	l.data = data;
+	if (!prepareFile(&l)) return;
+
+	ogg_int64_t duration = op_pcm_total(l.file, -1);
+	if (duration < 0) return;
+
+	QByteArray result;
+	int64 samplesAdded = 0;
+	bool finished = false;
+	readChunk(&l, audio, -1, result, samplesAdded, finished);
+
+	_pcmDurations.insert(audioId, duration);
+	cacheChunk(audioId, 0, result, samplesAdded, finished);
+}
@@ -46,6 +46,7 @@ public:
 
 	void play(AudioData *audio);
 	void pauseresume();
+	void preload(AudioData *audio);
 
 	void currentState(AudioData **audio, VoiceMessageState *state = 0, int64 *position = 0, int64 *duration = 0);
 	void processContext();
@@ -64,6 +65,7 @@ signals:
 	void faderOnTimer();
 	void loaderOnStart(AudioData *audio);
 	void loaderOnCancel(AudioData *audio);
+	void loaderOnPreload(AudioData *audio, quint64 audioId, const QString &fname, const QByteArray &data);
 
 private:
 
@@ -158,6 +160,7 @@ public slots:
 	void onStart(AudioData *audio);
 	void onLoad(AudioData *audio);
 	void onCancel(AudioData *audio);
+	void onPreload(AudioData *audio, quint64 audioId, const QString &fname, const QByteArray &data);
 	
 private:
 
@@ -166,5 +169,29 @@ private:
 	Loaders _loaders;
 
 	void loadError(Loaders::iterator i);
+	bool prepareFile(Loader *l);
+	bool readChunk(Loader *l, AudioData *audio, int32 audioindex, QByteArray &result, int64 &samplesAdded, bool &finished);
+
+	struct PcmChunk {
+		PcmChunk() : samples(0), last(false), tick(0) {
+		}
+		QByteArray data;
+		int64 samples;
+		bool last;
+		uint64 tick;
+	};
+	typedef QPair<AudioId, int64> PcmKey; // keyed by id, AudioData objects are deleted and reallocated on logout
+	typedef QMap<PcmKey, PcmChunk> PcmCache;
+	PcmCache _pcmCache;
+	typedef QMap<uint64, PcmKey> PcmCacheOrder; // tick -> chunk, least recently used first
+	PcmCacheOrder _pcmCacheOrder;
+	int32 _pcmCacheSize;
+	uint64 _pcmCacheTick;
+
+	typedef QMap<AudioId, int64> PcmDurations;
+	PcmDurations _pcmDurations;
+
+	const PcmChunk *cachedChunk(AudioId audioId, int64 offset);
+	void cacheChunk(AudioId audioId, int64 offset, const QByteArray &data, int64 samples, bool last);
 
 };
@@ -26,6 +26,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 ContactsInner::ContactsInner(bool creatingChat) : _chat(0), _creatingChat(creatingChat),
 _contacts(&App::main()->contactsList()),
 _sel(0),
+_filteredFull(false),
 _filteredSel(-1),
 _mouseSel(false),
 _selCount(0),
@@ -38,6 +39,7 @@ _addContactLnk(this, lang(lng_add_contact_button)) {
 ContactsInner::ContactsInner(ChatData *chat) : _chat(chat), _creatingChat(false),
 _contacts(&App::main()->contactsList()),
 _sel(0),
+_filteredFull(false),
 _filteredSel(-1),
 _mouseSel(false),
 _selCount(0),
@@ -61,6 +63,12 @@ void ContactsInner::init() {
 	connect(App::main(), SIGNAL(peerUpdated(PeerData*)), this, SLOT(peerUpdated(PeerData *)));
 	connect(App::main(), SIGNAL(peerNameChanged(PeerData *, const PeerData::Names &, const PeerData::NameFirstChars &)), this, SLOT(peerUpdated(PeerData *)));
 	connect(App::main(), SIGNAL(peerPhotoChanged(PeerData *)), this, SLOT(peerUpdated(PeerData *)));
+	connect(App::main(), SIGNAL(peerNameChanged(PeerData *, const PeerData::Names &, const PeerData::NameFirstChars &)), this, SLOT(onContactsChanged()));
+	connect(App::main(), SIGNAL(dialogsUpdated()), this, SLOT(onContactsChanged()));
+}
+
+void ContactsInner::onContactsChanged() {
+	_filteredFull = false; // renamed or added contacts may match the next query
 }
 
 void ContactsInner::peerUpdated(PeerData *peer) {
@@ -163,7 +171,7 @@ void ContactsInner::paintDialog(QPainter &p, UserData *user, ContactData *data,
 		p.fillRect(0, 0, width(), 2 * st::profileListPadding.height() + st::profileListPhotoSize, ((data->inchat || data->check) ? st::profileActiveBG : st::profileHoverBG)->b);
 	}
 
-	p.drawPixmap(left, st::profileListPadding.height(), user->photo->pix(st::profileListPhotoSize));
+	user->photo->paintSmall(p, left, st::profileListPadding.height(), st::profileListPhotoSize);
 
 	if (data->inchat || data->check) {
 		p.setPen(st::white->p);
@@ -453,7 +461,11 @@ void ContactsInner::updateFilter(QString filter) {
 		filter = f.join(' ');
 	}
 	if (_filter != filter) {
+		uint64 ms = getms(true);
 		int32 rh = (st::profileListPhotoSize + st::profileListPadding.height() * 2);
+
+		// when the query only grows the results can only narrow, so the previous ones are filtered again
+		bool narrow = _filteredFull && !_filter.isEmpty() && filter.startsWith(_filter);
 		_filter = filter;
 
 		_byUsernameFiltered.clear();
@@ -483,63 +495,35 @@ void ContactsInner::updateFilter(QString filter) {
 			refresh();
 		} else {
 			if (!_addContactLnk.isHidden()) _addContactLnk.hide();
-			QStringList::const_iterator fb = f.cbegin(), fe = f.cend(), fi;
 
-			_filtered.clear();
-			if (!f.isEmpty()) {
-				DialogsList *dialogsToFilter = 0;
-				if (_contacts->list.count) {
-					for (fi = fb; fi != fe; ++fi) {
-						DialogsIndexed::DialogsIndex::iterator i = _contacts->index.find(fi->at(0));
-						if (i == _contacts->index.cend()) {
-							dialogsToFilter = 0;
-							break;
-						}
-						if (!dialogsToFilter || dialogsToFilter->count > i.value()->count) {
-							dialogsToFilter = i.value();
-						}
+			if (narrow) {
+				int32 filtered = 0;
+				for (int32 i = 0, l = _filtered.size(); i < l; ++i) {
+					if (_filtered[i]->history->peer->matchesFilter(f)) {
+						_filtered[filtered++] = _filtered[i];
 					}
 				}
+				_filtered.resize(filtered);
+			} else {
+				_filteredFull = true;
+				_filtered.clear();
+				DialogsList *dialogsToFilter = f.isEmpty() ? 0 : _contacts->filterList(f);
 				if (dialogsToFilter && dialogsToFilter->count) {
 					_filtered.reserve(dialogsToFilter->count);
 					for (DialogRow *i = dialogsToFilter->begin, *e = dialogsToFilter->end; i != e; i = i->next) {
-						const PeerData::Names &names(i->history->peer->names);
-						PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-						for (fi = fb; fi != fe; ++fi) {
-							QString filterName(*fi);
-							for (ni = nb; ni != ne; ++ni) {
-								if (ni->startsWith(*fi)) {
-									break;
-								}
-							}
-							if (ni == ne) {
-								break;
-							}
-						}
-						if (fi == fe) {
+						if (i->history->peer->matchesFilter(f)) {
 							i->attached = 0;
 							_filtered.push_back(i);
 						}
 					}
 				}
+			}
 
+			if (!f.isEmpty()) {
 				_byUsernameFiltered.reserve(_byUsername.size());
 				d_byUsernameFiltered.reserve(d_byUsername.size());
 				for (int32 i = 0, l = _byUsername.size(); i < l; ++i) {
-					const PeerData::Names &names(_byUsername[i]->names);
-					PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-					for (fi = fb; fi != fe; ++fi) {
-						QString filterName(*fi);
-						for (ni = nb; ni != ne; ++ni) {
-							if (ni->startsWith(*fi)) {
-								break;
-							}
-						}
-						if (ni == ne) {
-							break;
-						}
-					}
-					if (fi == fe) {
+					if (_byUsername[i]->matchesFilter(f)) {
 						_byUsernameFiltered.push_back(_byUsername[i]);
 						d_byUsernameFiltered.push_back(d_byUsername[i]);
 					}
@@ -567,6 +551,8 @@ void ContactsInner::updateFilter(QString filter) {
 		}
 		if (parentWidget()) parentWidget()->update();
 		loadProfilePhotos(0);
+		static MetricHandle contactsFilterMsMetric = metricHistogram(qsl("contacts.filter_ms"));
+		metricSample(contactsFilterMsMetric, getms(true) - ms);
 	}
 }
 
@@ -75,6 +75,7 @@ public slots:
 
 	void updateSel();
 	void peerUpdated(PeerData *peer);
+	void onContactsChanged();
 
 private:
 
@@ -88,6 +89,7 @@ private:
 	QString _filter;
 	typedef QVector<DialogRow*> FilteredDialogs;
 	FilteredDialogs _filtered;
+	bool _filteredFull; // _filtered has all contacts matching _filter, so a longer query can filter it again
 	int32 _filteredSel;
 	bool _mouseSel;
 
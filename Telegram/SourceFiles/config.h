@@ -33,20 +33,33 @@ enum {
 	MTPShortBufferSize = 65535, // of ints, 256 kb
 	MTPPacketSizeMax = 67108864, // 64 mb
 	MTPIdsBufferSize = 400, // received msgIds and wereAcked msgIds count stored
-	MTPCheckResendTimeout = 10000, // how much time passed from send till we resend request or check it's state, in ms
+	MTPRequestsShardsCount = 16, // requests registry is split in 16 parts with separate locks
+	MTPCheckResendTimeout = 10000, // max time passed from send till we resend request or check it's state (until rtt is known), in ms
+	MTPCheckResendMinTimeout = 2000, // min time passed from send till we resend request or check it's state, in ms
+	MTPCheckResendPeriod = 250, // sent requests timeouts are checked four times a second
+	MTPCheckResendMaxBackoff = 3, // resend timeout is doubled after each timeout, up to 8 times
 	MTPCheckResendWaiting = 1000, // how much time to wait for some more requests, when resending request or checking it's state, in ms
 	MTPAckSendWaiting = 10000, // how much time to wait for some more requests, when sending msg acks
 	MTPResendThreshold = 1, // how much ints should message contain for us not to resend, but to check it's state
 	MTPContainerLives = 600, // container lives 10 minutes in haveSent map
+	MTPContainerMaxRequests = 64, // no more than 64 requests in one container, others wait for the next one
+	MTPRequestStarvationTimeout = 1000, // waiting request gets higher priority each second
 	MTPMinReceiveDelay = 4000, // 4 seconds
 	MTPMaxReceiveDelay = 64000, // 64 seconds
 	MTPConnectionOldTimeout = 192000, // 192 seconds
 	MTPTcpConnectionWaitTimeout = 3000, // 3 seconds waiting for tcp, until we accept http
+	MTPTcpConnectionRaceDelay = 300, // 300 ms before a tcp connect to the next dc address is started in parallel
+	MTPTcpConnectionRaceCount = 4, // no more than 4 parallel tcp connects to different dc addresses
+	MTPMetricsBuckets = 32, // histogram metrics have buckets for [0, 1], (1, 2], (2, 4], .. (2^30, +inf)
+	StartupTraceMaxEvents = 4096, // startup trace stops collecting spans after 4096 events
 	MTPMillerRabinIterCount = 30, // 30 Miller-Rabin iterations for dh_prime primality check
+	MTPDhPreparedExponents = 4, // keep 4 ready random 'b' with g_b for each validated dh_prime
 
 	MTPUploadSessionsCount = 4, // max 4 upload sessions is created
 	MTPDownloadSessionsCount = 4, // max 4 download sessions is created
 	MTPKillFileSessionTimeout = 5000, // how much time without upload / download causes additional session kill
+	MTPKeepFileSessionTimeout = 60000, // how much time without upload / download causes first upload / download session kill
+	MTPFileSessionFillSize = 256 * 1024, // next upload / download session is used only when each of the previous has 256kb in flight
 
 	MTPEnumDCTimeout = 4000, // 4 seconds timeout for help_getConfig to work (them move to other dc)
 
@@ -56,6 +69,11 @@ enum {
 	MTPPingSendAfterAuto = 30, // send new ping starting from 30 seconds (add to existing container)
 	MTPPingSendAfter = 45, // send new ping after 45 seconds without ping
 
+	MTPGzipMinSize = 1024, // try to gzip outgoing requests larger than 1 kb
+	MTPGzipMaxPercent = 75, // gzipped request must be no more than 75% of the original size
+	MTPGzipMaxTime = 10, // gzipping a request must take less than 10ms
+	MTPGzipSkipAfterBad = 16, // when gzip didn't help next 16 large requests are sent as is
+
 	MaxSelectedItems = 100,
 
 	MaxPhoneTailLength = 18, // rest of the phone number, without country code (seen 12 at least)
@@ -71,6 +89,7 @@ enum {
 	LocalEncryptKeySize = 256, // 2048 bit
 
 	AnimationTimerDelta = 7,
+	AnimationHiddenTimerDelta = 100, // animations of hidden widgets and minimized windows are stepped 10 times a second
 
 	SaveRecentEmojisTimeout = 3000, // 3 secs
 	SaveWindowPositionTimeout = 1000, // 1 sec
@@ -80,6 +99,9 @@ enum {
 	SearchManyPerPage = 100,
 	MediaOverviewStartPerPage = 5,
 	MediaOverviewPreloadCount = 4,
+	MediaOverviewPhotosCacheCount = 512, // photo cells kept generated in shared media overview
+	MediaOverviewGenPixTimeout = 8, // 8ms per frame spent on generating photo cells
+	MentionsDropdownMaxRows = 100, // top online participants shown in @mention autocomplete
 
 	AudioVoiceMsgSimultaneously = 4,
 	AudioCheckPositionTimeout = 100, // 100ms per check audio pos
@@ -91,6 +113,7 @@ enum {
 	AudioVoiceMsgChannels = 2, // stereo
 	AudioVoiceMsgBufferSize = 1024 * 1024, // 1 Mb buffers
 	AudioVoiceMsgInMemory = 1024 * 1024, // 1 Mb audio is hold in memory and auto loaded
+	AudioVoiceMsgCacheSize = 16 * 1024 * 1024, // 16 Mb of decoded voice messages are kept for replays
 	AudioSuspendTimeout = 3000, // suspend in 3 secs after playing is over
 
 	StickerInMemory = 256 * 1024, // 128 Kb stickers hold in memory, auto loaded and displayed inline
@@ -101,8 +124,12 @@ enum {
 	ZoomToScreenLevel = 1024, // just constant
 
 	PreloadHeightsCount = 3, // when 3 screens to scroll left make a preload request
+	PreloadSpeedHeightsCount = 6, // scrolling speed extends the preload distance up to 6 screens
+	ScrollFrameTimeout = 16, // scroll reactions like preloading run at most once per 16ms frame
+	ScrollFastSpeed = 3000, // 3000px per second, scrolling faster than that defers image preloading
 	EmojiPadPerRow = 7,
 	EmojiPadRowsPerPage = 6,
+	EmojiSingleOtherHeights = 2, // single emoji pixmaps are kept for the main field font height and 2 last used others
 	StickerPadPerRow = 3,
 	StickersUpdateTimeout = 3600000, // update not more than once in an hour
 
@@ -115,6 +142,8 @@ enum {
 	MaxHttpRedirects = 5, // when getting external data/images
 
 	WriteMapTimeout = 1000,
+	SentMediaRememberCount = 1000, // remember server media for 1000 last sent files to send them again without uploading
+	SentMediaKeyPartSize = 64 * 1024, // sent media key of a file hashes only its first and last 64 kb
 	SaveDraftTimeout = 1000, // save draft after 1 secs of not changing text
 	SaveDraftAnywayTimeout = 5000, // or save anyway each 5 secs
 
@@ -263,6 +292,10 @@ enum {
 	MessagesFirstLoad = 30, // first history part size requested
 	MessagesPerPage = 50, // next history part size
 
+	ApiBatchDelay = 16, // lookups are collected for one frame before they are sent
+	ApiBatchMaxIds = 100, // max message ids requested in one messages.getMessages
+	ApiFullPeersInFlight = 8, // max getFullChat / getFullUser requests sent at the same time
+
 	DownloadPartSize = 64 * 1024, // 64kb for photo
 	DocumentDownloadPartSize = 128 * 1024, // 128kb for document
 	MaxUploadPhotoSize = 32 * 1024 * 1024, // 32mb photos max
@@ -279,6 +312,7 @@ enum {
     DocumentUploadPartSize4 = 512 * 1024, // 512kb for large document ( <= 1500mb )
     MaxUploadFileParallelSize = MTPUploadSessionsCount * 512 * 1024, // max 512kb uploaded at the same time in each session
     UploadRequestInterval = 500, // one part each half second, if not uploaded faster
+	LocalImageLoaderMaxThreads = 8, // max 8 threads preparing photos and documents for upload at the same time
 
 	MaxPhotosInMemory = 50, // try to clear some memory after 50 photos are created
 	NoUpdatesTimeout = 60 * 1000, // if nothing is received in 1 min we ping
@@ -286,6 +320,11 @@ enum {
 	WaitForSkippedTimeout = 1000, // 1s wait for skipped seq or pts in updates
 
 	MemoryForImageCache = 64 * 1024 * 1024, // after 64mb of unpacked images we try to clear some memory
+	ImageAtlasPageCells = 4, // small square images of the same size are packed 4x4 to one pixmap
+	ImageAtlasMaxPages = 8, // no more than 8 pixmaps (128 images) for each size, least recently painted images are evicted
+	ImageAtlasMaxCellSize = 256, // bigger images are not packed
+	ImageAtlasForgetTimeout = 30000, // pixmaps of a size not painted for 30 secs are dropped in App::checkImageCacheSize()
+	HistoryItemsCacheMemory = 16 * 1024 * 1024, // static history messages are cached as pixmaps up to 16mb, 0 disables the cache
 	NotifyWindowsCount = 3, // 3 desktop notifies at the same time
 	NotifySettingSaveTimeout = 1000, // wait 1 second before saving notify setting to server
 	UpdateChunk = 100 * 1024, // 100kb parts when downloading the update
@@ -196,7 +196,7 @@ void DialogsListWidget::peopleResultPaint(UserData *user, QPainter &p, int32 w,
 
 	History *history = App::history(user->id);
 
-	p.drawPixmap(st::dlgPaddingHor, st::dlgPaddingVer, history->peer->photo->pix(st::dlgPhotoSize));
+	history->peer->photo->paintSmall(p, st::dlgPaddingHor, st::dlgPaddingVer, st::dlgPhotoSize);
 
 	int32 nameleft = st::dlgPaddingHor + st::dlgPhotoSize + st::dlgPhotoPadding;
 	int32 namewidth = w - nameleft - st::dlgPaddingHor;
@@ -516,6 +516,10 @@ void DialogsListWidget::onFilterUpdate(QString newFilter, bool force) {
 			newFilter = f.join(' ');
 		}
 		if (newFilter != filter || force) {
+			uint64 ms = getms(true);
+
+			// when the query only grows the results can only narrow, so the previous ones are filtered again
+			bool narrow = !force && !filter.isEmpty() && newFilter.startsWith(filter);
 			filter = newFilter;
 			if (filter.isEmpty()) {
 				_state = DefaultState;
@@ -524,80 +528,39 @@ void DialogsListWidget::onFilterUpdate(QString newFilter, bool force) {
 				peopleResults.clear();
 				searchResults.clear();
 				_lastSearchId = 0;
+			} else if (narrow) {
+				_state = FilteredState;
+				int32 filtered = 0;
+				for (int32 i = 0, l = filterResults.size(); i < l; ++i) {
+					if (filterResults[i]->history->peer->matchesFilter(f)) {
+						filterResults[filtered++] = filterResults[i];
+					}
+				}
+				filterResults.resize(filtered);
 			} else {
-				QStringList::const_iterator fb = f.cbegin(), fe = f.cend(), fi;
-
 				_state = FilteredState;
 				filterResults.clear();
 				if (!f.isEmpty()) {
-					DialogsList *dialogsToFilter = 0, *contactsNoDialogsToFilter = 0;
-					if (dialogs.list.count) {
-						for (fi = fb; fi != fe; ++fi) {
-							DialogsIndexed::DialogsIndex::iterator i = dialogs.index.find(fi->at(0));
-							if (i == dialogs.index.cend()) {
-								dialogsToFilter = 0;
-								break;
-							}
-							if (!dialogsToFilter || dialogsToFilter->count > i.value()->count) {
-								dialogsToFilter = i.value();
-							}
-						}
-					}
-					if (contactsNoDialogs.list.count) {
-						for (fi = fb; fi != fe; ++fi) {
-							DialogsIndexed::DialogsIndex::iterator i = contactsNoDialogs.index.find(fi->at(0));
-							if (i == contactsNoDialogs.index.cend()) {
-								contactsNoDialogsToFilter = 0;
-								break;
-							}
-							if (!contactsNoDialogsToFilter || contactsNoDialogsToFilter->count > i.value()->count) {
-								contactsNoDialogsToFilter = i.value();
-							}
-						}
-					}
+					DialogsList *dialogsToFilter = dialogs.filterList(f), *contactsNoDialogsToFilter = contactsNoDialogs.filterList(f);
 					filterResults.reserve((dialogsToFilter ? dialogsToFilter->count : 0) + (contactsNoDialogsToFilter ? contactsNoDialogsToFilter->count : 0));
 					if (dialogsToFilter && dialogsToFilter->count) {
 						for (DialogRow *i = dialogsToFilter->begin, *e = dialogsToFilter->end; i != e; i = i->next) {
-							const PeerData::Names &names(i->history->peer->names);
-							PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-							for (fi = fb; fi != fe; ++fi) {
-								QString filterName(*fi);
-								for (ni = nb; ni != ne; ++ni) {
-									if (ni->startsWith(*fi)) {
-										break;
-									}
-								}
-								if (ni == ne) {
-									break;
-								}
-							}
-							if (fi == fe) {
+							if (i->history->peer->matchesFilter(f)) {
 								filterResults.push_back(i);
 							}
 						}
 					}
 					if (contactsNoDialogsToFilter && contactsNoDialogsToFilter->count) {
 						for (DialogRow *i = contactsNoDialogsToFilter->begin, *e = contactsNoDialogsToFilter->end; i != e; i = i->next) {
-							const PeerData::Names &names(i->history->peer->names);
-							PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-							for (fi = fb; fi != fe; ++fi) {
-								QString filterName(*fi);
-								for (ni = nb; ni != ne; ++ni) {
-									if (ni->startsWith(*fi)) {
-										break;
-									}
-								}
-								if (ni == ne) {
-									break;
-								}
-							}
-							if (fi == fe) {
+							if (i->history->peer->matchesFilter(f)) {
 								filterResults.push_back(i);
 							}
 						}
 					}
 				}
 			}
+			static MetricHandle dialogsFilterMsMetric = metricHistogram(qsl("dialogs.filter_ms"));
+			metricSample(dialogsFilterMsMetric, getms(true) - ms);
 		}
 		refresh(true);
 		setMouseSel(false, true);
@@ -738,6 +701,7 @@ int32 DialogsListWidget::addNewContact(int32 uid, bool select) {
 
 	History *history = App::history(peer);
 	contacts.addByName(history);
+	emit App::main()->dialogsUpdated();
 	DialogsList::RowByPeer::const_iterator i = dialogs.list.rowByPeer.constFind(peer);
 	if (i == dialogs.list.rowByPeer.cend()) {
 		DialogRow *added = contactsNoDialogs.addByName(history);
@@ -1356,7 +1320,7 @@ DialogsWidget::DialogsWidget(MainWidget *parent) : QWidget(parent)
 	connect(&list, SIGNAL(refreshHashtags()), this, SLOT(onFilterCursorMoved()));
 	connect(&scroll, SIGNAL(geometryChanged()), &list, SLOT(onParentGeometryChanged()));
 	connect(&scroll, SIGNAL(scrolled()), &list, SLOT(onUpdateSelected()));
-	connect(&scroll, SIGNAL(scrolled()), this, SLOT(onListScroll()));
+	connect(&scroll, SIGNAL(scrolledFrame()), this, SLOT(onListScroll()));
 	connect(&_filter, SIGNAL(cancelled()), this, SLOT(onCancel()));
 	connect(&_filter, SIGNAL(changed()), this, SLOT(onFilterUpdate()));
 	connect(&_filter, SIGNAL(cursorPositionChanged(int,int)), this, SLOT(onFilterCursorMoved(int,int)));
@@ -1476,6 +1440,8 @@ void DialogsWidget::unreadCountsReceived(const QVector<MTPDialog> &dialogs) {
 }
 
 void DialogsWidget::dialogsReceived(const MTPmessages_Dialogs &dialogs) {
+	TraceSpan span("DialogsWidget::dialogsReceived");
+
 	const QVector<MTPDialog> *dlgList = 0;
 	switch (dialogs.type()) {
 	case mtpc_messages_dialogs: {
@@ -1505,6 +1471,7 @@ void DialogsWidget::dialogsReceived(const MTPmessages_Dialogs &dialogs) {
 	if (dlgList) {
 		list.dialogsReceived(*dlgList);
 		onListScroll();
+		App::wnd()->startupInteractive();
 
 		if (dlgList->size()) {
 			dlgOffset += dlgList->size();
@@ -1718,7 +1685,9 @@ bool DialogsWidget::addNewContact(int32 uid, bool show) {
 void DialogsWidget::onListScroll() {
 //	if (!App::self()) return;
 
-	list.loadPeerPhotos(scroll.scrollTop());
+	if (qAbs(scroll.scrollSpeed()) < ScrollFastSpeed) { // userpics are loaded when scrolling slows down
+		list.loadPeerPhotos(scroll.scrollTop());
+	}
 	if (list.state() == DialogsListWidget::SearchedState) {
 		if (scroll.scrollTop() > (list.searchList().size() + list.filteredList().size() + list.peopleList().size()) * st::dlgHeight - PreloadHeightsCount * scroll.height()) {
 			onSearchMore(list.lastSearchId());
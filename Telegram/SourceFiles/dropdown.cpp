@@ -1037,7 +1037,7 @@ void MentionsInner::paintEvent(QPaintEvent *e) {
 				}
 			}
 			user->photo->load();
-			p.drawPixmap(st::mentionPadding.left(), i * st::mentionHeight + st::mentionPadding.top(), user->photo->pix(st::mentionPhotoSize));
+			user->photo->paintSmall(p, st::mentionPadding.left(), i * st::mentionHeight + st::mentionPadding.top(), st::mentionPhotoSize);
 			user->nameText.drawElided(p, 2 * st::mentionPadding.left() + st::mentionPhotoSize, i * st::mentionHeight + st::mentionTop, namewidth);
 			p.setFont(st::mentionFont->f);
 
@@ -1211,38 +1211,23 @@ void MentionsDropdown::showFiltered(ChatData *chat, QString start) {
 }
 
 void MentionsDropdown::updateFiltered(bool toDown) {
-	int32 now = unixtime();
-	QMultiMap<int32, UserData*> ordered;
 	MentionRows rows;
 	HashtagRows hrows;
 	if (_filter.at(0) == '@') {
-		rows.reserve(_chat->participants.isEmpty() ? _chat->lastAuthors.size() : _chat->participants.size());
-		if (_chat->participants.isEmpty()) {
-			if (_chat->count > 0) {
-				App::api()->requestFullPeer(_chat);
-			}
-		} else {
-			for (ChatData::Participants::const_iterator i = _chat->participants.cbegin(), e = _chat->participants.cend(); i != e; ++i) {
-				UserData *user = i.key();
-				if (user->username.isEmpty()) continue;
-				if (_filter.size() > 1 && (!user->username.startsWith(_filter.midRef(1), Qt::CaseInsensitive) || user->username.size() + 1 == _filter.size())) continue;
-				ordered.insertMulti(App::onlineForSort(user->onlineTill, now), user);
-			}
-		}
+		QSet<UserData*> authors;
 		for (MentionRows::const_iterator i = _chat->lastAuthors.cbegin(), e = _chat->lastAuthors.cend(); i != e; ++i) {
 			UserData *user = *i;
 			if (user->username.isEmpty()) continue;
 			if (_filter.size() > 1 && (!user->username.startsWith(_filter.midRef(1), Qt::CaseInsensitive) || user->username.size() + 1 == _filter.size())) continue;
 			rows.push_back(user);
-			if (!ordered.isEmpty()) {
-				ordered.remove(App::onlineForSort(user->onlineTill, now), user);
-			}
+			authors.insert(user);
 		}
-		if (!ordered.isEmpty()) {
-			for (QMultiMap<int32, UserData*>::const_iterator i = ordered.cend(), b = ordered.cbegin(); i != b;) {
-				--i;
-				rows.push_back(i.value());
+		if (_chat->participants.isEmpty()) {
+			if (_chat->count > 0) {
+				App::api()->requestFullPeer(_chat);
 			}
+		} else {
+			_chat->mentionsByPrefix(_filter.mid(1), authors, MentionsDropdownMaxRows, rows);
 		}
 	} else {
 		const RecentHashtagPack &recent(cRecentWriteHashtags());
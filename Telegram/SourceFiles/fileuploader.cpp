@@ -18,7 +18,9 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "stdafx.h"
 #include "fileuploader.h"
 
-FileUploader::FileUploader() : sentSize(0), uploading(0) {
+#include "localstorage.h"
+
+FileUploader::FileUploader() : sentSize(0), uploading(0), extraSessionsKilled(false) {
 	memset(sentSizes, 0, sizeof(sentSizes));
 	nextTimer.setSingleShot(true);
 	connect(&nextTimer, SIGNAL(timeout()), this, SLOT(sendNext()));
@@ -41,10 +43,23 @@ void FileUploader::uploadMedia(MsgId msgId, const ReadyLocalMedia &media) {
 			document->location = FileLocation(mtpc_storage_filePartial, media.file);
 		}
 	}
+	if (media.contentKey.first || media.contentKey.second) {
+		contents.insert(media.id, SentContent(msgId, media.contentKey, media.contentLocation));
+	}
 	queue.insert(msgId, File(media));
 	sendNext();
 }
 
+void FileUploader::mediaSent(const uint64 &mediaId, const MTPMessageMedia &media) {
+	SentContents::iterator i = contents.find(mediaId);
+	if (i == contents.end()) return;
+
+	if ((media.type() == mtpc_messageMediaPhoto && media.c_messageMediaPhoto().vphoto.type() == mtpc_photo) || (media.type() == mtpc_messageMediaDocument && media.c_messageMediaDocument().vdocument.type() == mtpc_document)) {
+		Local::writeSentMedia(i->key, i->location, i->md5, media);
+	}
+	contents.erase(i);
+}
+
 void FileUploader::currentFailed() {
 	Queue::iterator j = queue.find(uploading);
 	if (j != queue.end()) {
@@ -57,6 +72,7 @@ void FileUploader::currentFailed() {
 			}
 			emit documentFailed(j.key());
 		}
+		contents.remove(j->media.id);
 		queue.erase(j);
 	}
 
@@ -73,8 +89,14 @@ void FileUploader::currentFailed() {
 }
 
 void FileUploader::killSessions() {
-	for (int i = 0; i < MTPUploadSessionsCount; ++i) {
-		MTP::stopSession(MTP::upl[i]);
+	if (extraSessionsKilled) {
+		MTP::stopSession(MTP::upl[0]);
+	} else {
+		for (int i = 1; i < MTPUploadSessionsCount; ++i) {
+			MTP::stopSession(MTP::upl[i]);
+		}
+		extraSessionsKilled = true;
+		killSessionsTimer.start(MTPKeepFileSessionTimeout - MTPKillFileSessionTimeout);
 	}
 }
 
@@ -92,6 +114,8 @@ void FileUploader::sendNext() {
 	if (killing) {
 		killSessionsTimer.stop();
 	}
+	extraSessionsKilled = false;
+
 	Queue::iterator i = uploading ? queue.find(uploading) : queue.begin();
 	if (!uploading) {
 		uploading = i.key();
@@ -99,8 +123,9 @@ void FileUploader::sendNext() {
 		i = queue.begin(); 
 		uploading = i.key();
 	}
-	int todc = 0;
+	int todc = 0; // first not filled session or the least loaded one
 	for (int dc = 1; dc < MTPUploadSessionsCount; ++dc) {
+		if (sentSizes[todc] < MTPFileSessionFillSize) break;
 		if (sentSizes[dc] < sentSizes[todc]) {
 			todc = dc;
 		}
@@ -114,6 +139,11 @@ void FileUploader::sendNext() {
 					QByteArray docMd5(32, Qt::Uninitialized);
 					hashMd5Hex(i->docHash.result(), docMd5.data());
 
+					SentContents::iterator content = contents.find(i->media.id);
+					if (content != contents.end() && i->media.data.isEmpty()) { // full file hash is known now, it confirms reuse of a copy
+						content->md5 = QByteArray((const char*)i->docHash.result(), 16);
+					}
+
 					MTPInputFile doc = (i->docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename)) : MTP_inputFile(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename), MTP_string(docMd5));
 					if (i->partsCount) {
 						emit thumbDocumentReady(uploading, doc, MTP_inputFile(MTP_long(i->media.thumbId), MTP_int(i->partsCount), MTP_string(qsl("thumb.") + i->media.thumbExt), MTP_string(i->media.jpeg_md5)));
@@ -138,9 +168,7 @@ void FileUploader::sendNext() {
 				}
 			}
 			toSend = i->docFile->read(i->docPartSize);
-			if (i->docSize <= UseBigFilesFrom) {
-				i->docHash.feed(toSend.constData(), toSend.size());
-			}
+			i->docHash.feed(toSend.constData(), toSend.size()); // big files don't send md5, but it is remembered for sent media
 		} else {
 			toSend = i->media.data.mid(i->docSentParts * i->docPartSize, i->docPartSize);
 			if (i->media.type == ToPrepareDocument && i->docSentParts <= UseBigFilesFrom) {
@@ -178,6 +206,13 @@ void FileUploader::sendNext() {
 }
 
 void FileUploader::cancel(MsgId msgId) {
+	for (SentContents::iterator i = contents.begin(); i != contents.end();) {
+		if (i->msgId == msgId) {
+			i = contents.erase(i);
+		} else {
+			++i;
+		}
+	}
 	uploaded.remove(msgId);
 	if (uploading == msgId) {
 		currentFailed();
@@ -192,6 +227,7 @@ void FileUploader::confirm(MsgId msgId) {
 void FileUploader::clear() {
 	uploaded.clear();
 	queue.clear();
+	contents.clear();
 	for (QMap<mtpRequestId, QByteArray>::const_iterator i = requestsSent.cbegin(), e = requestsSent.cend(); i != e; ++i) {
 		MTP::cancel(i.key());
 	}
@@ -229,15 +265,20 @@ void FileUploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
 			dcMap.erase(dcIt);
 
 			Queue::const_iterator k = queue.constFind(uploading);
+			static MetricHandle filesUploadBytesMetric = metricCounter(qsl("files.upload_bytes"));
 			if (i != requestsSent.cend()) {
+				metricAdd(filesUploadBytesMetric, i.value().size());
 				sentSize -= i.value().size();
 				sentSizes[dc] -= i.value().size();
 				requestsSent.erase(i);
 			} else {
+				metricAdd(filesUploadBytesMetric, k->docPartSize);
 				sentSize -= k->docPartSize;
 				sentSizes[dc] -= k->docPartSize;
 				docRequestsSent.erase(j);
 			}
+			static MetricHandle filesUploadInFlightMetric = metricGauge(qsl("files.upload_in_flight"));
+			metricSet(filesUploadInFlightMetric, sentSize);
 			if (k->media.type == ToPreparePhoto) {
 				emit photoProgress(k.key());
 			} else if (k->media.type == ToPrepareDocument) {
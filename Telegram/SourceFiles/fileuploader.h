@@ -26,6 +26,7 @@ public:
 
 	FileUploader();
 	void uploadMedia(MsgId msgId, const ReadyLocalMedia &image);
+	void mediaSent(const uint64 &mediaId, const MTPMessageMedia &media); // remember server media for uploaded content
 
 	int32 currentOffset(MsgId msgId) const; // -1 means file not found
 	int32 fullSize(MsgId msgId) const;
@@ -106,6 +107,18 @@ private:
 	MsgId uploading;
 	Queue queue;
 	Queue uploaded;
+
+	struct SentContent {
+		SentContent(MsgId msgId, const MediaKey &key, const FileLocation &location) : msgId(msgId), key(key), location(location) {
+		}
+		MsgId msgId; // local message, its destroy before the server media is received cancels the content
+		MediaKey key;
+		FileLocation location;
+		QByteArray md5; // full md5 of uploaded file content
+	};
+	typedef QMap<uint64, SentContent> SentContents;
+	SentContents contents; // local media id -> content, until the server media is received
 	QTimer nextTimer, killSessionsTimer;
+	bool extraSessionsKilled; // first session is kept warm longer
 
 };
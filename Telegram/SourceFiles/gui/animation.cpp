@@ -102,6 +102,85 @@ namespace anim {
 
 }
 
+AnimationManager::AnimationManager() : timer(this), iterating(false), delta(AnimationTimerDelta), hiddenStepped(0), wakeupsStarted(0), wakeups(0) {
+	QScreen *screen = QGuiApplication::primaryScreen();
+	qreal rate = screen ? screen->refreshRate() : 0;
+	if (rate > 0 && int32(500 / rate) > delta) { // the timer is not synced to the display, so wake up twice a frame to never skip one
+		delta = int32(500 / rate);
+	}
+	timer.setSingleShot(false);
+	timer.setTimerType(Qt::PreciseTimer);
+	connect(&timer, SIGNAL(timeout()), this, SLOT(timeout()));
+}
+
+void AnimationManager::start(Animated *obj) {
+	obj->animReset();
+	obj->animWidget = dynamic_cast<QWidget*>(obj);
+	if (iterating) {
+		toStart.insert(obj);
+		if (!toStop.isEmpty()) {
+			toStop.remove(obj);
+		}
+	} else {
+		if (!objs.size()) {
+			timer.start(delta);
+			wakeupsStarted = getms(true);
+			wakeups = 0;
+		}
+		objs.insert(obj);
+	}
+	obj->animInProcess = true;
+}
+
+void AnimationManager::timeout() {
+	uint64 now = getms(true);
+	bool stepHidden = (now >= hiddenStepped + AnimationHiddenTimerDelta);
+	if (stepHidden) hiddenStepped = now;
+
+	iterating = true;
+	float64 ms = float64(getms());
+	for (AnimObjs::iterator i = objs.begin(), e = objs.end(); i != e; ) {
+		Animated *obj = *i;
+		if (!stepHidden && obj->animWidget && (!obj->animWidget->isVisible() || obj->animWidget->window()->isMinimized())) {
+			++i; // animations depend only on the elapsed time, so skipped steps are caught up later
+			continue;
+		}
+		if (!obj->animStep(ms - obj->animStarted)) {
+			i = objs.erase(i);
+			obj->animInProcess = false;
+		} else {
+			++i;
+		}
+	}
+	iterating = false;
+	if (!toStart.isEmpty()) {
+		for (AnimObjs::iterator i = toStart.begin(), e = toStart.end(); i != e; ++i) {
+			objs.insert(*i);
+		}
+		toStart.clear();
+	}
+	if (!toStop.isEmpty()) {
+		for (AnimObjs::iterator i = toStop.begin(), e = toStop.end(); i != e; ++i) {
+			objs.remove(*i);
+		}
+		toStop.clear();
+	}
+	if (!objs.size()) {
+		timer.stop();
+	}
+
+	uint64 finished = getms(true);
+	static MetricHandle animStepMsMetric = metricHistogram(qsl("anim.step_ms"));
+	metricSample(animStepMsMetric, finished - now);
+	++wakeups;
+	if (finished >= wakeupsStarted + 1000) {
+		static MetricHandle animWakeupsPerSecMetric = metricGauge(qsl("anim.wakeups_per_sec"));
+		metricSet(animWakeupsPerSecMetric, wakeups * 1000 / int64(finished - wakeupsStarted));
+		wakeupsStarted = finished;
+		wakeups = 0;
+	}
+}
+
 bool AnimatedGif::animStep(float64 ms) {
 	int32 f = frame;
 	while (f < frames.size() && ms > delays[f]) {
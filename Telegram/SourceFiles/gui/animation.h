@@ -21,6 +21,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include <QtCore/QTimer>
 #include <QtGui/QColor>
 
+class QWidget;
 class Animated;
 
 namespace anim {
@@ -196,7 +197,7 @@ namespace anim {
 class Animated {
 public:
 
-	Animated() : animStarted(0), animInProcess(false) {
+	Animated() : animStarted(0), animInProcess(false), animWidget(0) {
 	}
 
 	virtual bool animStep(float64 ms) = 0;
@@ -219,6 +220,7 @@ private:
 
 	float64 animStarted;
 	bool animInProcess;
+	QWidget *animWidget; // set when the animated object is a widget, it is throttled while hidden
 	friend class AnimationManager;
 
 };
@@ -228,26 +230,9 @@ Q_OBJECT
 
 public:
 
-	AnimationManager() : timer(this), iterating(false) {
-		timer.setSingleShot(false);
-		connect(&timer, SIGNAL(timeout()), this, SLOT(timeout()));
-	}
+	AnimationManager();
 
-	void start(Animated *obj) {
-		obj->animReset();
-		if (iterating) {
-			toStart.insert(obj);
-			if (!toStop.isEmpty()) {
-				toStop.remove(obj);
-			}
-		} else {
-			if (!objs.size()) {
-				timer.start(AnimationTimerDelta);
-			}
-			objs.insert(obj);
-		}
-		obj->animInProcess = true;
-	}
+	void start(Animated *obj);
 
 	void step(Animated *obj) {
 		if (iterating) return;
@@ -285,35 +270,7 @@ public:
 	}
 
 public slots:
-	void timeout() {
-		iterating = true;
-		float64 ms = float64(getms());
-		for (AnimObjs::iterator i = objs.begin(), e = objs.end(); i != e; ) {
-			Animated *obj = *i;
-			if (!obj->animStep(ms - obj->animStarted)) {
-				i = objs.erase(i);
-				obj->animInProcess = false;
-			} else {
-				++i;
-			}
-		}
-		iterating = false;
-		if (!toStart.isEmpty()) {
-			for (AnimObjs::iterator i = toStart.begin(), e = toStart.end(); i != e; ++i) {
-				objs.insert(*i);
-			}
-			toStart.clear();
-		}
-		if (!toStop.isEmpty()) {
-			for (AnimObjs::iterator i = toStop.begin(), e = toStop.end(); i != e; ++i) {
-				objs.remove(*i);
-			}
-			toStop.clear();
-		}
-		if (!objs.size()) {
-			timer.stop();
-		}
-	}
+	void timeout();
 
 private:
 
@@ -324,6 +281,11 @@ private:
 	QTimer timer;
 	bool iterating;
 
+	int32 delta; // timer interval, one display frame but not less than AnimationTimerDelta
+	uint64 hiddenStepped; // last time animations of hidden widgets were stepped
+	uint64 wakeupsStarted;
+	int32 wakeups; // timer wakeups counted for the anim.wakeups_per_sec metric
+
 };
 
 class HistoryItem;
@@ -3438,882 +3438,100 @@ void initEmoji() {
 	};
 };
 
+namespace {
+	// perfect hash of the emoji codes, see getEmoji()
+	const uint16 emojisHashDisplace[256] = {
+		0, 0, 0, 9, 0, 0, 1, 2, 4, 0, 1, 0, 3, 4, 0, 0,
+		8, 4, 0, 0, 2, 0, 15, 0, 4, 1, 0, 6, 0, 4, 0, 0,
+		10, 14, 2, 1, 9, 20, 18, 0, 0, 1, 0, 0, 0, 15, 3, 1,
+		0, 6, 4, 0, 0, 0, 5, 15, 1, 0, 21, 4, 0, 7, 0, 2,
+		0, 0, 1, 2, 2, 0, 1, 0, 0, 0, 0, 0, 0, 14, 0, 7,
+		0, 0, 0, 3, 12, 0, 0, 0, 0, 1, 12, 2, 7, 10, 0, 9,
+		2, 0, 10, 0, 16, 8, 0, 3, 0, 10, 0, 8, 0, 20, 0, 0,
+		0, 11, 7, 4, 1, 0, 2, 3, 0, 4, 7, 1, 8, 6, 4, 57,
+		2, 0, 3, 26, 0, 7, 56, 33, 0, 1, 11, 1, 0, 57, 2, 14,
+		2, 3, 0, 9, 67, 15, 0, 1, 1, 8, 20, 4, 1, 2, 5, 0,
+		0, 3, 2, 2, 28, 2, 1, 0, 3, 1, 5, 23, 23, 32, 6, 22,
+		59, 0, 1, 3, 21, 0, 1, 7, 0, 12, 2, 6, 0, 3, 17, 14,
+		4, 18, 33, 3, 82, 9, 18, 16, 93, 12, 5, 170, 18, 2, 4, 2,
+		0, 0, 1, 0, 18, 0, 15, 0, 39, 6, 0, 211, 18, 10, 9, 19,
+		1, 10, 15, 2, 1, 1, 12, 6, 2, 1, 1, 16, 0, 3, 3, 10,
+		50, 11, 54, 14, 2, 72, 6, 56, 0, 18, 16, 35, 3, 4, 4, 166
+	};
+	const uint16 emojisHashSlots[1024] = { // emoji index + 1, 0 for empty slots
+		32, 567, 0, 502, 308, 0, 237, 525, 351, 0, 460, 24, 418, 188, 822, 481,
+		167, 0, 299, 546, 628, 723, 0, 0, 2, 0, 744, 801, 216, 0, 675, 0,
+		397, 331, 0, 353, 590, 504, 258, 651, 780, 0, 0, 439, 0, 845, 116, 376,
+		260, 169, 569, 310, 746, 702, 630, 0, 190, 677, 67, 420, 483, 824, 155, 239,
+		609, 548, 704, 0, 0, 378, 0, 218, 725, 399, 0, 803, 91, 117, 462, 113,
+		0, 280, 527, 592, 333, 0, 765, 653, 441, 0, 0, 782, 0, 0, 506, 262,
+		748, 0, 632, 571, 78, 312, 0, 355, 0, 0, 192, 826, 679, 485, 241, 0,
+		550, 727, 0, 0, 0, 464, 0, 611, 401, 171, 220, 72, 115, 805, 89, 529,
+		282, 17, 706, 380, 594, 136, 124, 655, 147, 767, 443, 784, 0, 264, 508, 0,
+		314, 335, 573, 634, 243, 750, 102, 531, 681, 194, 357, 828, 359, 554, 487, 80,
+		552, 708, 729, 382, 222, 0, 284, 403, 173, 598, 73, 466, 0, 0, 807, 38,
+		138, 19, 0, 0, 657, 119, 613, 769, 786, 5, 445, 266, 0, 510, 596, 0,
+		41, 0, 82, 133, 316, 361, 0, 683, 424, 830, 0, 196, 752, 489, 0, 245,
+		0, 575, 533, 577, 636, 0, 731, 809, 468, 175, 6, 224, 405, 149, 0, 286,
+		710, 615, 107, 52, 140, 61, 384, 659, 0, 491, 204, 447, 268, 338, 512, 98,
+		43, 318, 754, 638, 685, 788, 771, 0, 198, 157, 832, 426, 363, 0, 556, 247,
+		407, 733, 617, 111, 0, 0, 177, 0, 811, 288, 470, 449, 535, 109, 0, 226,
+		579, 142, 340, 773, 661, 600, 386, 790, 0, 206, 712, 367, 514, 0, 45, 270,
+		320, 0, 756, 640, 687, 26, 428, 0, 200, 558, 834, 249, 128, 0, 493, 365,
+		0, 342, 0, 735, 152, 179, 472, 409, 813, 290, 228, 619, 0, 537, 714, 22,
+		602, 14, 144, 775, 689, 583, 0, 322, 451, 34, 208, 516, 114, 792, 581, 47,
+		84, 758, 642, 94, 495, 539, 202, 663, 430, 560, 836, 0, 251, 8, 301, 39,
+		737, 57, 230, 621, 815, 411, 181, 0, 344, 75, 123, 474, 292, 478, 55, 716,
+		794, 0, 16, 665, 390, 272, 388, 453, 604, 160, 518, 0, 274, 324, 49, 695,
+		28, 691, 497, 0, 369, 0, 432, 0, 10, 232, 564, 85, 562, 303, 132, 100,
+		346, 183, 294, 644, 413, 65, 476, 817, 253, 605, 162, 838, 56, 541, 718, 623,
+		760, 434, 667, 392, 796, 1, 70, 326, 0, 0, 499, 276, 697, 51, 585, 96,
+		646, 0, 371, 741, 693, 211, 739, 840, 520, 30, 97, 86, 12, 305, 255, 625,
+		348, 234, 63, 672, 415, 185, 0, 607, 819, 164, 129, 543, 58, 296, 699, 720,
+		394, 0, 669, 674, 798, 0, 457, 213, 36, 0, 278, 0, 587, 522, 328, 764,
+		648, 417, 762, 777, 373, 455, 842, 0, 501, 0, 566, 436, 307, 627, 0, 743,
+		350, 0, 480, 112, 187, 821, 106, 166, 236, 0, 545, 298, 257, 722, 90, 154,
+		0, 459, 0, 701, 800, 127, 215, 0, 396, 524, 0, 0, 589, 0, 0, 330,
+		650, 0, 27, 568, 438, 503, 375, 33, 779, 844, 0, 259, 745, 352, 309, 629,
+		25, 676, 66, 189, 482, 0, 419, 0, 168, 547, 0, 0, 724, 0, 77, 238,
+		823, 398, 122, 802, 461, 703, 217, 0, 0, 591, 526, 652, 332, 0, 135, 0,
+		781, 377, 0, 0, 440, 0, 505, 0, 0, 747, 570, 261, 170, 0, 631, 354,
+		339, 678, 421, 191, 825, 484, 240, 0, 311, 0, 610, 726, 463, 0, 0, 0,
+		0, 0, 593, 334, 0, 467, 528, 88, 0, 281, 0, 705, 400, 379, 766, 654,
+		804, 71, 442, 0, 219, 633, 507, 0, 572, 549, 749, 783, 313, 263, 356, 0,
+		680, 0, 422, 827, 221, 0, 486, 0, 0, 551, 283, 707, 612, 79, 193, 728,
+		465, 402, 130, 146, 751, 172, 806, 23, 18, 137, 317, 336, 595, 530, 656, 381,
+		785, 0, 4, 574, 488, 553, 265, 509, 0, 0, 315, 768, 635, 358, 360, 40,
+		682, 81, 195, 244, 423, 829, 0, 92, 0, 0, 599, 614, 0, 0, 730, 404,
+		174, 808, 0, 148, 0, 337, 532, 285, 20, 709, 597, 223, 139, 60, 242, 770,
+		126, 446, 576, 511, 0, 362, 267, 658, 42, 134, 0, 753, 787, 637, 0, 684,
+		197, 425, 831, 156, 246, 93, 490, 0, 616, 383, 732, 110, 0, 555, 406, 0,
+		176, 150, 469, 810, 772, 534, 287, 225, 660, 141, 711, 108, 0, 385, 789, 444,
+		578, 448, 639, 0, 0, 686, 205, 269, 44, 319, 755, 0, 364, 121, 427, 68,
+		513, 248, 83, 0, 199, 0, 557, 492, 0, 227, 757, 734, 0, 0, 408, 178,
+		53, 471, 0, 159, 812, 429, 151, 21, 601, 713, 143, 774, 387, 341, 791, 662,
+		74, 207, 515, 158, 289, 0, 450, 46, 580, 536, 641, 366, 321, 688, 271, 13,
+		7, 835, 201, 0, 473, 250, 48, 300, 343, 736, 180, 620, 833, 410, 814, 153,
+		715, 291, 229, 329, 494, 538, 793, 203, 54, 145, 15, 664, 603, 452, 389, 104,
+		431, 496, 87, 368, 273, 131, 582, 323, 759, 0, 643, 209, 0, 690, 0, 517,
+		837, 302, 3, 252, 412, 561, 31, 0, 345, 99, 622, 738, 64, 182, 95, 816,
+		540, 231, 0, 0, 717, 293, 161, 696, 306, 454, 666, 475, 761, 795, 391, 0,
+		519, 35, 118, 210, 0, 559, 584, 50, 645, 59, 370, 839, 69, 692, 433, 275,
+		477, 498, 29, 0, 11, 304, 9, 740, 563, 347, 624, 254, 414, 184, 125, 325,
+		618, 606, 542, 163, 818, 101, 719, 295, 233, 393, 62, 668, 671, 797, 456, 212,
+		500, 698, 763, 277, 586, 327, 0, 608, 76, 776, 372, 521, 435, 841, 694, 647,
+		256, 0, 0, 820, 0, 742, 565, 626, 120, 673, 349, 416, 186, 105, 0, 479,
+		0, 297, 544, 235, 588, 799, 0, 165, 395, 0, 670, 0, 0, 458, 214, 0,
+		0, 721, 279, 700, 37, 523, 649, 103, 843, 374, 0, 0, 437, 0, 778, 0
+	};
+}
+
 const EmojiData *getEmoji(uint32 code) {
 	if (!emojis) return 0;
 
-	uint32 highCode = code >> 16;
-	if (!highCode) {
-		switch (code) {
-			case 0xA9U: return &emojis[0];
-			case 0xAEU: return &emojis[1];
-		}
-
-		if (code < 0x203CU || code > 0x3299U) return 0;
-
-		switch (code) {
-			case 0x203CU: return &emojis[2];
-			case 0x2049U: return &emojis[3];
-			case 0x2122U: return &emojis[4];
-			case 0x2139U: return &emojis[5];
-			case 0x2194U: return &emojis[6];
-			case 0x2195U: return &emojis[7];
-			case 0x2196U: return &emojis[8];
-			case 0x2197U: return &emojis[9];
-			case 0x2198U: return &emojis[10];
-			case 0x2199U: return &emojis[11];
-			case 0x21A9U: return &emojis[12];
-			case 0x21AAU: return &emojis[13];
-			case 0x231AU: return &emojis[14];
-			case 0x231BU: return &emojis[15];
-			case 0x23E9U: return &emojis[16];
-			case 0x23EAU: return &emojis[17];
-			case 0x23EBU: return &emojis[18];
-			case 0x23ECU: return &emojis[19];
-			case 0x23F0U: return &emojis[20];
-			case 0x23F3U: return &emojis[21];
-			case 0x24C2U: return &emojis[22];
-			case 0x25AAU: return &emojis[23];
-			case 0x25ABU: return &emojis[24];
-			case 0x25B6U: return &emojis[25];
-			case 0x25C0U: return &emojis[26];
-			case 0x25FBU: return &emojis[27];
-			case 0x25FCU: return &emojis[28];
-			case 0x25FDU: return &emojis[29];
-			case 0x25FEU: return &emojis[30];
-			case 0x2600U: return &emojis[31];
-			case 0x2601U: return &emojis[32];
-			case 0x260EU: return &emojis[33];
-			case 0x2611U: return &emojis[34];
-			case 0x2614U: return &emojis[35];
-			case 0x2615U: return &emojis[36];
-			case 0x261DU: return &emojis[37];
-			case 0x263AU: return &emojis[38];
-			case 0x2648U: return &emojis[39];
-			case 0x2649U: return &emojis[40];
-			case 0x264AU: return &emojis[41];
-			case 0x264BU: return &emojis[42];
-			case 0x264CU: return &emojis[43];
-			case 0x264DU: return &emojis[44];
-			case 0x264EU: return &emojis[45];
-			case 0x264FU: return &emojis[46];
-			case 0x2650U: return &emojis[47];
-			case 0x2651U: return &emojis[48];
-			case 0x2652U: return &emojis[49];
-			case 0x2653U: return &emojis[50];
-			case 0x2660U: return &emojis[51];
-			case 0x2663U: return &emojis[52];
-			case 0x2665U: return &emojis[53];
-			case 0x2666U: return &emojis[54];
-			case 0x2668U: return &emojis[55];
-			case 0x267BU: return &emojis[56];
-			case 0x267FU: return &emojis[57];
-			case 0x2693U: return &emojis[58];
-			case 0x26A0U: return &emojis[59];
-			case 0x26A1U: return &emojis[60];
-			case 0x26AAU: return &emojis[61];
-			case 0x26ABU: return &emojis[62];
-			case 0x26BDU: return &emojis[63];
-			case 0x26BEU: return &emojis[64];
-			case 0x26C4U: return &emojis[65];
-			case 0x26C5U: return &emojis[66];
-			case 0x26CEU: return &emojis[67];
-			case 0x26D4U: return &emojis[68];
-			case 0x26EAU: return &emojis[69];
-			case 0x26F2U: return &emojis[70];
-			case 0x26F3U: return &emojis[71];
-			case 0x26F5U: return &emojis[72];
-			case 0x26FAU: return &emojis[73];
-			case 0x26FDU: return &emojis[74];
-			case 0x2702U: return &emojis[75];
-			case 0x2705U: return &emojis[76];
-			case 0x2708U: return &emojis[77];
-			case 0x2709U: return &emojis[78];
-			case 0x270AU: return &emojis[79];
-			case 0x270BU: return &emojis[80];
-			case 0x270CU: return &emojis[81];
-			case 0x270FU: return &emojis[82];
-			case 0x2712U: return &emojis[83];
-			case 0x2714U: return &emojis[84];
-			case 0x2716U: return &emojis[85];
-			case 0x2728U: return &emojis[86];
-			case 0x2733U: return &emojis[87];
-			case 0x2734U: return &emojis[88];
-			case 0x2744U: return &emojis[89];
-			case 0x2747U: return &emojis[90];
-			case 0x274CU: return &emojis[91];
-			case 0x274EU: return &emojis[92];
-			case 0x2753U: return &emojis[93];
-			case 0x2754U: return &emojis[94];
-			case 0x2755U: return &emojis[95];
-			case 0x2757U: return &emojis[96];
-			case 0x2764U: return &emojis[97];
-			case 0x2795U: return &emojis[98];
-			case 0x2796U: return &emojis[99];
-			case 0x2797U: return &emojis[100];
-			case 0x27A1U: return &emojis[101];
-			case 0x27B0U: return &emojis[102];
-			case 0x27BFU: return &emojis[103];
-			case 0x2934U: return &emojis[104];
-			case 0x2935U: return &emojis[105];
-			case 0x2B05U: return &emojis[106];
-			case 0x2B06U: return &emojis[107];
-			case 0x2B07U: return &emojis[108];
-			case 0x2B1BU: return &emojis[109];
-			case 0x2B1CU: return &emojis[110];
-			case 0x2B50U: return &emojis[111];
-			case 0x2B55U: return &emojis[112];
-			case 0x3030U: return &emojis[113];
-			case 0x303DU: return &emojis[114];
-			case 0x3297U: return &emojis[115];
-			case 0x3299U: return &emojis[116];
-		}
-
-		return 0;
-	}
-
-	if (highCode == 35 || (highCode >= 48 && highCode < 58)) {
-		if ((code & 0xFFFFU) != 0x20E3U) return 0;
-
-		switch (code) {
-			case 0x2320E3U: return &emojis[117];
-			case 0x3020E3U: return &emojis[118];
-			case 0x3120E3U: return &emojis[119];
-			case 0x3220E3U: return &emojis[120];
-			case 0x3320E3U: return &emojis[121];
-			case 0x3420E3U: return &emojis[122];
-			case 0x3520E3U: return &emojis[123];
-			case 0x3620E3U: return &emojis[124];
-			case 0x3720E3U: return &emojis[125];
-			case 0x3820E3U: return &emojis[126];
-			case 0x3920E3U: return &emojis[127];
-		}
-
-		return 0;
-	}
-
-	if (code < 0xD83CDC04U || code > 0xD83DDEC5U) return 0;
-
-	switch (code) {
-	case 0xD83CDC04U: return &emojis[128];
-	case 0xD83CDCCFU: return &emojis[129];
-	case 0xD83CDD70U: return &emojis[130];
-	case 0xD83CDD71U: return &emojis[131];
-	case 0xD83CDD7EU: return &emojis[132];
-	case 0xD83CDD7FU: return &emojis[133];
-	case 0xD83CDD8EU: return &emojis[134];
-	case 0xD83CDD91U: return &emojis[135];
-	case 0xD83CDD92U: return &emojis[136];
-	case 0xD83CDD93U: return &emojis[137];
-	case 0xD83CDD94U: return &emojis[138];
-	case 0xD83CDD95U: return &emojis[139];
-	case 0xD83CDD96U: return &emojis[140];
-	case 0xD83CDD97U: return &emojis[141];
-	case 0xD83CDD98U: return &emojis[142];
-	case 0xD83CDD99U: return &emojis[143];
-	case 0xD83CDD9AU: return &emojis[144];
-	case 0xD83CDDE8U: return &emojis[145];
-	case 0xD83CDDE9U: return &emojis[146];
-	case 0xD83CDDEAU: return &emojis[147];
-	case 0xD83CDDEBU: return &emojis[148];
-	case 0xD83CDDECU: return &emojis[149];
-	case 0xD83CDDEEU: return &emojis[150];
-	case 0xD83CDDEFU: return &emojis[151];
-	case 0xD83CDDF0U: return &emojis[152];
-	case 0xD83CDDF7U: return &emojis[153];
-	case 0xD83CDDFAU: return &emojis[154];
-	case 0xD83CDE01U: return &emojis[155];
-	case 0xD83CDE02U: return &emojis[156];
-	case 0xD83CDE1AU: return &emojis[157];
-	case 0xD83CDE2FU: return &emojis[158];
-	case 0xD83CDE32U: return &emojis[159];
-	case 0xD83CDE33U: return &emojis[160];
-	case 0xD83CDE34U: return &emojis[161];
-	case 0xD83CDE35U: return &emojis[162];
-	case 0xD83CDE36U: return &emojis[163];
-	case 0xD83CDE37U: return &emojis[164];
-	case 0xD83CDE38U: return &emojis[165];
-	case 0xD83CDE39U: return &emojis[166];
-	case 0xD83CDE3AU: return &emojis[167];
-	case 0xD83CDE50U: return &emojis[168];
-	case 0xD83CDE51U: return &emojis[169];
-	case 0xD83CDF00U: return &emojis[170];
-	case 0xD83CDF01U: return &emojis[171];
-	case 0xD83CDF02U: return &emojis[172];
-	case 0xD83CDF03U: return &emojis[173];
-	case 0xD83CDF04U: return &emojis[174];
-	case 0xD83CDF05U: return &emojis[175];
-	case 0xD83CDF06U: return &emojis[176];
-	case 0xD83CDF07U: return &emojis[177];
-	case 0xD83CDF08U: return &emojis[178];
-	case 0xD83CDF09U: return &emojis[179];
-	case 0xD83CDF0AU: return &emojis[180];
-	case 0xD83CDF0BU: return &emojis[181];
-	case 0xD83CDF0CU: return &emojis[182];
-	case 0xD83CDF0DU: return &emojis[183];
-	case 0xD83CDF0EU: return &emojis[184];
-	case 0xD83CDF0FU: return &emojis[185];
-	case 0xD83CDF10U: return &emojis[186];
-	case 0xD83CDF11U: return &emojis[187];
-	case 0xD83CDF12U: return &emojis[188];
-	case 0xD83CDF13U: return &emojis[189];
-	case 0xD83CDF14U: return &emojis[190];
-	case 0xD83CDF15U: return &emojis[191];
-	case 0xD83CDF16U: return &emojis[192];
-	case 0xD83CDF17U: return &emojis[193];
-	case 0xD83CDF18U: return &emojis[194];
-	case 0xD83CDF19U: return &emojis[195];
-	case 0xD83CDF1AU: return &emojis[196];
-	case 0xD83CDF1BU: return &emojis[197];
-	case 0xD83CDF1CU: return &emojis[198];
-	case 0xD83CDF1DU: return &emojis[199];
-	case 0xD83CDF1EU: return &emojis[200];
-	case 0xD83CDF1FU: return &emojis[201];
-	case 0xD83CDF20U: return &emojis[202];
-	case 0xD83CDF30U: return &emojis[203];
-	case 0xD83CDF31U: return &emojis[204];
-	case 0xD83CDF32U: return &emojis[205];
-	case 0xD83CDF33U: return &emojis[206];
-	case 0xD83CDF34U: return &emojis[207];
-	case 0xD83CDF35U: return &emojis[208];
-	case 0xD83CDF37U: return &emojis[209];
-	case 0xD83CDF38U: return &emojis[210];
-	case 0xD83CDF39U: return &emojis[211];
-	case 0xD83CDF3AU: return &emojis[212];
-	case 0xD83CDF3BU: return &emojis[213];
-	case 0xD83CDF3CU: return &emojis[214];
-	case 0xD83CDF3DU: return &emojis[215];
-	case 0xD83CDF3EU: return &emojis[216];
-	case 0xD83CDF3FU: return &emojis[217];
-	case 0xD83CDF40U: return &emojis[218];
-	case 0xD83CDF41U: return &emojis[219];
-	case 0xD83CDF42U: return &emojis[220];
-	case 0xD83CDF43U: return &emojis[221];
-	case 0xD83CDF44U: return &emojis[222];
-	case 0xD83CDF45U: return &emojis[223];
-	case 0xD83CDF46U: return &emojis[224];
-	case 0xD83CDF47U: return &emojis[225];
-	case 0xD83CDF48U: return &emojis[226];
-	case 0xD83CDF49U: return &emojis[227];
-	case 0xD83CDF4AU: return &emojis[228];
-	case 0xD83CDF4BU: return &emojis[229];
-	case 0xD83CDF4CU: return &emojis[230];
-	case 0xD83CDF4DU: return &emojis[231];
-	case 0xD83CDF4EU: return &emojis[232];
-	case 0xD83CDF4FU: return &emojis[233];
-	case 0xD83CDF50U: return &emojis[234];
-	case 0xD83CDF51U: return &emojis[235];
-	case 0xD83CDF52U: return &emojis[236];
-	case 0xD83CDF53U: return &emojis[237];
-	case 0xD83CDF54U: return &emojis[238];
-	case 0xD83CDF55U: return &emojis[239];
-	case 0xD83CDF56U: return &emojis[240];
-	case 0xD83CDF57U: return &emojis[241];
-	case 0xD83CDF58U: return &emojis[242];
-	case 0xD83CDF59U: return &emojis[243];
-	case 0xD83CDF5AU: return &emojis[244];
-	case 0xD83CDF5BU: return &emojis[245];
-	case 0xD83CDF5CU: return &emojis[246];
-	case 0xD83CDF5DU: return &emojis[247];
-	case 0xD83CDF5EU: return &emojis[248];
-	case 0xD83CDF5FU: return &emojis[249];
-	case 0xD83CDF60U: return &emojis[250];
-	case 0xD83CDF61U: return &emojis[251];
-	case 0xD83CDF62U: return &emojis[252];
-	case 0xD83CDF63U: return &emojis[253];
-	case 0xD83CDF64U: return &emojis[254];
-	case 0xD83CDF65U: return &emojis[255];
-	case 0xD83CDF66U: return &emojis[256];
-	case 0xD83CDF67U: return &emojis[257];
-	case 0xD83CDF68U: return &emojis[258];
-	case 0xD83CDF69U: return &emojis[259];
-	case 0xD83CDF6AU: return &emojis[260];
-	case 0xD83CDF6BU: return &emojis[261];
-	case 0xD83CDF6CU: return &emojis[262];
-	case 0xD83CDF6DU: return &emojis[263];
-	case 0xD83CDF6EU: return &emojis[264];
-	case 0xD83CDF6FU: return &emojis[265];
-	case 0xD83CDF70U: return &emojis[266];
-	case 0xD83CDF71U: return &emojis[267];
-	case 0xD83CDF72U: return &emojis[268];
-	case 0xD83CDF73U: return &emojis[269];
-	case 0xD83CDF74U: return &emojis[270];
-	case 0xD83CDF75U: return &emojis[271];
-	case 0xD83CDF76U: return &emojis[272];
-	case 0xD83CDF77U: return &emojis[273];
-	case 0xD83CDF78U: return &emojis[274];
-	case 0xD83CDF79U: return &emojis[275];
-	case 0xD83CDF7AU: return &emojis[276];
-	case 0xD83CDF7BU: return &emojis[277];
-	case 0xD83CDF7CU: return &emojis[278];
-	case 0xD83CDF80U: return &emojis[279];
-	case 0xD83CDF81U: return &emojis[280];
-	case 0xD83CDF82U: return &emojis[281];
-	case 0xD83CDF83U: return &emojis[282];
-	case 0xD83CDF84U: return &emojis[283];
-	case 0xD83CDF85U: return &emojis[284];
-	case 0xD83CDF86U: return &emojis[285];
-	case 0xD83CDF87U: return &emojis[286];
-	case 0xD83CDF88U: return &emojis[287];
-	case 0xD83CDF89U: return &emojis[288];
-	case 0xD83CDF8AU: return &emojis[289];
-	case 0xD83CDF8BU: return &emojis[290];
-	case 0xD83CDF8CU: return &emojis[291];
-	case 0xD83CDF8DU: return &emojis[292];
-	case 0xD83CDF8EU: return &emojis[293];
-	case 0xD83CDF8FU: return &emojis[294];
-	case 0xD83CDF90U: return &emojis[295];
-	case 0xD83CDF91U: return &emojis[296];
-	case 0xD83CDF92U: return &emojis[297];
-	case 0xD83CDF93U: return &emojis[298];
-	case 0xD83CDFA0U: return &emojis[299];
-	case 0xD83CDFA1U: return &emojis[300];
-	case 0xD83CDFA2U: return &emojis[301];
-	case 0xD83CDFA3U: return &emojis[302];
-	case 0xD83CDFA4U: return &emojis[303];
-	case 0xD83CDFA5U: return &emojis[304];
-	case 0xD83CDFA6U: return &emojis[305];
-	case 0xD83CDFA7U: return &emojis[306];
-	case 0xD83CDFA8U: return &emojis[307];
-	case 0xD83CDFA9U: return &emojis[308];
-	case 0xD83CDFAAU: return &emojis[309];
-	case 0xD83CDFABU: return &emojis[310];
-	case 0xD83CDFACU: return &emojis[311];
-	case 0xD83CDFADU: return &emojis[312];
-	case 0xD83CDFAEU: return &emojis[313];
-	case 0xD83CDFAFU: return &emojis[314];
-	case 0xD83CDFB0U: return &emojis[315];
-	case 0xD83CDFB1U: return &emojis[316];
-	case 0xD83CDFB2U: return &emojis[317];
-	case 0xD83CDFB3U: return &emojis[318];
-	case 0xD83CDFB4U: return &emojis[319];
-	case 0xD83CDFB5U: return &emojis[320];
-	case 0xD83CDFB6U: return &emojis[321];
-	case 0xD83CDFB7U: return &emojis[322];
-	case 0xD83CDFB8U: return &emojis[323];
-	case 0xD83CDFB9U: return &emojis[324];
-	case 0xD83CDFBAU: return &emojis[325];
-	case 0xD83CDFBBU: return &emojis[326];
-	case 0xD83CDFBCU: return &emojis[327];
-	case 0xD83CDFBDU: return &emojis[328];
-	case 0xD83CDFBEU: return &emojis[329];
-	case 0xD83CDFBFU: return &emojis[330];
-	case 0xD83CDFC0U: return &emojis[331];
-	case 0xD83CDFC1U: return &emojis[332];
-	case 0xD83CDFC2U: return &emojis[333];
-	case 0xD83CDFC3U: return &emojis[334];
-	case 0xD83CDFC4U: return &emojis[335];
-	case 0xD83CDFC6U: return &emojis[336];
-	case 0xD83CDFC7U: return &emojis[337];
-	case 0xD83CDFC8U: return &emojis[338];
-	case 0xD83CDFC9U: return &emojis[339];
-	case 0xD83CDFCAU: return &emojis[340];
-	case 0xD83CDFE0U: return &emojis[341];
-	case 0xD83CDFE1U: return &emojis[342];
-	case 0xD83CDFE2U: return &emojis[343];
-	case 0xD83CDFE3U: return &emojis[344];
-	case 0xD83CDFE4U: return &emojis[345];
-	case 0xD83CDFE5U: return &emojis[346];
-	case 0xD83CDFE6U: return &emojis[347];
-	case 0xD83CDFE7U: return &emojis[348];
-	case 0xD83CDFE8U: return &emojis[349];
-	case 0xD83CDFE9U: return &emojis[350];
-	case 0xD83CDFEAU: return &emojis[351];
-	case 0xD83CDFEBU: return &emojis[352];
-	case 0xD83CDFECU: return &emojis[353];
-	case 0xD83CDFEDU: return &emojis[354];
-	case 0xD83CDFEEU: return &emojis[355];
-	case 0xD83CDFEFU: return &emojis[356];
-	case 0xD83CDFF0U: return &emojis[357];
-	case 0xD83DDC00U: return &emojis[358];
-	case 0xD83DDC01U: return &emojis[359];
-	case 0xD83DDC02U: return &emojis[360];
-	case 0xD83DDC03U: return &emojis[361];
-	case 0xD83DDC04U: return &emojis[362];
-	case 0xD83DDC05U: return &emojis[363];
-	case 0xD83DDC06U: return &emojis[364];
-	case 0xD83DDC07U: return &emojis[365];
-	case 0xD83DDC08U: return &emojis[366];
-	case 0xD83DDC09U: return &emojis[367];
-	case 0xD83DDC0AU: return &emojis[368];
-	case 0xD83DDC0BU: return &emojis[369];
-	case 0xD83DDC0CU: return &emojis[370];
-	case 0xD83DDC0DU: return &emojis[371];
-	case 0xD83DDC0EU: return &emojis[372];
-	case 0xD83DDC0FU: return &emojis[373];
-	case 0xD83DDC10U: return &emojis[374];
-	case 0xD83DDC11U: return &emojis[375];
-	case 0xD83DDC12U: return &emojis[376];
-	case 0xD83DDC13U: return &emojis[377];
-	case 0xD83DDC14U: return &emojis[378];
-	case 0xD83DDC15U: return &emojis[379];
-	case 0xD83DDC16U: return &emojis[380];
-	case 0xD83DDC17U: return &emojis[381];
-	case 0xD83DDC18U: return &emojis[382];
-	case 0xD83DDC19U: return &emojis[383];
-	case 0xD83DDC1AU: return &emojis[384];
-	case 0xD83DDC1BU: return &emojis[385];
-	case 0xD83DDC1CU: return &emojis[386];
-	case 0xD83DDC1DU: return &emojis[387];
-	case 0xD83DDC1EU: return &emojis[388];
-	case 0xD83DDC1FU: return &emojis[389];
-	case 0xD83DDC20U: return &emojis[390];
-	case 0xD83DDC21U: return &emojis[391];
-	case 0xD83DDC22U: return &emojis[392];
-	case 0xD83DDC23U: return &emojis[393];
-	case 0xD83DDC24U: return &emojis[394];
-	case 0xD83DDC25U: return &emojis[395];
-	case 0xD83DDC26U: return &emojis[396];
-	case 0xD83DDC27U: return &emojis[397];
-	case 0xD83DDC28U: return &emojis[398];
-	case 0xD83DDC29U: return &emojis[399];
-	case 0xD83DDC2AU: return &emojis[400];
-	case 0xD83DDC2BU: return &emojis[401];
-	case 0xD83DDC2CU: return &emojis[402];
-	case 0xD83DDC2DU: return &emojis[403];
-	case 0xD83DDC2EU: return &emojis[404];
-	case 0xD83DDC2FU: return &emojis[405];
-	case 0xD83DDC30U: return &emojis[406];
-	case 0xD83DDC31U: return &emojis[407];
-	case 0xD83DDC32U: return &emojis[408];
-	case 0xD83DDC33U: return &emojis[409];
-	case 0xD83DDC34U: return &emojis[410];
-	case 0xD83DDC35U: return &emojis[411];
-	case 0xD83DDC36U: return &emojis[412];
-	case 0xD83DDC37U: return &emojis[413];
-	case 0xD83DDC38U: return &emojis[414];
-	case 0xD83DDC39U: return &emojis[415];
-	case 0xD83DDC3AU: return &emojis[416];
-	case 0xD83DDC3BU: return &emojis[417];
-	case 0xD83DDC3CU: return &emojis[418];
-	case 0xD83DDC3DU: return &emojis[419];
-	case 0xD83DDC3EU: return &emojis[420];
-	case 0xD83DDC40U: return &emojis[421];
-	case 0xD83DDC42U: return &emojis[422];
-	case 0xD83DDC43U: return &emojis[423];
-	case 0xD83DDC44U: return &emojis[424];
-	case 0xD83DDC45U: return &emojis[425];
-	case 0xD83DDC46U: return &emojis[426];
-	case 0xD83DDC47U: return &emojis[427];
-	case 0xD83DDC48U: return &emojis[428];
-	case 0xD83DDC49U: return &emojis[429];
-	case 0xD83DDC4AU: return &emojis[430];
-	case 0xD83DDC4BU: return &emojis[431];
-	case 0xD83DDC4CU: return &emojis[432];
-	case 0xD83DDC4DU: return &emojis[433];
-	case 0xD83DDC4EU: return &emojis[434];
-	case 0xD83DDC4FU: return &emojis[435];
-	case 0xD83DDC50U: return &emojis[436];
-	case 0xD83DDC51U: return &emojis[437];
-	case 0xD83DDC52U: return &emojis[438];
-	case 0xD83DDC53U: return &emojis[439];
-	case 0xD83DDC54U: return &emojis[440];
-	case 0xD83DDC55U: return &emojis[441];
-	case 0xD83DDC56U: return &emojis[442];
-	case 0xD83DDC57U: return &emojis[443];
-	case 0xD83DDC58U: return &emojis[444];
-	case 0xD83DDC59U: return &emojis[445];
-	case 0xD83DDC5AU: return &emojis[446];
-	case 0xD83DDC5BU: return &emojis[447];
-	case 0xD83DDC5CU: return &emojis[448];
-	case 0xD83DDC5DU: return &emojis[449];
-	case 0xD83DDC5EU: return &emojis[450];
-	case 0xD83DDC5FU: return &emojis[451];
-	case 0xD83DDC60U: return &emojis[452];
-	case 0xD83DDC61U: return &emojis[453];
-	case 0xD83DDC62U: return &emojis[454];
-	case 0xD83DDC63U: return &emojis[455];
-	case 0xD83DDC64U: return &emojis[456];
-	case 0xD83DDC65U: return &emojis[457];
-	case 0xD83DDC66U: return &emojis[458];
-	case 0xD83DDC67U: return &emojis[459];
-	case 0xD83DDC68U: return &emojis[460];
-	case 0xD83DDC69U: return &emojis[461];
-	case 0xD83DDC6AU: return &emojis[462];
-	case 0xD83DDC6BU: return &emojis[463];
-	case 0xD83DDC6CU: return &emojis[464];
-	case 0xD83DDC6DU: return &emojis[465];
-	case 0xD83DDC6EU: return &emojis[466];
-	case 0xD83DDC6FU: return &emojis[467];
-	case 0xD83DDC70U: return &emojis[468];
-	case 0xD83DDC71U: return &emojis[469];
-	case 0xD83DDC72U: return &emojis[470];
-	case 0xD83DDC73U: return &emojis[471];
-	case 0xD83DDC74U: return &emojis[472];
-	case 0xD83DDC75U: return &emojis[473];
-	case 0xD83DDC76U: return &emojis[474];
-	case 0xD83DDC77U: return &emojis[475];
-	case 0xD83DDC78U: return &emojis[476];
-	case 0xD83DDC79U: return &emojis[477];
-	case 0xD83DDC7AU: return &emojis[478];
-	case 0xD83DDC7BU: return &emojis[479];
-	case 0xD83DDC7CU: return &emojis[480];
-	case 0xD83DDC7DU: return &emojis[481];
-	case 0xD83DDC7EU: return &emojis[482];
-	case 0xD83DDC7FU: return &emojis[483];
-	case 0xD83DDC80U: return &emojis[484];
-	case 0xD83DDC81U: return &emojis[485];
-	case 0xD83DDC82U: return &emojis[486];
-	case 0xD83DDC83U: return &emojis[487];
-	case 0xD83DDC84U: return &emojis[488];
-	case 0xD83DDC85U: return &emojis[489];
-	case 0xD83DDC86U: return &emojis[490];
-	case 0xD83DDC87U: return &emojis[491];
-	case 0xD83DDC88U: return &emojis[492];
-	case 0xD83DDC89U: return &emojis[493];
-	case 0xD83DDC8AU: return &emojis[494];
-	case 0xD83DDC8BU: return &emojis[495];
-	case 0xD83DDC8CU: return &emojis[496];
-	case 0xD83DDC8DU: return &emojis[497];
-	case 0xD83DDC8EU: return &emojis[498];
-	case 0xD83DDC8FU: return &emojis[499];
-	case 0xD83DDC90U: return &emojis[500];
-	case 0xD83DDC91U: return &emojis[501];
-	case 0xD83DDC92U: return &emojis[502];
-	case 0xD83DDC93U: return &emojis[503];
-	case 0xD83DDC94U: return &emojis[504];
-	case 0xD83DDC95U: return &emojis[505];
-	case 0xD83DDC96U: return &emojis[506];
-	case 0xD83DDC97U: return &emojis[507];
-	case 0xD83DDC98U: return &emojis[508];
-	case 0xD83DDC99U: return &emojis[509];
-	case 0xD83DDC9AU: return &emojis[510];
-	case 0xD83DDC9BU: return &emojis[511];
-	case 0xD83DDC9CU: return &emojis[512];
-	case 0xD83DDC9DU: return &emojis[513];
-	case 0xD83DDC9EU: return &emojis[514];
-	case 0xD83DDC9FU: return &emojis[515];
-	case 0xD83DDCA0U: return &emojis[516];
-	case 0xD83DDCA1U: return &emojis[517];
-	case 0xD83DDCA2U: return &emojis[518];
-	case 0xD83DDCA3U: return &emojis[519];
-	case 0xD83DDCA4U: return &emojis[520];
-	case 0xD83DDCA5U: return &emojis[521];
-	case 0xD83DDCA6U: return &emojis[522];
-	case 0xD83DDCA7U: return &emojis[523];
-	case 0xD83DDCA8U: return &emojis[524];
-	case 0xD83DDCA9U: return &emojis[525];
-	case 0xD83DDCAAU: return &emojis[526];
-	case 0xD83DDCABU: return &emojis[527];
-	case 0xD83DDCACU: return &emojis[528];
-	case 0xD83DDCADU: return &emojis[529];
-	case 0xD83DDCAEU: return &emojis[530];
-	case 0xD83DDCAFU: return &emojis[531];
-	case 0xD83DDCB0U: return &emojis[532];
-	case 0xD83DDCB1U: return &emojis[533];
-	case 0xD83DDCB2U: return &emojis[534];
-	case 0xD83DDCB3U: return &emojis[535];
-	case 0xD83DDCB4U: return &emojis[536];
-	case 0xD83DDCB5U: return &emojis[537];
-	case 0xD83DDCB6U: return &emojis[538];
-	case 0xD83DDCB7U: return &emojis[539];
-	case 0xD83DDCB8U: return &emojis[540];
-	case 0xD83DDCB9U: return &emojis[541];
-	case 0xD83DDCBAU: return &emojis[542];
-	case 0xD83DDCBBU: return &emojis[543];
-	case 0xD83DDCBCU: return &emojis[544];
-	case 0xD83DDCBDU: return &emojis[545];
-	case 0xD83DDCBEU: return &emojis[546];
-	case 0xD83DDCBFU: return &emojis[547];
-	case 0xD83DDCC0U: return &emojis[548];
-	case 0xD83DDCC1U: return &emojis[549];
-	case 0xD83DDCC2U: return &emojis[550];
-	case 0xD83DDCC3U: return &emojis[551];
-	case 0xD83DDCC4U: return &emojis[552];
-	case 0xD83DDCC5U: return &emojis[553];
-	case 0xD83DDCC6U: return &emojis[554];
-	case 0xD83DDCC7U: return &emojis[555];
-	case 0xD83DDCC8U: return &emojis[556];
-	case 0xD83DDCC9U: return &emojis[557];
-	case 0xD83DDCCAU: return &emojis[558];
-	case 0xD83DDCCBU: return &emojis[559];
-	case 0xD83DDCCCU: return &emojis[560];
-	case 0xD83DDCCDU: return &emojis[561];
-	case 0xD83DDCCEU: return &emojis[562];
-	case 0xD83DDCCFU: return &emojis[563];
-	case 0xD83DDCD0U: return &emojis[564];
-	case 0xD83DDCD1U: return &emojis[565];
-	case 0xD83DDCD2U: return &emojis[566];
-	case 0xD83DDCD3U: return &emojis[567];
-	case 0xD83DDCD4U: return &emojis[568];
-	case 0xD83DDCD5U: return &emojis[569];
-	case 0xD83DDCD6U: return &emojis[570];
-	case 0xD83DDCD7U: return &emojis[571];
-	case 0xD83DDCD8U: return &emojis[572];
-	case 0xD83DDCD9U: return &emojis[573];
-	case 0xD83DDCDAU: return &emojis[574];
-	case 0xD83DDCDBU: return &emojis[575];
-	case 0xD83DDCDCU: return &emojis[576];
-	case 0xD83DDCDDU: return &emojis[577];
-	case 0xD83DDCDEU: return &emojis[578];
-	case 0xD83DDCDFU: return &emojis[579];
-	case 0xD83DDCE0U: return &emojis[580];
-	case 0xD83DDCE1U: return &emojis[581];
-	case 0xD83DDCE2U: return &emojis[582];
-	case 0xD83DDCE3U: return &emojis[583];
-	case 0xD83DDCE4U: return &emojis[584];
-	case 0xD83DDCE5U: return &emojis[585];
-	case 0xD83DDCE6U: return &emojis[586];
-	case 0xD83DDCE7U: return &emojis[587];
-	case 0xD83DDCE8U: return &emojis[588];
-	case 0xD83DDCE9U: return &emojis[589];
-	case 0xD83DDCEAU: return &emojis[590];
-	case 0xD83DDCEBU: return &emojis[591];
-	case 0xD83DDCECU: return &emojis[592];
-	case 0xD83DDCEDU: return &emojis[593];
-	case 0xD83DDCEEU: return &emojis[594];
-	case 0xD83DDCEFU: return &emojis[595];
-	case 0xD83DDCF0U: return &emojis[596];
-	case 0xD83DDCF1U: return &emojis[597];
-	case 0xD83DDCF2U: return &emojis[598];
-	case 0xD83DDCF3U: return &emojis[599];
-	case 0xD83DDCF4U: return &emojis[600];
-	case 0xD83DDCF5U: return &emojis[601];
-	case 0xD83DDCF6U: return &emojis[602];
-	case 0xD83DDCF7U: return &emojis[603];
-	case 0xD83DDCF9U: return &emojis[604];
-	case 0xD83DDCFAU: return &emojis[605];
-	case 0xD83DDCFBU: return &emojis[606];
-	case 0xD83DDCFCU: return &emojis[607];
-	case 0xD83DDD00U: return &emojis[608];
-	case 0xD83DDD01U: return &emojis[609];
-	case 0xD83DDD02U: return &emojis[610];
-	case 0xD83DDD03U: return &emojis[611];
-	case 0xD83DDD04U: return &emojis[612];
-	case 0xD83DDD05U: return &emojis[613];
-	case 0xD83DDD06U: return &emojis[614];
-	case 0xD83DDD07U: return &emojis[615];
-	case 0xD83DDD08U: return &emojis[616];
-	case 0xD83DDD09U: return &emojis[617];
-	case 0xD83DDD0AU: return &emojis[618];
-	case 0xD83DDD0BU: return &emojis[619];
-	case 0xD83DDD0CU: return &emojis[620];
-	case 0xD83DDD0DU: return &emojis[621];
-	case 0xD83DDD0EU: return &emojis[622];
-	case 0xD83DDD0FU: return &emojis[623];
-	case 0xD83DDD10U: return &emojis[624];
-	case 0xD83DDD11U: return &emojis[625];
-	case 0xD83DDD12U: return &emojis[626];
-	case 0xD83DDD13U: return &emojis[627];
-	case 0xD83DDD14U: return &emojis[628];
-	case 0xD83DDD15U: return &emojis[629];
-	case 0xD83DDD16U: return &emojis[630];
-	case 0xD83DDD17U: return &emojis[631];
-	case 0xD83DDD18U: return &emojis[632];
-	case 0xD83DDD19U: return &emojis[633];
-	case 0xD83DDD1AU: return &emojis[634];
-	case 0xD83DDD1BU: return &emojis[635];
-	case 0xD83DDD1CU: return &emojis[636];
-	case 0xD83DDD1DU: return &emojis[637];
-	case 0xD83DDD1EU: return &emojis[638];
-	case 0xD83DDD1FU: return &emojis[639];
-	case 0xD83DDD20U: return &emojis[640];
-	case 0xD83DDD21U: return &emojis[641];
-	case 0xD83DDD22U: return &emojis[642];
-	case 0xD83DDD23U: return &emojis[643];
-	case 0xD83DDD24U: return &emojis[644];
-	case 0xD83DDD25U: return &emojis[645];
-	case 0xD83DDD26U: return &emojis[646];
-	case 0xD83DDD27U: return &emojis[647];
-	case 0xD83DDD28U: return &emojis[648];
-	case 0xD83DDD29U: return &emojis[649];
-	case 0xD83DDD2AU: return &emojis[650];
-	case 0xD83DDD2BU: return &emojis[651];
-	case 0xD83DDD2CU: return &emojis[652];
-	case 0xD83DDD2DU: return &emojis[653];
-	case 0xD83DDD2EU: return &emojis[654];
-	case 0xD83DDD2FU: return &emojis[655];
-	case 0xD83DDD30U: return &emojis[656];
-	case 0xD83DDD31U: return &emojis[657];
-	case 0xD83DDD32U: return &emojis[658];
-	case 0xD83DDD33U: return &emojis[659];
-	case 0xD83DDD34U: return &emojis[660];
-	case 0xD83DDD35U: return &emojis[661];
-	case 0xD83DDD36U: return &emojis[662];
-	case 0xD83DDD37U: return &emojis[663];
-	case 0xD83DDD38U: return &emojis[664];
-	case 0xD83DDD39U: return &emojis[665];
-	case 0xD83DDD3AU: return &emojis[666];
-	case 0xD83DDD3BU: return &emojis[667];
-	case 0xD83DDD3CU: return &emojis[668];
-	case 0xD83DDD3DU: return &emojis[669];
-	case 0xD83DDD50U: return &emojis[670];
-	case 0xD83DDD51U: return &emojis[671];
-	case 0xD83DDD52U: return &emojis[672];
-	case 0xD83DDD53U: return &emojis[673];
-	case 0xD83DDD54U: return &emojis[674];
-	case 0xD83DDD55U: return &emojis[675];
-	case 0xD83DDD56U: return &emojis[676];
-	case 0xD83DDD57U: return &emojis[677];
-	case 0xD83DDD58U: return &emojis[678];
-	case 0xD83DDD59U: return &emojis[679];
-	case 0xD83DDD5AU: return &emojis[680];
-	case 0xD83DDD5BU: return &emojis[681];
-	case 0xD83DDD5CU: return &emojis[682];
-	case 0xD83DDD5DU: return &emojis[683];
-	case 0xD83DDD5EU: return &emojis[684];
-	case 0xD83DDD5FU: return &emojis[685];
-	case 0xD83DDD60U: return &emojis[686];
-	case 0xD83DDD61U: return &emojis[687];
-	case 0xD83DDD62U: return &emojis[688];
-	case 0xD83DDD63U: return &emojis[689];
-	case 0xD83DDD64U: return &emojis[690];
-	case 0xD83DDD65U: return &emojis[691];
-	case 0xD83DDD66U: return &emojis[692];
-	case 0xD83DDD67U: return &emojis[693];
-	case 0xD83DDDFBU: return &emojis[694];
-	case 0xD83DDDFCU: return &emojis[695];
-	case 0xD83DDDFDU: return &emojis[696];
-	case 0xD83DDDFEU: return &emojis[697];
-	case 0xD83DDDFFU: return &emojis[698];
-	case 0xD83DDE00U: return &emojis[699];
-	case 0xD83DDE01U: return &emojis[700];
-	case 0xD83DDE02U: return &emojis[701];
-	case 0xD83DDE03U: return &emojis[702];
-	case 0xD83DDE04U: return &emojis[703];
-	case 0xD83DDE05U: return &emojis[704];
-	case 0xD83DDE06U: return &emojis[705];
-	case 0xD83DDE07U: return &emojis[706];
-	case 0xD83DDE08U: return &emojis[707];
-	case 0xD83DDE09U: return &emojis[708];
-	case 0xD83DDE0AU: return &emojis[709];
-	case 0xD83DDE0BU: return &emojis[710];
-	case 0xD83DDE0CU: return &emojis[711];
-	case 0xD83DDE0DU: return &emojis[712];
-	case 0xD83DDE0EU: return &emojis[713];
-	case 0xD83DDE0FU: return &emojis[714];
-	case 0xD83DDE10U: return &emojis[715];
-	case 0xD83DDE11U: return &emojis[716];
-	case 0xD83DDE12U: return &emojis[717];
-	case 0xD83DDE13U: return &emojis[718];
-	case 0xD83DDE14U: return &emojis[719];
-	case 0xD83DDE15U: return &emojis[720];
-	case 0xD83DDE16U: return &emojis[721];
-	case 0xD83DDE17U: return &emojis[722];
-	case 0xD83DDE18U: return &emojis[723];
-	case 0xD83DDE19U: return &emojis[724];
-	case 0xD83DDE1AU: return &emojis[725];
-	case 0xD83DDE1BU: return &emojis[726];
-	case 0xD83DDE1CU: return &emojis[727];
-	case 0xD83DDE1DU: return &emojis[728];
-	case 0xD83DDE1EU: return &emojis[729];
-	case 0xD83DDE1FU: return &emojis[730];
-	case 0xD83DDE20U: return &emojis[731];
-	case 0xD83DDE21U: return &emojis[732];
-	case 0xD83DDE22U: return &emojis[733];
-	case 0xD83DDE23U: return &emojis[734];
-	case 0xD83DDE24U: return &emojis[735];
-	case 0xD83DDE25U: return &emojis[736];
-	case 0xD83DDE26U: return &emojis[737];
-	case 0xD83DDE27U: return &emojis[738];
-	case 0xD83DDE28U: return &emojis[739];
-	case 0xD83DDE29U: return &emojis[740];
-	case 0xD83DDE2AU: return &emojis[741];
-	case 0xD83DDE2BU: return &emojis[742];
-	case 0xD83DDE2CU: return &emojis[743];
-	case 0xD83DDE2DU: return &emojis[744];
-	case 0xD83DDE2EU: return &emojis[745];
-	case 0xD83DDE2FU: return &emojis[746];
-	case 0xD83DDE30U: return &emojis[747];
-	case 0xD83DDE31U: return &emojis[748];
-	case 0xD83DDE32U: return &emojis[749];
-	case 0xD83DDE33U: return &emojis[750];
-	case 0xD83DDE34U: return &emojis[751];
-	case 0xD83DDE35U: return &emojis[752];
-	case 0xD83DDE36U: return &emojis[753];
-	case 0xD83DDE37U: return &emojis[754];
-	case 0xD83DDE38U: return &emojis[755];
-	case 0xD83DDE39U: return &emojis[756];
-	case 0xD83DDE3AU: return &emojis[757];
-	case 0xD83DDE3BU: return &emojis[758];
-	case 0xD83DDE3CU: return &emojis[759];
-	case 0xD83DDE3DU: return &emojis[760];
-	case 0xD83DDE3EU: return &emojis[761];
-	case 0xD83DDE3FU: return &emojis[762];
-	case 0xD83DDE40U: return &emojis[763];
-	case 0xD83DDE45U: return &emojis[764];
-	case 0xD83DDE46U: return &emojis[765];
-	case 0xD83DDE47U: return &emojis[766];
-	case 0xD83DDE48U: return &emojis[767];
-	case 0xD83DDE49U: return &emojis[768];
-	case 0xD83DDE4AU: return &emojis[769];
-	case 0xD83DDE4BU: return &emojis[770];
-	case 0xD83DDE4CU: return &emojis[771];
-	case 0xD83DDE4DU: return &emojis[772];
-	case 0xD83DDE4EU: return &emojis[773];
-	case 0xD83DDE4FU: return &emojis[774];
-	case 0xD83DDE80U: return &emojis[775];
-	case 0xD83DDE81U: return &emojis[776];
-	case 0xD83DDE82U: return &emojis[777];
-	case 0xD83DDE83U: return &emojis[778];
-	case 0xD83DDE84U: return &emojis[779];
-	case 0xD83DDE85U: return &emojis[780];
-	case 0xD83DDE86U: return &emojis[781];
-	case 0xD83DDE87U: return &emojis[782];
-	case 0xD83DDE88U: return &emojis[783];
-	case 0xD83DDE89U: return &emojis[784];
-	case 0xD83DDE8AU: return &emojis[785];
-	case 0xD83DDE8BU: return &emojis[786];
-	case 0xD83DDE8CU: return &emojis[787];
-	case 0xD83DDE8DU: return &emojis[788];
-	case 0xD83DDE8EU: return &emojis[789];
-	case 0xD83DDE8FU: return &emojis[790];
-	case 0xD83DDE90U: return &emojis[791];
-	case 0xD83DDE91U: return &emojis[792];
-	case 0xD83DDE92U: return &emojis[793];
-	case 0xD83DDE93U: return &emojis[794];
-	case 0xD83DDE94U: return &emojis[795];
-	case 0xD83DDE95U: return &emojis[796];
-	case 0xD83DDE96U: return &emojis[797];
-	case 0xD83DDE97U: return &emojis[798];
-	case 0xD83DDE98U: return &emojis[799];
-	case 0xD83DDE99U: return &emojis[800];
-	case 0xD83DDE9AU: return &emojis[801];
-	case 0xD83DDE9BU: return &emojis[802];
-	case 0xD83DDE9CU: return &emojis[803];
-	case 0xD83DDE9DU: return &emojis[804];
-	case 0xD83DDE9EU: return &emojis[805];
-	case 0xD83DDE9FU: return &emojis[806];
-	case 0xD83DDEA0U: return &emojis[807];
-	case 0xD83DDEA1U: return &emojis[808];
-	case 0xD83DDEA2U: return &emojis[809];
-	case 0xD83DDEA3U: return &emojis[810];
-	case 0xD83DDEA4U: return &emojis[811];
-	case 0xD83DDEA5U: return &emojis[812];
-	case 0xD83DDEA6U: return &emojis[813];
-	case 0xD83DDEA7U: return &emojis[814];
-	case 0xD83DDEA8U: return &emojis[815];
-	case 0xD83DDEA9U: return &emojis[816];
-	case 0xD83DDEAAU: return &emojis[817];
-	case 0xD83DDEABU: return &emojis[818];
-	case 0xD83DDEACU: return &emojis[819];
-	case 0xD83DDEADU: return &emojis[820];
-	case 0xD83DDEAEU: return &emojis[821];
-	case 0xD83DDEAFU: return &emojis[822];
-	case 0xD83DDEB0U: return &emojis[823];
-	case 0xD83DDEB1U: return &emojis[824];
-	case 0xD83DDEB2U: return &emojis[825];
-	case 0xD83DDEB3U: return &emojis[826];
-	case 0xD83DDEB4U: return &emojis[827];
-	case 0xD83DDEB5U: return &emojis[828];
-	case 0xD83DDEB6U: return &emojis[829];
-	case 0xD83DDEB7U: return &emojis[830];
-	case 0xD83DDEB8U: return &emojis[831];
-	case 0xD83DDEB9U: return &emojis[832];
-	case 0xD83DDEBAU: return &emojis[833];
-	case 0xD83DDEBBU: return &emojis[834];
-	case 0xD83DDEBCU: return &emojis[835];
-	case 0xD83DDEBDU: return &emojis[836];
-	case 0xD83DDEBEU: return &emojis[837];
-	case 0xD83DDEBFU: return &emojis[838];
-	case 0xD83DDEC0U: return &emojis[839];
-	case 0xD83DDEC1U: return &emojis[840];
-	case 0xD83DDEC2U: return &emojis[841];
-	case 0xD83DDEC3U: return &emojis[842];
-	case 0xD83DDEC4U: return &emojis[843];
-	case 0xD83DDEC5U: return &emojis[844];
-	}
-
-	return 0;
+	// bucket by one hash, xor the other hash with the bucket displacement to get the slot
+	uint32 index = emojisHashSlots[((code * 0x85EBCA6BU) >> 22) ^ emojisHashDisplace[(code * 0x9E3779B1U) >> 24]];
+	return (index && emojis[index - 1].code == code) ? &emojis[index - 1] : 0;
 }
 
 void findEmoji(const QChar *ch, const QChar *e, const QChar *&newEmojiEnd, uint32 &emojiCode) {
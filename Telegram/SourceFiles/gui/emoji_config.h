@@ -24,6 +24,26 @@ EmojiPtr getEmoji(uint32 code);
 
 void findEmoji(const QChar *ch, const QChar *e, const QChar *&newEmojiEnd, uint32 &emojiCode);
 
+// emoji starting at ch with its full length in chars (including 0xFE0F postfix) in outLength
+inline EmojiPtr emojiFromText(const QChar *ch, const QChar *end, int32 *outLength = 0) {
+	uint32 first = ch->unicode();
+	if (first < 0xA9U && first != 35 && (first < 48 || first >= 58)) return 0; // only digit emoji start with ascii
+
+	EmojiPtr result = 0;
+	if (ch + 1 < end && (ch->isHighSurrogate() || (first < 0xA9U && (ch + 1)->unicode() == 0x20E3))) {
+		result = getEmoji((first << 16) | uint32((ch + 1)->unicode()));
+		if (result && result->len > 2 && (ch + 3 >= end || ((uint32((ch + 2)->unicode()) << 16) | uint32((ch + 3)->unicode())) != result->code2)) {
+			result = 0;
+		}
+	} else if (first >= 0xA9U) {
+		result = getEmoji(first);
+	}
+	if (result && outLength) {
+		*outLength = result->len + ((ch + result->len < end && (ch + result->len)->unicode() == 0xFE0F) ? 1 : 0);
+	}
+	return result;
+}
+
 inline bool emojiEdge(const QChar *ch) {
 	return true;
 
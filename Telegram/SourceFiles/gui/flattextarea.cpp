@@ -21,11 +21,22 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "flattextarea.h"
 #include "window.h"
 
+namespace {
+	struct EmojiReplace {
+		EmojiReplace(int32 position = 0, int32 len = 0, EmojiPtr emoji = 0) : position(position), len(len), emoji(emoji) {
+		}
+		int32 position, len;
+		EmojiPtr emoji;
+	};
+	typedef QVector<EmojiReplace> EmojiReplaces;
+}
+
 FlatTextarea::FlatTextarea(QWidget *parent, const style::flatTextarea &st, const QString &pholder, const QString &v) : QTextEdit(v, parent),
 	_ph(pholder), _oldtext(v), _phVisible(!v.length()),
     a_phLeft(_phVisible ? 0 : st.phShift), a_phAlpha(_phVisible ? 1 : 0), a_phColor(st.phColor->c),
     _st(st), _undoAvailable(false), _redoAvailable(false), _fakeMargin(0),
-    _touchPress(false), _touchRightButton(false), _touchMove(false), _replacingEmojis(false) {
+    _touchPress(false), _touchRightButton(false), _touchMove(false), _replacingEmojis(false),
+	_linksDirtyFrom(0), _linksDirtyTill(v.size()) {
 	setAcceptRichText(false);
 	resize(_st.width, _st.font->height);
 	
@@ -417,10 +428,12 @@ bool FlatTextarea::isRedoAvailable() const {
 }
 
 void FlatTextarea::parseLinks() { // some code is duplicated in text.cpp!
-	LinkRanges newLinks;
+	if (_linksDirtyTill < _linksDirtyFrom) return; // nothing changed since last parse
 
 	QString text(toPlainText());
 	if (text.isEmpty()) {
+		_linksDirtyFrom = 0;
+		_linksDirtyTill = -1;
 		if (!_links.isEmpty()) {
 			_links.clear();
 			emit linksChanged();
@@ -432,11 +445,29 @@ void FlatTextarea::parseLinks() { // some code is duplicated in text.cpp!
 
 	int32 len = text.size();
 	const QChar *start = text.unicode(), *end = start + text.size();
-	for (int32 offset = 0, matchOffset = offset; offset < len;) {
+
+	// links can't contain link end chars, so only the words touched by the changes are parsed again
+	int32 parseFrom = qMin(_linksDirtyFrom, len), parseTill = qMin(_linksDirtyTill, len);
+	while (parseFrom > 0 && !chIsLinkEnd(*(start + parseFrom - 1))) --parseFrom;
+	while (parseTill < len && !chIsLinkEnd(*(start + parseTill))) ++parseTill;
+	_linksDirtyFrom = 0;
+	_linksDirtyTill = -1;
+
+	LinkRanges newLinks;
+	LinkRanges::const_iterator kept = _links.cbegin(), keptEnd = _links.cend();
+	for (; kept != keptEnd && kept->first + kept->second <= parseFrom; ++kept) {
+		newLinks.push_back(*kept);
+	}
+	while (kept != keptEnd && kept->first < parseTill) { // those are parsed again
+		++kept;
+	}
+
+	for (int32 offset = parseFrom, matchOffset = offset; offset < parseTill;) {
 		QRegularExpressionMatch m = reDomain().match(text, matchOffset);
 		if (!m.hasMatch()) break;
 
 		int32 domainOffset = m.capturedStart();
+		if (domainOffset >= parseTill) break;
 
 		QString protocol = m.captured(1).toLower();
 		QString topDomain = m.captured(3).toLower();
@@ -493,6 +524,9 @@ void FlatTextarea::parseLinks() { // some code is duplicated in text.cpp!
 		newLinks.push_back(qMakePair(domainOffset - 1, p - start - domainOffset + 2));
 		offset = matchOffset = p - start;
 	}
+	for (; kept != keptEnd; ++kept) {
+		newLinks.push_back(*kept);
+	}
 
 	if (newLinks != _links) {
 		_links = newLinks;
@@ -531,80 +565,63 @@ void FlatTextarea::insertEmoji(EmojiPtr emoji, QTextCursor c) {
 }
 
 void FlatTextarea::processDocumentContentsChange(int position, int charsAdded) {
-	int32 emojiPosition = 0, emojiLen = 0;
-	const EmojiData *emoji = 0;
-
 	QTextDocument *doc(document());
 
-	while (true) {
-		int32 start = position, end = position + charsAdded;
-		QTextBlock from = doc->findBlock(start), till = doc->findBlock(end);
-		if (till.isValid()) till = till.next();
+	int32 start = position, end = position + charsAdded;
+	QTextBlock from = doc->findBlock(start), till = doc->findBlock(end);
+	if (till.isValid()) till = till.next();
 
-		for (QTextBlock b = from; b != till; b = b.next()) {
-			for (QTextBlock::Iterator iter = b.begin(); !iter.atEnd(); ++iter) {
-				QTextFragment fragment(iter.fragment());
-				if (!fragment.isValid()) continue;
+	EmojiReplaces replaces; // all emoji in the changed range are found in one pass
+	for (QTextBlock b = from; b != till; b = b.next()) {
+		for (QTextBlock::Iterator iter = b.begin(); !iter.atEnd(); ++iter) {
+			QTextFragment fragment(iter.fragment());
+			if (!fragment.isValid()) continue;
 
-				int32 p = fragment.position(), e = p + fragment.length();
-				if (p >= end || e <= start) {
-					continue;
-				}
+			int32 p = fragment.position(), e = p + fragment.length();
+			if (p >= end || e <= start) {
+				continue;
+			}
 
-				QString t(fragment.text());
-				for (const QChar *ch = t.constData(), *e = ch + t.size(); ch != e; ++ch) {
-					if (ch + 1 < e && (ch->isHighSurrogate() || (((ch->unicode() >= 48 && ch->unicode() < 58) || ch->unicode() == 35) && (ch + 1)->unicode() == 0x20E3))) {
-						emoji = getEmoji((ch->unicode() << 16) | (ch + 1)->unicode());
-						if (emoji) {
-							if (emoji->len == 4 && (ch + 3 >= e || ((uint32((ch + 2)->unicode()) << 16) | uint32((ch + 3)->unicode())) != emoji->code2)) {
-								emoji = 0;
-							} else {
-								emojiPosition = p + (ch - t.constData());
-								emojiLen = emoji->len + ((ch + emoji->len < e && (ch + emoji->len)->unicode() == 0xFE0F) ? 1 : 0);
-								break;
-							}
-						}
-						++ch;
-					} else {
-						emoji = getEmoji(ch->unicode());
-						if (emoji) {
-							emojiPosition = p + (ch - t.constData());
-							emojiLen = emoji->len + ((ch + emoji->len < e && (ch + emoji->len)->unicode() == 0xFE0F) ? 1 : 0);
-							break;
-						}
-					}
+			QString t(fragment.text());
+			for (const QChar *ch = t.constData(), *e = ch + t.size(); ch < e;) {
+				int32 emojiLen = 0;
+				EmojiPtr emoji = emojiFromText(ch, e, &emojiLen);
+				if (emoji) {
+					replaces.push_back(EmojiReplace(p + (ch - t.constData()), emojiLen, emoji));
+					ch += emojiLen;
+				} else {
+					ch += (ch + 1 < e && ch->isHighSurrogate()) ? 2 : 1;
 				}
-				if (emoji) break;
 			}
-			if (emoji) break;
 		}
-		if (emoji) {
-			QTextCursor c(doc->docHandle(), emojiPosition);
-			c.setPosition(emojiPosition + emojiLen, QTextCursor::KeepAnchor);
-			int32 removedUpto = c.position();
-
-			insertEmoji(emoji, c);
-
-			for (Insertions::iterator i = _insertions.begin(), e = _insertions.end(); i != e; ++i) {
-				if (i->first >= removedUpto) {
-					i->first -= removedUpto - emojiPosition - 1;
-				} else if (i->first >= emojiPosition) {
-					i->second -= removedUpto - emojiPosition;
-					i->first = emojiPosition + 1;
-				} else if (i->first + i->second > emojiPosition + 1) {
-					i->second -= qMin(removedUpto, i->first + i->second) - emojiPosition;
-				}
+	}
+	if (replaces.isEmpty()) return;
+
+	// replace from the end, so that the positions found before stay valid, in one undo step
+	QTextCursor c(doc->docHandle(), 0);
+	c.beginEditBlock();
+	for (EmojiReplaces::const_iterator j = replaces.cend(), b = replaces.cbegin(); j != b;) {
+		--j;
+		int32 emojiPosition = j->position;
+
+		c.setPosition(emojiPosition);
+		c.setPosition(emojiPosition + j->len, QTextCursor::KeepAnchor);
+		int32 removedUpto = c.position();
+
+		insertEmoji(j->emoji, c);
+
+		for (Insertions::iterator i = _insertions.begin(), e = _insertions.end(); i != e; ++i) {
+			if (i->first >= removedUpto) {
+				i->first -= removedUpto - emojiPosition - 1;
+			} else if (i->first >= emojiPosition) {
+				i->second -= removedUpto - emojiPosition;
+				i->first = emojiPosition + 1;
+			} else if (i->first + i->second > emojiPosition + 1) {
+				i->second -= qMin(removedUpto, i->first + i->second) - emojiPosition;
 			}
-
-			charsAdded -= removedUpto - position;
-			position = emojiPosition + 1;
-
-			emoji = 0;
-			emojiPosition = 0;
-		} else {
-			break;
 		}
 	}
+	c.endEditBlock();
 }
 
 void FlatTextarea::onDocumentContentsChange(int position, int charsRemoved, int charsAdded) {
@@ -624,6 +641,19 @@ void FlatTextarea::onDocumentContentsChange(int position, int charsRemoved, int
 		if (changed) emit linksChanged();
 	}
 
+	if (_linksDirtyTill < _linksDirtyFrom) {
+		_linksDirtyFrom = position;
+		_linksDirtyTill = position + charsAdded;
+	} else {
+		if (_linksDirtyTill >= position + charsRemoved) {
+			_linksDirtyTill += charsAdded - charsRemoved;
+		} else if (_linksDirtyTill > position) {
+			_linksDirtyTill = position;
+		}
+		_linksDirtyFrom = qMin(_linksDirtyFrom, position);
+		_linksDirtyTill = qMax(_linksDirtyTill, position + charsAdded);
+	}
+
 	if (_replacingEmojis || document()->availableRedoSteps() > 0) return;
 
 	const int takeBack = 3;
@@ -646,6 +676,7 @@ void FlatTextarea::onDocumentContentsChanged() {
 		if (document()->availableRedoSteps() > 0) {
 			_insertions.clear();
 		} else {
+			uint64 ms = getms(true);
 			_replacingEmojis = true;
 			do {
 				Insertion i = _insertions.front();
@@ -655,6 +686,8 @@ void FlatTextarea::onDocumentContentsChanged() {
 				}
 			} while (!_insertions.isEmpty());
 			_replacingEmojis = false;
+			static MetricHandle fieldEmojiReplaceMsMetric = metricHistogram(qsl("field.emoji_replace_ms"));
+			metricSample(fieldEmojiReplaceMsMetric, getms(true) - ms);
 		}
 	}
 
@@ -116,4 +116,5 @@ private:
 	typedef QPair<int, int> LinkRange;
 	typedef QList<LinkRange> LinkRanges;
 	LinkRanges _links;
+	int32 _linksDirtyFrom, _linksDirtyTill; // text range changed after last parseLinks(), empty if till < from
 };
@@ -190,6 +190,133 @@ const QPixmap &Image::pixBlurredSingle(int32 w, int32 h) const {
 	return i.value();
 }
 
+namespace {
+	struct ImageAtlas {
+		ImageAtlas(int32 cellSize) : cellSize(cellSize), pageSize(cellSize * ImageAtlasPageCells), painted(0) {
+		}
+		~ImageAtlas() {
+			globalAquiredSize -= int64(pages.size()) * pageSize * pageSize * 4;
+		}
+		int32 cellSize, pageSize;
+		uint64 painted; // last paint time
+		QList<QPixmap> pages;
+		QVector<const Image*> images; // cell -> image, 0 for a free cell
+		QVector<uint64> used; // cell -> last paint tick, 0 for a free cell
+		typedef QMap<uint64, int32> Order;
+		Order order; // last paint tick -> cell, least recently painted first
+		QList<int32> freeCells;
+		typedef QMap<const Image*, int32> Cells;
+		Cells cells;
+
+		void touch(int32 cell, uint64 tick) {
+			if (used.at(cell)) order.remove(used.at(cell));
+			used[cell] = tick;
+			order.insert(tick, cell);
+		}
+		void release(int32 cell) {
+			if (used.at(cell)) order.remove(used.at(cell));
+			used[cell] = 0;
+			images[cell] = 0;
+		}
+		QRect cellRect(int32 cell) const {
+			int32 index = cell % (ImageAtlasPageCells * ImageAtlasPageCells);
+			return QRect((index % ImageAtlasPageCells) * cellSize, (index / ImageAtlasPageCells) * cellSize, cellSize, cellSize);
+		}
+		const QPixmap &cellPage(int32 cell) const {
+			return pages.at(cell / (ImageAtlasPageCells * ImageAtlasPageCells));
+		}
+	};
+	typedef QMap<int32, ImageAtlas*> ImageAtlases;
+	ImageAtlases imageAtlases;
+	uint64 imageAtlasTick = 0;
+
+	int32 imageAtlasTakeCell(ImageAtlas *atlas) {
+		if (atlas->freeCells.isEmpty()) {
+			int32 perPage = ImageAtlasPageCells * ImageAtlasPageCells;
+			if (atlas->pages.size() < ImageAtlasMaxPages) {
+				QPixmap page(atlas->pageSize, atlas->pageSize);
+				page.fill(Qt::transparent);
+
+				int32 from = atlas->pages.size() * perPage;
+				atlas->pages.push_back(page);
+				globalAquiredSize += int64(atlas->pageSize) * atlas->pageSize * 4;
+				atlas->images.resize(from + perPage);
+				atlas->used.resize(from + perPage);
+				for (int32 i = from + perPage; i > from;) {
+					atlas->freeCells.push_back(--i);
+				}
+			} else { // evict the least recently painted image
+				int32 oldest = atlas->order.cbegin().value();
+				atlas->cells.remove(atlas->images.at(oldest));
+				atlas->release(oldest);
+				return oldest;
+			}
+		}
+		return atlas->freeCells.takeLast();
+	}
+
+	void clearImageAtlases() {
+		for (ImageAtlases::const_iterator i = imageAtlases.cbegin(), e = imageAtlases.cend(); i != e; ++i) {
+			delete i.value();
+		}
+		imageAtlases.clear();
+	}
+}
+
+void Image::paintSmall(QPainter &p, int32 x, int32 y, int32 size) const {
+	int32 cellSize = size * cIntRetinaFactor();
+	ImageAtlases::iterator i = imageAtlases.find(cellSize);
+	if (i != imageAtlases.end()) { // cached cell does not need the image data to be restored
+		ImageAtlas *atlas = i.value();
+		ImageAtlas::Cells::const_iterator j = atlas->cells.constFind(this);
+		if (j != atlas->cells.cend()) {
+			atlas->touch(j.value(), ++imageAtlasTick);
+			atlas->painted = getms(true);
+			p.drawPixmap(QRect(x, y, size, size), atlas->cellPage(j.value()), atlas->cellRect(j.value()));
+			return;
+		}
+	}
+
+	restore();
+	checkload();
+
+	if (cellSize <= 0 || cellSize > ImageAtlasMaxCellSize || isNull() || !loaded() || pixData().isNull() || width() != height()) {
+		p.drawPixmap(x, y, pix(size));
+		return;
+	}
+
+	if (i == imageAtlases.end()) {
+		i = imageAtlases.insert(cellSize, new ImageAtlas(cellSize));
+	}
+	ImageAtlas *atlas = i.value();
+
+	int32 cell = imageAtlasTakeCell(atlas);
+	atlas->images[cell] = this;
+	atlas->cells.insert(this, cell);
+	atlas->touch(cell, ++imageAtlasTick);
+	atlas->painted = getms(true);
+
+	QRect rect(atlas->cellRect(cell));
+	{
+		QPainter pagePainter(&atlas->pages[cell / (ImageAtlasPageCells * ImageAtlasPageCells)]);
+		pagePainter.setCompositionMode(QPainter::CompositionMode_Source);
+		pagePainter.drawPixmap(rect.topLeft(), pixNoCache(cellSize, cellSize, true));
+	}
+	p.drawPixmap(QRect(x, y, size, size), atlas->cellPage(cell), rect);
+}
+
+void Image::invalidateAtlas() const {
+	for (ImageAtlases::const_iterator i = imageAtlases.cbegin(), e = imageAtlases.cend(); i != e; ++i) {
+		ImageAtlas *atlas = i.value();
+		ImageAtlas::Cells::iterator j = atlas->cells.find(this);
+		if (j != atlas->cells.end()) {
+			atlas->release(j.value());
+			atlas->freeCells.push_back(j.value());
+			atlas->cells.erase(j);
+		}
+	}
+}
+
 namespace {
 	static inline uint64 _blurGetColors(const uchar *p) {
 		return (uint64)p[0] + ((uint64)p[1] << 16) + ((uint64)p[2] << 32) + ((uint64)p[3] << 48);
@@ -511,6 +638,19 @@ void clearAllImages() {
 	}
 	localImages.clear();
 	clearStorageImages();
+	clearImageAtlases();
+}
+
+void clearUnusedImageAtlases() {
+	uint64 ms = getms(true);
+	for (ImageAtlases::iterator i = imageAtlases.begin(); i != imageAtlases.end();) {
+		if (ms >= i.value()->painted + ImageAtlasForgetTimeout) {
+			delete i.value();
+			i = imageAtlases.erase(i);
+		} else {
+			++i;
+		}
+	}
 }
 
 int64 imageCacheSize() {
@@ -556,6 +696,7 @@ bool StorageImage::check() const {
 		w = data.width();
 		h = data.height();
 		invalidateSizeCache();
+		invalidateAtlas();
 		loader->deleteLater();
 		loader->rpcInvalidate();
 		loader = 0;
@@ -582,6 +723,7 @@ void StorageImage::setData(QByteArray &bytes, const QByteArray &format) {
 	w = data.width();
 	h = data.height();
 	invalidateSizeCache();
+	invalidateAtlas();
 	if (loader) {
 		loader->deleteLater();
 		loader->rpcInvalidate();
@@ -42,6 +42,7 @@ public:
 	QPixmap pixBlurredNoCache(int32 w, int32 h = 0) const;
 	QPixmap pixColoredNoCache(const style::color &add, int32 w = 0, int32 h = 0, bool smooth = false) const;
 	QPixmap pixBlurredColoredNoCache(const style::color &add, int32 w, int32 h = 0) const;
+	void paintSmall(QPainter &p, int32 x, int32 y, int32 size) const; // size x size square from the shared atlas, for userpics
 
 	virtual int32 width() const = 0;
 	virtual int32 height() const = 0;
@@ -66,6 +67,7 @@ public:
 
 	virtual ~Image() {
 		invalidateSizeCache();
+		invalidateAtlas();
 	}
 
 protected:
@@ -75,6 +77,7 @@ protected:
 	virtual void doRestore() const = 0;
 
 	void invalidateSizeCache() const;
+	void invalidateAtlas() const;
 
 	mutable QByteArray saved, format;
 	mutable bool forgot;
@@ -210,6 +213,7 @@ public:
 
 void clearStorageImages();
 void clearAllImages();
+void clearUnusedImageAtlases();
 int64 imageCacheSize();
 
 struct FileLocation {
@@ -257,15 +257,18 @@ _st(st),
 hor(this, false, &_st), vert(this, true, &_st), topSh(this, &_st), bottomSh(this, &_st),
 _touchEnabled(handleTouch), _touchScroll(false), _touchPress(false), _touchRightButton(false),
 _touchScrollState(TouchScrollManual), _touchPrevPosValid(false), _touchWaitingAcceleration(false),
-_touchSpeedTime(0), _touchAccelerationTime(0), _touchTime(0), _widgetAcceptsTouch(false) {
+_touchSpeedTime(0), _touchAccelerationTime(0), _touchTime(0), _widgetAcceptsTouch(false),
+_frameTop(0), _frameScrolls(0), _scrollSpeed(0), _frameTime(0) {
 	connect(horizontalScrollBar(), SIGNAL(valueChanged(int)), this, SIGNAL(scrolled()));
 	connect(verticalScrollBar(), SIGNAL(valueChanged(int)), this, SIGNAL(scrolled()));
 	connect(&vert, SIGNAL(topShadowVisibility(bool)), &topSh, SLOT(changeVisibility(bool)));
 	connect(&vert, SIGNAL(bottomShadowVisibility(bool)), &bottomSh, SLOT(changeVisibility(bool)));
 	vert.updateBar(true);
-	if (_st.hiding) {
-		connect(this, SIGNAL(scrolled()), this, SLOT(onScrolled()));
-	}
+	connect(this, SIGNAL(scrolled()), this, SLOT(onScrolled()));
+
+	_frameTimer.setSingleShot(true);
+	_frameTimer.setInterval(ScrollFrameTimeout);
+	connect(&_frameTimer, SIGNAL(timeout()), this, SLOT(onScrolledFrame()));
 
 	setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 	setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
@@ -292,6 +295,15 @@ void ScrollArea::touchDeaccelerate(int32 elapsed) {
 }
 
 void ScrollArea::onScrolled() {
+	if (!_frameTimer.isActive()) {
+		if (!_frameTime) { // scrolling started, measure speed from the previous position
+			_frameTop = _vertValue;
+			_frameTime = getms(true);
+		}
+		_frameTimer.start();
+	}
+	++_frameScrolls;
+
 	int32 horValue = horizontalScrollBar()->value(), vertValue = verticalScrollBar()->value();
 	if (_horValue != horValue) {
 		_horValue = horValue;
@@ -307,6 +319,33 @@ void ScrollArea::onScrolled() {
 	}
 }
 
+void ScrollArea::onScrolledFrame() {
+	uint64 ms = getms(true);
+	int32 top = scrollTop();
+	_scrollSpeed = int32(int64(top - _frameTop) * 1000 / int64(qMax(ms - _frameTime, uint64(1))));
+	_frameTop = top;
+	_frameTime = ms;
+	if (_frameScrolls) {
+		static MetricHandle scrollEventsPerFrameMetric = metricHistogram(qsl("scroll.events_per_frame"));
+		metricSample(scrollEventsPerFrameMetric, _frameScrolls);
+		_frameScrolls = 0;
+	}
+
+	emit scrolledFrame();
+	static MetricHandle scrollFrameMsMetric = metricHistogram(qsl("scroll.frame_ms"));
+	metricSample(scrollFrameMsMetric, getms(true) - ms);
+
+	if (_scrollSpeed) {
+		_frameTimer.start(); // one more frame to notice that scrolling has stopped
+	} else {
+		_frameTime = 0;
+	}
+}
+
+int32 ScrollArea::scrollSpeed() const {
+	return _scrollSpeed;
+}
+
 int ScrollArea::scrollWidth() const {
 	return scrollLeftMax() + width();
 }
@@ -593,6 +632,10 @@ void ScrollArea::scrollToY(int toTop, int toBottom) {
 		scToTop = toTop;
 	}
 	verticalScrollBar()->setValue(scToTop);
+
+	_frameTop = scrollTop(); // a jump is not scrolling speed, measure from here
+	_frameTime = getms(true);
+	_scrollSpeed = 0;
 }
 
 void ScrollArea::setWidget(QWidget *w) {
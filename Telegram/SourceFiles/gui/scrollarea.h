@@ -124,6 +124,7 @@ public:
 	int scrollTopMax() const;
 	int scrollLeft() const;
 	int scrollTop() const;
+	int32 scrollSpeed() const; // px per second, positive when scrolling down, 0 when settled
 
 	void setWidget(QWidget *widget);
 
@@ -139,9 +140,12 @@ public slots:
 	void onTouchTimer();
 	void onTouchScrollTimer();
 
+	void onScrolledFrame();
+
 signals:
 
 	void scrolled();
+	void scrolledFrame(); // emitted at most once per ScrollFrameTimeout and once more when scrolling stops
 	void scrollStarted();
 	void scrollFinished();
 	void geometryChanged();
@@ -161,6 +165,10 @@ private:
 	ScrollShadow topSh, bottomSh;
 	int32 _horValue, _vertValue;
 
+	QTimer _frameTimer;
+	int32 _frameTop, _frameScrolls, _scrollSpeed;
+	uint64 _frameTime;
+
 	bool _touchEnabled;
 	QTimer _touchTimer;
 	bool _touchScroll, _touchPress, _touchRightButton;
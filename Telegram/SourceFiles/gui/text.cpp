@@ -515,21 +515,14 @@ public:
 	}
 
 	void parseEmojiFromCurrent() {
-		const EmojiData *e = getEmoji(chInt);
+		if (ptr >= end) return;
+
+		int32 emojiLen = 0, parsedLen = (chInt >> 16) ? 2 : 1; // ptr is at the last char of chInt
+		const EmojiData *e = emojiFromText(ptr + 1 - parsedLen, end, &emojiLen);
 		if (!e) return;
 
-		if (e->len > 2) {
-			if (ptr + 2 >= end || e->code2 != ((uint32((ptr + 1)->unicode()) << 16) | uint32((ptr + 2)->unicode()))) {
-				return;
-			} else {
-				_t->_text.push_back(*++ptr);
-				_t->_text.push_back(*++ptr);
-			}
-		}
-		int emojiLen = e->len;
-		if (ptr + 1 < end && (ptr + 1)->unicode() == 0xFE0F) {
+		for (int32 i = parsedLen; i < emojiLen; ++i) {
 			_t->_text.push_back(*++ptr);
-			++emojiLen;
 		}
 
 		createBlock(-emojiLen);
@@ -4047,29 +4040,14 @@ bool textSplit(QString &sendingText, QString &leftText, int32 limit) {
 				}
 			}
 		}
-		EmojiPtr e = 0;
-		if (ch->isHighSurrogate()) {
-			if (ch + 1 < end && (ch + 1)->isLowSurrogate()) {
-				e = getEmoji((ch->unicode() << 16) | (ch + 1)->unicode());
-				if (!e) {
-					++ch;
-				}
-			}
-		} else {
-			if (ch + 1 < end) {
-				if (((ch->unicode() >= 48 && ch->unicode() < 58) || ch->unicode() == 35) && (ch + 1)->unicode() == 0x20E3) {
-					e = getEmoji((ch->unicode() << 16) | (ch + 1)->unicode());
-				} else if ((ch + 1)->unicode() == 0xFE0F) {
-					e = getEmoji(ch->unicode());
-				}
-			}
-		}
-		if (e) {
-			ch += (e->len - 1);
-			if (ch + 1 < end && (ch + 1)->unicode() == 0xFE0F) {
-				++ch;
+		int32 emojiLen = 0;
+		if (EmojiPtr e = emojiFromText(ch, end, &emojiLen)) {
+			ch += (emojiLen - 1);
+			if (emojiLen > e->len) { // 0xFE0F postfix
 				++s;
 			}
+		} else if (ch->isHighSurrogate() && ch + 1 < end && (ch + 1)->isLowSurrogate()) {
+			++ch;
 		}
 		if (s >= limit) {
 			sendingText = leftText.mid(0, good - start);
@@ -133,11 +133,40 @@ void stopGif() {
 	animated.stop();
 }
 
+void preloadNextVoice(AudioData *audio) {
+	if (!audioVoice()) return;
+
+	const AudioItems &items(App::audioItems());
+	AudioItems::const_iterator i = items.constFind(audio);
+	if (i == items.cend() || i.value().isEmpty()) return;
+
+	HistoryItem *item = i.value().cbegin().key();
+	if (item->detached()) return;
+
+	History *history = item->history();
+	int32 blockIndex = history->indexOf(item->block()), itemIndex = item->block()->indexOf(item);
+	if (blockIndex < 0 || itemIndex < 0) return;
+
+	for (; blockIndex < history->size(); ++blockIndex, itemIndex = -1) {
+		HistoryBlock *block = (*history)[blockIndex];
+		for (++itemIndex; itemIndex < block->size(); ++itemIndex) {
+			HistoryMedia *media = (*block)[itemIndex]->getMedia();
+			if (media && media->type() == MediaTypeAudio) {
+				AudioData *next = static_cast<HistoryAudio*>(media)->audio();
+				if (next->mime != QLatin1String("audio/mp3")) {
+					audioVoice()->preload(next);
+				}
+				return;
+			}
+		}
+	}
+}
+
 void DialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
 	QRect fullRect(0, 0, w, st::dlgHeight);
 	p.fillRect(fullRect, (act ? st::dlgActiveBG : (sel ? st::dlgHoverBG : st::dlgBG))->b);
 	
-	p.drawPixmap(st::dlgPaddingHor, st::dlgPaddingVer, history->peer->photo->pix(st::dlgPhotoSize));
+	history->peer->photo->paintSmall(p, st::dlgPaddingHor, st::dlgPaddingVer, st::dlgPhotoSize);
 
 	int32 nameleft = st::dlgPaddingHor + st::dlgPhotoSize + st::dlgPhotoPadding;
 	int32 namewidth = w - nameleft - st::dlgPaddingHor;
@@ -227,7 +256,7 @@ void FakeDialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
 
 	History *history = _item->history();
 
-	p.drawPixmap(st::dlgPaddingHor, st::dlgPaddingVer, history->peer->photo->pix(st::dlgPhotoSize));
+	history->peer->photo->paintSmall(p, st::dlgPaddingHor, st::dlgPaddingVer, st::dlgPhotoSize);
 
 	int32 nameleft = st::dlgPaddingHor + st::dlgPhotoSize + st::dlgPhotoPadding;
 	int32 namewidth = w - nameleft - st::dlgPaddingHor;
@@ -1655,6 +1684,8 @@ void HistoryPhoto::updateFrom(const MTPMessageMedia &media) {
 	if (media.type() == mtpc_messageMediaPhoto) {
 		const MTPPhoto &photo(media.c_messageMediaPhoto().vphoto);
 		if (photo.type() == mtpc_photo) {
+			if (App::uploader()) App::uploader()->mediaSent(data->id, media);
+
 			const QVector<MTPPhotoSize> &sizes(photo.c_photo().vsizes.c_vector().v);
 			for (QVector<MTPPhotoSize>::const_iterator i = sizes.cbegin(), e = sizes.cend(); i != e; ++i) {
 				char size = 0;
@@ -2612,6 +2643,7 @@ void HistoryDocument::unregItem(HistoryItem *item) {
 
 void HistoryDocument::updateFrom(const MTPMessageMedia &media) {
 	if (media.type() == mtpc_messageMediaDocument) {
+		if (App::uploader()) App::uploader()->mediaSent(data->id, media);
 		App::feedDocument(media.c_messageMediaDocument().vdocument, data);
 	}
 }
@@ -2898,6 +2930,7 @@ void HistorySticker::unregItem(HistoryItem *item) {
 
 void HistorySticker::updateFrom(const MTPMessageMedia &media) {
 	if (media.type() == mtpc_messageMediaDocument) {
+		if (App::uploader()) App::uploader()->mediaSent(data->id, media);
 		App::feedDocument(media.c_messageMediaDocument().vdocument, data);
 		if (App::main()) App::main()->incrementSticker(data);
 	}
@@ -4484,7 +4517,7 @@ void HistoryMessage::draw(QPainter &p, uint32 selection) const {
 	}
 
 	if (!out() && _history->peer->chat) {
-		p.drawPixmap(left, _height - st::msgMargin.bottom() - st::msgPhotoSize, _from->photo->pix(st::msgPhotoSize));
+		_from->photo->paintSmall(p, left, _height - st::msgMargin.bottom() - st::msgPhotoSize, st::msgPhotoSize);
 //		width -= st::msgPhotoSkip;
 		left += st::msgPhotoSkip;
 	}
@@ -26,6 +26,9 @@ void itemRemovedGif(HistoryItem *item);
 void itemReplacedGif(HistoryItem *oldItem, HistoryItem *newItem);
 void stopGif();
 
+struct AudioData;
+void preloadNextVoice(AudioData *audio);
+
 static const uint32 FullItemSel = 0xFFFFFFFF;
 
 typedef QMap<int32, HistoryItem*> SelectedItemSet;
@@ -551,6 +554,20 @@ struct DialogsIndexed {
 		}
 	}
 
+	DialogsList *filterList(const QStringList &words) const { // smallest first char list that may contain all the words
+		if (!list.count) return 0;
+
+		DialogsList *result = 0;
+		for (QStringList::const_iterator i = words.cbegin(), e = words.cend(); i != e; ++i) {
+			DialogsIndex::const_iterator j = index.constFind(i->at(0));
+			if (j == index.cend()) return 0;
+			if (!result || result->count > j.value()->count) {
+				result = j.value();
+			}
+		}
+		return result;
+	}
+
 	~DialogsIndexed() {
 		clear();
 	}
@@ -957,6 +974,10 @@ public:
 	void regItem(HistoryItem *item);
 	void unregItem(HistoryItem *item);
 
+	AudioData *audio() const {
+		return data;
+	}
+
 private:
 	AudioData *data;
 	TextLinkPtr _openl, _savel, _cancell;
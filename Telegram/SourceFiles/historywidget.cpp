@@ -56,7 +56,9 @@ HistoryList::HistoryList(HistoryWidget *historyWidget, ScrollArea *scroll, Histo
     , _touchSpeedTime(0)
     , _touchAccelerationTime(0)
     , _touchTime(0)
-    , _menu(0) {
+    , _menu(0)
+    , _cachedMemory(0)
+    , _cachedTick(0) {
 
 	linkTipTimer.setSingleShot(true);
 	connect(&linkTipTimer, SIGNAL(timeout()), this, SLOT(showLinkTip()));
@@ -80,6 +82,7 @@ void HistoryList::messagesReceivedDown(const QVector<MTPMessage> &messages) {
 }
 
 void HistoryList::updateMsg(const HistoryItem *msg) {
+	if (msg) clearCached(msg);
 	if (!msg || msg->detached() || !hist || hist != msg->history()) return;
 	update(0, height() - hist->height - st::historyPadding + msg->block()->y + msg->y, width(), msg->height());
 }
@@ -97,6 +100,9 @@ void HistoryList::paintEvent(QPaintEvent *e) {
 		QPoint dogPos((width() - st::msgDogImg.pxWidth()) / 2, ((height() - st::msgDogImg.pxHeight()) * 4) / 9);
 		p.drawPixmap(dogPos, *cChatDogImage());
 	} else {
+		uint64 paintStart = getms(true);
+		int32 cachedItems = 0;
+
 		adjustCurrent(r.top());
 		HistoryBlock *block = (*hist)[currentBlock];
 		HistoryItem *item = (*block)[currentItem];
@@ -125,7 +131,11 @@ void HistoryList::paintEvent(QPaintEvent *e) {
 					sel = i.value();
 				}
 			}
-			item->draw(p, sel);
+			if (drawCached(p, item, sel)) {
+				++cachedItems;
+			} else {
+				item->draw(p, sel);
+			}
 			p.translate(0, h);
 			++iItem;
 			if (iItem == block->size()) {
@@ -139,6 +149,85 @@ void HistoryList::paintEvent(QPaintEvent *e) {
 			item = (*block)[iItem];
 			y += h;
 		}
+
+		static MetricHandle historyPaintMsMetric = metricHistogram(qsl("history.paint_ms"));
+		static MetricHandle historyPaintCachedMetric = metricHistogram(qsl("history.paint_cached_items"));
+		metricSample(historyPaintMsMetric, getms(true) - paintStart);
+		metricSample(historyPaintCachedMetric, cachedItems);
+	}
+}
+
+bool HistoryList::drawCached(QPainter &p, const HistoryItem *item, uint32 selection) {
+	if (HistoryItemsCacheMemory <= 0) return false;
+	if (item->itemType() != HistoryItem::MsgType || item->getMedia() || item->toHistoryReply() || item->animating()) return false;
+	if (item->id == hist->activeMsgId || item == _dragItem) return false;
+	if (item == App::hoveredItem() || item == App::pressedItem() || item == App::hoveredLinkItem() || item == App::pressedLinkItem() || item == App::mousedItem()) return false;
+
+	int32 w = hist->width, h = item->height();
+	if (w <= 0 || h <= 0 || w * h * cIntRetinaFactor() * cIntRetinaFactor() * 4 > HistoryItemsCacheMemory / 8) return false;
+
+	UserData *from = item->from();
+	const HistoryForwarded *fwd = item->toHistoryForwarded();
+	int32 fwdNameVersion = fwd ? fwd->fromForwarded()->nameVersion : 0;
+	const Image *photo = from->photo.v();
+	bool photoLoaded = photo->loaded(), unread = item->unread();
+
+	CachedItems::iterator i = _cached.find(item);
+	if (i != _cached.cend()) {
+		const CachedItem &c(i.value());
+		if (c.width != w || c.height != h || c.id != item->id || c.selection != selection || c.unread != unread || c.photo != photo || c.photoLoaded != photoLoaded || c.nameVersion != from->nameVersion || c.fwdNameVersion != fwdNameVersion) {
+			clearCached(i);
+			i = _cached.end();
+		}
+	}
+	if (i == _cached.cend()) {
+		CachedItem c;
+		c.pix = QPixmap(w * cIntRetinaFactor(), h * cIntRetinaFactor());
+		c.pix.fill(Qt::transparent); // does not depend on the scroll position, composited over the background
+		if (cRetina()) c.pix.setDevicePixelRatio(cRetinaFactor());
+		{
+			QPainter cp(&c.pix);
+			item->draw(cp, selection);
+		}
+		c.width = w;
+		c.height = h;
+		c.id = item->id;
+		c.selection = selection;
+		c.unread = unread;
+		c.photo = photo;
+		c.photoLoaded = photoLoaded;
+		c.nameVersion = from->nameVersion; // draw() may update the cached names
+		c.fwdNameVersion = fwdNameVersion;
+		_cachedMemory += c.pix.width() * c.pix.height() * 4;
+		while (_cachedMemory > HistoryItemsCacheMemory && !_cachedOrder.isEmpty()) { // evict least recently painted items
+			clearCached(_cached.find(_cachedOrder.cbegin().value()));
+		}
+		i = _cached.insert(item, c);
+	} else {
+		_cachedOrder.remove(i.value().tick);
+	}
+	i.value().tick = ++_cachedTick;
+	_cachedOrder.insert(i.value().tick, item);
+	p.drawPixmap(0, 0, i.value().pix);
+	return true;
+}
+
+void HistoryList::clearCached(CachedItems::iterator i) {
+	_cachedMemory -= i.value().pix.width() * i.value().pix.height() * 4;
+	_cachedOrder.remove(i.value().tick);
+	_cached.erase(i);
+}
+
+void HistoryList::clearCached(const HistoryItem *item) {
+	if (item) {
+		CachedItems::iterator i = _cached.find(item);
+		if (i != _cached.cend()) {
+			clearCached(i);
+		}
+	} else {
+		_cached.clear();
+		_cachedOrder.clear();
+		_cachedMemory = 0;
 	}
 }
 
@@ -466,6 +555,8 @@ void HistoryList::dragActionCancel() {
 }
 
 void HistoryList::itemRemoved(HistoryItem *item) {
+	clearCached(item);
+
 	SelectedItems::iterator i = _selected.find(item);
 	if (i != _selected.cend()) {
 		_selected.erase(i);
@@ -486,6 +577,7 @@ void HistoryList::itemRemoved(HistoryItem *item) {
 }
 
 void HistoryList::itemReplaced(HistoryItem *oldItem, HistoryItem *newItem) {
+	clearCached(oldItem);
 	if (_dragItem == oldItem) _dragItem = newItem;
 
 	SelectedItems::iterator i = _selected.find(oldItem);
@@ -862,6 +954,7 @@ void HistoryList::copyContextText() {
 }
 
 void HistoryList::resizeEvent(QResizeEvent *e) {
+	clearCached();
 	onUpdateSelected();
 }
 
@@ -1610,7 +1703,7 @@ HistoryWidget::HistoryWidget(QWidget *parent) : QWidget(parent)
 
 	setAcceptDrops(true);
 
-	connect(&_scroll, SIGNAL(scrolled()), this, SLOT(onListScroll()));
+	connect(&_scroll, SIGNAL(scrolledFrame()), this, SLOT(onListScroll()));
 	connect(&_toHistoryEnd, SIGNAL(clicked()), this, SLOT(onHistoryToEnd()));
 	connect(&_replyForwardPreviewCancel, SIGNAL(clicked()), this, SLOT(onReplyForwardPreviewCancel()));
 	connect(&_send, SIGNAL(clicked()), this, SLOT(onSend()));
@@ -1862,23 +1955,12 @@ void HistoryWidget::stickersGot(const MTPmessages_AllStickers &stickers) {
 				QString emoticon(qs(p.vemoticon));
 				EmojiPtr e = 0;
 				for (const QChar *ch = emoticon.constData(), *end = emoticon.constEnd(); ch != end; ++ch) {
-					if (ch->isHighSurrogate()) {
-						if (ch + 1 < end && (ch + 1)->isLowSurrogate()) {
-							e = getEmoji((ch->unicode() << 16) | (ch + 1)->unicode());
-							if (!e) {
-								++ch;
-							}
-						}
-					} else {
-						if (ch + 1 < end) {
-							if (((ch->unicode() >= 48 && ch->unicode() < 58) || ch->unicode() == 35) && (ch + 1)->unicode() == 0x20E3) {
-								e = getEmoji((ch->unicode() << 16) | (ch + 1)->unicode());
-							} else if ((ch + 1)->unicode() == 0xFE0F) {
-								e = getEmoji(ch->unicode());
-							}
-						}
-					}
+					e = emojiFromText(ch, end);
 					if (e) break;
+
+					if (ch->isHighSurrogate() && ch + 1 < end && (ch + 1)->isLowSurrogate()) {
+						++ch;
+					}
 				}
 				if (e) {
 					const QVector<MTPlong> docs(p.vdocuments.c_vector().v);
@@ -2519,11 +2601,12 @@ void HistoryWidget::onListScroll() {
 	}
 
 	int st = _scroll.scrollTop(), stm = _scroll.scrollTopMax(), sh = _scroll.height();
-	if (hist->readyForWork() && (st + PreloadHeightsCount * sh > stm)) {
+	int preload = qMax(int(PreloadHeightsCount) * sh, qMin(int(PreloadSpeedHeightsCount) * sh, int(qAbs(_scroll.scrollSpeed())))); // up to one second of scrolling ahead
+	if (hist->readyForWork() && (st + preload > stm)) {
 		loadMessagesDown();
 	}
 
-	if (!hist->readyForWork() || st < PreloadHeightsCount * sh) {
+	if (!hist->readyForWork() || st < preload) {
 		loadMessages();
 	} else {
 		checkUnreadLoaded(true);
@@ -2623,7 +2706,7 @@ void HistoryWidget::shareContact(const PeerId &peer, const QString &phone, const
 		sendFlags |= MTPmessages_SendMedia::flag_reply_to_msg_id;
 	}
 	h->addToBack(MTP_message(MTP_int(flags), MTP_int(newId), MTP_int(MTP::authedId()), App::peerToMTP(peer), MTPint(), MTPint(), MTP_int(_replyToId), MTP_int(unixtime()), MTP_string(""), MTP_messageMediaContact(MTP_string(phone), MTP_string(fname), MTP_string(lname), MTP_int(userId))));
-	h->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), p->input, MTP_int(replyTo), MTP_inputMediaContact(MTP_string(phone), MTP_string(fname), MTP_string(lname)), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+	h->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), p->input, MTP_int(replyTo), MTP_inputMediaContact(MTP_string(phone), MTP_string(fname), MTP_string(lname)), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId, MTPRequestInteractive);
 
 	App::historyRegRandom(randomId, newId);
 
@@ -3199,6 +3282,24 @@ void HistoryWidget::confirmSendImage(const ReadyLocalMedia &img) {
 	}
 	MsgId newId = clientMsgId();
 
+	if (img.reused) {
+		MTPInputMedia input(MTP_inputMediaEmpty());
+		if (img.type == ToPreparePhoto) {
+			const MTPDphoto &photo(img.photo.c_photo());
+			input = MTP_inputMediaPhoto(MTP_inputPhoto(photo.vid, photo.vaccess_hash));
+		} else {
+			const MTPDdocument &document(img.document.c_document());
+			input = MTP_inputMediaDocument(MTP_inputDocument(document.vid, document.vaccess_hash));
+		}
+		addPreparedMedia(newId, img);
+		if (HistoryItem *item = App::histItemById(newId)) {
+			uint64 randomId = MTP::nonce<uint64>();
+			_reusedMedias.insert(randomId, img);
+			sendMediaMessage(item, input, randomId, rpcDone(&HistoryWidget::sendReusedDone, randomId), rpcFail(&HistoryWidget::sendReusedFailed, randomId));
+		}
+		return;
+	}
+
 	connect(App::uploader(), SIGNAL(photoReady(MsgId, const MTPInputFile &)), this, SLOT(onPhotoUploaded(MsgId, const MTPInputFile &)), Qt::UniqueConnection);
 	connect(App::uploader(), SIGNAL(documentReady(MsgId, const MTPInputFile &)), this, SLOT(onDocumentUploaded(MsgId, const MTPInputFile &)), Qt::UniqueConnection);
 	connect(App::uploader(), SIGNAL(thumbDocumentReady(MsgId, const MTPInputFile &, const MTPInputFile &)), this, SLOT(onThumbDocumentUploaded(MsgId, const MTPInputFile &, const MTPInputFile &)), Qt::UniqueConnection);
@@ -3209,17 +3310,17 @@ void HistoryWidget::confirmSendImage(const ReadyLocalMedia &img) {
 
 	App::uploader()->uploadMedia(newId, img);
 
+	addPreparedMedia(newId, img);
+}
+
+void HistoryWidget::addPreparedMedia(MsgId newId, const ReadyLocalMedia &img) {
 	History *h = App::history(img.peer);
-	if (img.type == ToPreparePhoto) {
+	if (img.type == ToPreparePhoto || img.type == ToPrepareDocument) {
 		h->loadAround(0);
 		int32 flags = (h->peer->input.type() == mtpc_inputPeerSelf) ? 0 : (MTPDmessage_flag_unread | MTPDmessage_flag_out); // unread, out
 		if (img.replyTo) flags |= MTPDmessage::flag_reply_to_msg_id;
-		h->addToBack(MTP_message(MTP_int(flags), MTP_int(newId), MTP_int(MTP::authedId()), App::peerToMTP(img.peer), MTPint(), MTPint(), MTP_int(img.replyTo), MTP_int(unixtime()), MTP_string(""), MTP_messageMediaPhoto(img.photo)));
-	} else if (img.type == ToPrepareDocument) {
-		h->loadAround(0);
-		int32 flags = (h->peer->input.type() == mtpc_inputPeerSelf) ? 0 : (MTPDmessage_flag_unread | MTPDmessage_flag_out); // unread, out
-		if (img.replyTo) flags |= MTPDmessage::flag_reply_to_msg_id;
-		h->addToBack(MTP_message(MTP_int(flags), MTP_int(newId), MTP_int(MTP::authedId()), App::peerToMTP(img.peer), MTPint(), MTPint(), MTP_int(img.replyTo), MTP_int(unixtime()), MTP_string(""), MTP_messageMediaDocument(img.document)));
+		MTPMessageMedia media((img.type == ToPreparePhoto) ? MTP_messageMediaPhoto(img.photo) : MTP_messageMediaDocument(img.document));
+		h->addToBack(MTP_message(MTP_int(flags), MTP_int(newId), MTP_int(MTP::authedId()), App::peerToMTP(img.peer), MTPint(), MTPint(), MTP_int(img.replyTo), MTP_int(unixtime()), MTP_string(""), media));
 	}
 
 	if (hist && histPeer && img.peer == histPeer->id) {
@@ -3229,6 +3330,43 @@ void HistoryWidget::confirmSendImage(const ReadyLocalMedia &img) {
 	peerMessagesUpdated(img.peer);
 }
 
+void HistoryWidget::sendMediaMessage(HistoryItem *item, const MTPInputMedia &media, uint64 randomId, const RPCDoneHandlerPtr &onDone, const RPCFailHandlerPtr &onFail) {
+	App::historyRegRandom(randomId, item->id);
+	History *hist = item->history();
+	MsgId replyTo = item->toHistoryReply() ? item->toHistoryReply()->replyToId() : 0;
+	int32 sendFlags = 0;
+	if (replyTo) {
+		sendFlags |= MTPmessages_SendMedia::flag_reply_to_msg_id;
+	}
+	hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), hist->peer->input, MTP_int(replyTo), media, MTP_long(randomId)), onDone, onFail, 0, 0, hist->sendRequestId, MTPRequestInteractive);
+}
+
+void HistoryWidget::sendReusedDone(uint64 randomId, const MTPUpdates &updates) {
+	_reusedMedias.remove(randomId);
+	if (App::main()) App::main()->sentUpdatesReceived(updates);
+}
+
+bool HistoryWidget::sendReusedFailed(uint64 randomId, const RPCError &error) {
+	if (mtpIsFlood(error)) return false;
+
+	ReusedMedias::iterator i = _reusedMedias.find(randomId);
+	if (i == _reusedMedias.end()) return false;
+
+	ReadyLocalMedia media(i.value());
+	_reusedMedias.erase(i);
+
+	Local::removeSentMedia(media.contentKey);
+	if (HistoryItem *item = App::histItemById(App::histItemByRandom(randomId))) {
+		item->destroy();
+	}
+	if (!media.file.isEmpty()) { // upload the same content again as a new file
+		imageLoader.append(QStringList(media.file), media.peer, media.replyTo, media.type, media.ctrlShiftEnter);
+	} else if (!media.data.isEmpty()) {
+		imageLoader.append(media.data, media.peer, media.replyTo, media.type, media.ctrlShiftEnter);
+	}
+	return true;
+}
+
 void HistoryWidget::cancelSendImage() {
 	if (confirmImageId && confirmWithText) setFieldText(QString());
 	confirmImageId = 0;
@@ -3243,14 +3381,7 @@ void HistoryWidget::onPhotoUploaded(MsgId newId, const MTPInputFile &file) {
 		//App::main()->readServerHistory(item->history(), false);
 
 		uint64 randomId = MTP::nonce<uint64>();
-		App::historyRegRandom(randomId, newId);
-		History *hist = item->history();
-		MsgId replyTo = item->toHistoryReply() ? item->toHistoryReply()->replyToId() : 0;
-		int32 sendFlags = 0;
-		if (replyTo) {
-			sendFlags |= MTPmessages_SendMedia::flag_reply_to_msg_id;
-		}
-		hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), item->history()->peer->input, MTP_int(replyTo), MTP_inputMediaUploadedPhoto(file), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), App::main()->rpcFail(&MainWidget::sendPhotoFailed, randomId), 0, 0, hist->sendRequestId);
+		sendMediaMessage(item, MTP_inputMediaUploadedPhoto(file), randomId, App::main()->rpcDone(&MainWidget::sentUpdatesReceived), App::main()->rpcFail(&MainWidget::sendPhotoFailed, randomId));
 	}
 }
 
@@ -3282,15 +3413,7 @@ void HistoryWidget::onDocumentUploaded(MsgId newId, const MTPInputFile &file) {
 		if (document) {
 			//App::main()->readServerHistory(item->history(), false);
 
-			uint64 randomId = MTP::nonce<uint64>();
-			App::historyRegRandom(randomId, newId);
-			History *hist = item->history();
-			MsgId replyTo = item->toHistoryReply() ? item->toHistoryReply()->replyToId() : 0;
-			int32 sendFlags = 0;
-			if (replyTo) {
-				sendFlags |= MTPmessages_SendMedia::flag_reply_to_msg_id;
-			}
-			hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), item->history()->peer->input, MTP_int(replyTo), MTP_inputMediaUploadedDocument(file, MTP_string(document->mime), _composeDocumentAttributes(document)), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+			sendMediaMessage(item, MTP_inputMediaUploadedDocument(file, MTP_string(document->mime), _composeDocumentAttributes(document)), MTP::nonce<uint64>(), App::main()->rpcDone(&MainWidget::sentUpdatesReceived));
 		}
 	}
 }
@@ -3308,15 +3431,7 @@ void HistoryWidget::onThumbDocumentUploaded(MsgId newId, const MTPInputFile &fil
 		if (document) {
 			//App::main()->readServerHistory(item->history(), false);
 
-			uint64 randomId = MTP::nonce<uint64>();
-			App::historyRegRandom(randomId, newId);
-			History *hist = item->history();
-			MsgId replyTo = item->toHistoryReply() ? item->toHistoryReply()->replyToId() : 0;
-			int32 sendFlags = 0;
-			if (replyTo) {
-				sendFlags |= MTPmessages_SendMedia::flag_reply_to_msg_id;
-			}
-			hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), item->history()->peer->input, MTP_int(replyTo), MTP_inputMediaUploadedThumbDocument(file, thumb, MTP_string(document->mime), _composeDocumentAttributes(document)), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+			sendMediaMessage(item, MTP_inputMediaUploadedThumbDocument(file, thumb, MTP_string(document->mime), _composeDocumentAttributes(document)), MTP::nonce<uint64>(), App::main()->rpcDone(&MainWidget::sentUpdatesReceived));
 		}
 	}
 }
@@ -3598,7 +3713,7 @@ void HistoryWidget::onStickerSend(DocumentData *sticker) {
 	}
 	hist->addToBackDocument(newId, flags, _replyToId, date(MTP_int(unixtime())), MTP::authedId(), sticker);
 
-	hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), histPeer->input, MTP_int(_replyToId), MTP_inputMediaDocument(MTP_inputDocument(MTP_long(sticker->id), MTP_long(sticker->access))), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+	hist->sendRequestId = MTP::send(MTPmessages_SendMedia(MTP_int(sendFlags), histPeer->input, MTP_int(_replyToId), MTP_inputMediaDocument(MTP_inputDocument(MTP_long(sticker->id), MTP_long(sticker->access))), MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId, MTPRequestInteractive);
 	App::main()->finishForwarding(hist);
 	cancelReply();
 
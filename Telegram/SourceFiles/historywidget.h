@@ -115,6 +115,9 @@ private:
 	void updateDragSelection(HistoryItem *dragSelFrom, HistoryItem *dragSelTo, bool dragSelecting, bool force = false);
 	void applyDragSelection();
 
+	bool drawCached(QPainter &p, const HistoryItem *item, uint32 selection);
+	void clearCached(const HistoryItem *item = 0);
+
 	History *hist;
 	HistoryWidget *historyWidget;
 	ScrollArea *scrollArea;
@@ -159,6 +162,27 @@ private:
 
 	ContextMenu *_menu;
 
+	struct CachedItem {
+		CachedItem() : width(0), height(0), id(0), selection(0), unread(false), photo(0), photoLoaded(false), nameVersion(0), fwdNameVersion(0), tick(0) {
+		}
+		QPixmap pix;
+		int32 width, height, id;
+		uint32 selection;
+		bool unread;
+		const Image *photo;
+		bool photoLoaded;
+		int32 nameVersion, fwdNameVersion;
+		uint64 tick;
+	};
+	typedef QMap<const HistoryItem*, CachedItem> CachedItems;
+	CachedItems _cached;
+	typedef QMap<uint64, const HistoryItem*> CachedOrder;
+	CachedOrder _cachedOrder; // tick -> item, least recently painted first
+	int32 _cachedMemory;
+	uint64 _cachedTick;
+
+	void clearCached(CachedItems::iterator i);
+
 };
 
 class MessageField : public FlatTextarea {
@@ -473,6 +497,14 @@ private:
 	void stickersGot(const MTPmessages_AllStickers &stickers);
 	bool stickersFailed(const RPCError &error);
 
+	typedef QMap<uint64, ReadyLocalMedia> ReusedMedias;
+	ReusedMedias _reusedMedias; // random id -> media sent without upload, uploaded if the server media can't be used anymore
+	void sendReusedDone(uint64 randomId, const MTPUpdates &updates);
+	bool sendReusedFailed(uint64 randomId, const RPCError &error);
+
+	void addPreparedMedia(MsgId newId, const ReadyLocalMedia &img); // adds the local message for a prepared photo or document
+	void sendMediaMessage(HistoryItem *item, const MTPInputMedia &media, uint64 randomId, const RPCDoneHandlerPtr &onDone, const RPCFailHandlerPtr &onFail = RPCFailHandlerPtr());
+
 	uint64 _lastStickersUpdate;
 	mtpRequestId _stickersUpdateRequest;
 
@@ -18,8 +18,53 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "stdafx.h"
 #include "localimageloader.h"
 #include "gui/filedialog.h"
+#include "localstorage.h"
 #include <libexif/exif-data.h>
 
+namespace {
+	// in-memory data is hashed in full, files only by their first and last parts,
+	// so a key match for a file is confirmed by _contentSame()
+	MediaKey _contentKey(ToPrepareMediaType type, const QString &file, const QByteArray &data, int32 filesize) {
+		HashMd5 md5;
+		if (!data.isEmpty()) {
+			md5.feed(data.constData(), data.size());
+		} else if (!file.isEmpty()) {
+			QFile f(file);
+			if (!f.open(QIODevice::ReadOnly)) return MediaKey(0, 0);
+
+			QByteArray part = f.read(SentMediaKeyPartSize);
+			md5.feed(part.constData(), part.size());
+			if (f.size() > 2 * SentMediaKeyPartSize) {
+				if (!f.seek(f.size() - SentMediaKeyPartSize)) return MediaKey(0, 0);
+				part = f.read(SentMediaKeyPartSize);
+			} else {
+				part = f.readAll();
+			}
+			md5.feed(part.constData(), part.size());
+		} else {
+			return MediaKey(0, 0);
+		}
+		const uint64 *hash = (const uint64*)md5.result();
+		return MediaKey(hash[0] ^ uint64(type), hash[1] ^ uint64(uint32(filesize)));
+	}
+
+	bool _contentSame(const QString &file, const FileLocation &sentFrom, const QByteArray &sentMd5) {
+		if (file.isEmpty()) return sentFrom.name.isEmpty(); // in-memory data keys are full hashes
+		if (sentFrom.name == file && sentFrom.check()) return true; // the same file was not changed since it was sent
+		if (sentMd5.size() != 16) return false;
+
+		QFile f(file); // a copy of the sent file, the full hash is needed only here
+		if (!f.open(QIODevice::ReadOnly)) return false;
+
+		HashMd5 md5;
+		QByteArray part;
+		while (!(part = f.read(DocumentUploadPartSize4)).isEmpty()) {
+			md5.feed(part.constData(), part.size());
+		}
+		return !memcmp(md5.result(), sentMd5.constData(), 16);
+	}
+}
+
 LocalImageLoaderPrivate::LocalImageLoaderPrivate(int32 currentUser, LocalImageLoader *loader, QThread *thread) : QObject(0)
     , loader(loader)
     , user(currentUser)
@@ -42,6 +87,8 @@ void LocalImageLoaderPrivate::prepareImages() {
 	bool animated = false;
 	bool ctrlShiftEnter = false;
 	MsgId replyTo = 0;
+	bool withConfirm = false;
+	uint64 seq = 0;
 	{
 		QMutexLocker lock(loader->toPrepareMutex());
 		ToPrepareMedias &list(loader->toPrepareMedias());
@@ -55,6 +102,8 @@ void LocalImageLoaderPrivate::prepareImages() {
 		type = list.front().type;
 		ctrlShiftEnter = list.front().ctrlShiftEnter;
 		replyTo = list.front().replyTo;
+		withConfirm = list.front().withConfirm;
+		seq = loader->takeToPrepare();
 	}
 
 	if (img.isNull()) {
@@ -136,16 +185,49 @@ void LocalImageLoaderPrivate::prepareImages() {
 		}
 	}
 
-	if ((img.isNull() && (type != ToPrepareDocument || !filesize)) || type == ToPrepareAuto || (img.isNull() && file.isEmpty() && data.isEmpty())) { // if could not decide what type
-		{
-			QMutexLocker lock(loader->toPrepareMutex());
-			ToPrepareMedias &list(loader->toPrepareMedias());
-			list.pop_front();
+	bool failed = (img.isNull() && (type != ToPrepareDocument || !filesize)) || type == ToPrepareAuto || (img.isNull() && file.isEmpty() && data.isEmpty()); // if could not decide what type
+
+	MediaKey contentKey(0, 0);
+	FileLocation contentLocation, sentFrom;
+	QByteArray sentMd5;
+	MTPMessageMedia sent;
+	bool reused = false;
+	if (!failed) {
+		contentKey = _contentKey(type, file, data, filesize);
+		if (!file.isEmpty()) contentLocation = FileLocation(mtpc_storage_filePartial, file);
+		if (!withConfirm && (contentKey.first || contentKey.second) && Local::readSentMedia(contentKey, sentFrom, sentMd5, sent) && _contentSame(file, sentFrom, sentMd5)) {
+			if (type == ToPreparePhoto) {
+				reused = (sent.type() == mtpc_messageMediaPhoto && sent.c_messageMediaPhoto().vphoto.type() == mtpc_photo);
+			} else if (type == ToPrepareDocument) {
+				reused = (sent.type() == mtpc_messageMediaDocument && sent.c_messageMediaDocument().vdocument.type() == mtpc_document);
+			}
 		}
+	}
+
+	if (failed) {
+		loader->prepared(seq, 0);
 
 		QTimer::singleShot(1, this, SLOT(prepareImages()));
 
 		emit imageFailed(id);
+	} else if (reused) { // same content was sent already, no need to encode and upload it again
+		MTPPhoto photo(MTP_photoEmpty(MTP_long(0)));
+		MTPDocument document(MTP_documentEmpty(MTP_long(0)));
+		if (type == ToPreparePhoto) {
+			photo = sent.c_messageMediaPhoto().vphoto;
+		} else {
+			document = sent.c_messageMediaDocument().vdocument;
+		}
+
+		ReadyLocalMedia *media = new ReadyLocalMedia(type, file, filename, filesize, data, id, id, thumbExt, peer, photo, PreparedPhotoThumbs(), document, QByteArray(), ctrlShiftEnter, replyTo);
+		media->contentKey = contentKey;
+		media->contentLocation = contentLocation;
+		media->reused = true;
+		loader->prepared(seq, media);
+
+		QTimer::singleShot(1, this, SLOT(prepareImages()));
+
+		emit imageReady();
 	} else {
 		PreparedPhotoThumbs photoThumbs;
 		QVector<MTPPhotoSize> photoSizes;
@@ -160,21 +242,26 @@ void LocalImageLoaderPrivate::prepareImages() {
 		if (type == ToPreparePhoto) {
 			int32 w = img.width(), h = img.height();
 
-			QPixmap thumb = (w > 100 || h > 100) ? QPixmap::fromImage(img.scaled(100, 100, Qt::KeepAspectRatio, Qt::SmoothTransformation), Qt::ColorOnly) : QPixmap::fromImage(img);
+			// the source image is scaled only once, smaller sizes are scaled from the bigger ones
+			QImage fullImage = (w > 1280 || h > 1280) ? img.scaled(1280, 1280, Qt::KeepAspectRatio, Qt::SmoothTransformation) : img;
+			QImage mediumImage = (fullImage.width() > 320 || fullImage.height() > 320) ? fullImage.scaled(320, 320, Qt::KeepAspectRatio, Qt::SmoothTransformation) : fullImage;
+			QImage thumbImage = (mediumImage.width() > 100 || mediumImage.height() > 100) ? mediumImage.scaled(100, 100, Qt::KeepAspectRatio, Qt::SmoothTransformation) : mediumImage;
+
+			QPixmap thumb = QPixmap::fromImage(thumbImage, Qt::ColorOnly);
 			photoThumbs.insert('s', thumb);
 			photoSizes.push_back(MTP_photoSize(MTP_string("s"), MTP_fileLocationUnavailable(MTP_long(0), MTP_int(0), MTP_long(0)), MTP_int(thumb.width()), MTP_int(thumb.height()), MTP_int(0)));
 
-			QPixmap medium = (w > 320 || h > 320) ? QPixmap::fromImage(img.scaled(320, 320, Qt::KeepAspectRatio, Qt::SmoothTransformation), Qt::ColorOnly) : QPixmap::fromImage(img);
+			QPixmap medium = QPixmap::fromImage(mediumImage, Qt::ColorOnly);
 			photoThumbs.insert('m', medium);
 			photoSizes.push_back(MTP_photoSize(MTP_string("m"), MTP_fileLocationUnavailable(MTP_long(0), MTP_int(0), MTP_long(0)), MTP_int(medium.width()), MTP_int(medium.height()), MTP_int(0)));
 
-			QPixmap full = (w > 1280 || h > 1280) ? QPixmap::fromImage(img.scaled(1280, 1280, Qt::KeepAspectRatio, Qt::SmoothTransformation), Qt::ColorOnly) : QPixmap::fromImage(img);
+			QPixmap full = QPixmap::fromImage(fullImage, Qt::ColorOnly);
 			photoThumbs.insert('y', full);
 			photoSizes.push_back(MTP_photoSize(MTP_string("y"), MTP_fileLocationUnavailable(MTP_long(0), MTP_int(0), MTP_long(0)), MTP_int(full.width()), MTP_int(full.height()), MTP_int(0)));
 
 			{
 				QBuffer jpegBuffer(&jpeg);
-				full.save(&jpegBuffer, "JPG", 77);
+				fullImage.save(&jpegBuffer, "JPG", 77);
 			}
 			if (!filesize) filesize = jpeg.size();
 		
@@ -212,16 +299,10 @@ void LocalImageLoaderPrivate::prepareImages() {
 			document = MTP_document(MTP_long(id), MTP_long(0), MTP_int(unixtime()), MTP_string(mime), MTP_int(filesize), thumb, MTP_int(MTP::maindc()), MTP_vector<MTPDocumentAttribute>(attributes));
 		}
 
-		{
-			QMutexLocker lock(loader->readyMutex());
-			loader->readyList().push_back(ReadyLocalMedia(type, file, filename, filesize, data, id, thumbId, thumbExt, peer, photo, photoThumbs, document, jpeg, ctrlShiftEnter, replyTo));
-		}
-
-		{
-			QMutexLocker lock(loader->toPrepareMutex());
-			ToPrepareMedias &list(loader->toPrepareMedias());
-			list.pop_front();
-		}
+		ReadyLocalMedia *media = new ReadyLocalMedia(type, file, filename, filesize, data, id, thumbId, thumbExt, peer, photo, photoThumbs, document, jpeg, ctrlShiftEnter, replyTo);
+		media->contentKey = contentKey;
+		media->contentLocation = contentLocation;
+		loader->prepared(seq, media);
 
 		QTimer::singleShot(1, this, SLOT(prepareImages()));
 
@@ -233,37 +314,27 @@ LocalImageLoaderPrivate::~LocalImageLoaderPrivate() {
 	loader = 0;
 }
 
-LocalImageLoader::LocalImageLoader(QObject *parent) : QObject(parent), thread(0), priv(0) {
+LocalImageLoader::LocalImageLoader(QObject *parent) : QObject(parent), takenSeq(0), readySeq(0), preparing(0) {
 }
 
-void LocalImageLoader::append(const QStringList &files, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t) {
+void LocalImageLoader::append(const QStringList &files, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t, bool ctrlShiftEnter) {
 	{
 		QMutexLocker lock(toPrepareMutex());
 		for (QStringList::const_iterator i = files.cbegin(), e = files.cend(); i != e; ++i) {
-			toPrepare.push_back(ToPrepareMedia(*i, peer, t, false, replyTo));
+			toPrepare.push_back(ToPrepareMedia(*i, peer, t, ctrlShiftEnter, replyTo));
 		}
 	}
-	if (!thread) {
-		thread = new QThread();
-		priv = new LocalImageLoaderPrivate(MTP::authedId(), this, thread);
-		thread->start();
-	}
-	emit needToPrepare();
+	startWorkers();
 }
 
-PhotoId LocalImageLoader::append(const QByteArray &img, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t) {
+PhotoId LocalImageLoader::append(const QByteArray &img, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t, bool ctrlShiftEnter) {
 	PhotoId result = 0;
 	{
 		QMutexLocker lock(toPrepareMutex());
-		toPrepare.push_back(ToPrepareMedia(img, peer, t, false, replyTo));
+		toPrepare.push_back(ToPrepareMedia(img, peer, t, ctrlShiftEnter, replyTo));
 		result = toPrepare.back().id;
 	}
-	if (!thread) {
-		thread = new QThread();
-		priv = new LocalImageLoaderPrivate(MTP::authedId(), this, thread);
-		thread->start();
-	}
-	emit needToPrepare();
+	startWorkers();
 	return result;
 }
 
@@ -274,12 +345,7 @@ PhotoId LocalImageLoader::append(const QImage &img, const PeerId &peer, MsgId re
 		toPrepare.push_back(ToPrepareMedia(img, peer, t, ctrlShiftEnter, replyTo));
 		result = toPrepare.back().id;
 	}
-	if (!thread) {
-		thread = new QThread();
-		priv = new LocalImageLoaderPrivate(MTP::authedId(), this, thread);
-		thread->start();
-	}
-	emit needToPrepare();
+	startWorkers();
 	return result;
 }
 
@@ -288,43 +354,92 @@ PhotoId LocalImageLoader::append(const QString &file, const PeerId &peer, MsgId
 	{
 		QMutexLocker lock(toPrepareMutex());
 		toPrepare.push_back(ToPrepareMedia(file, peer, t, false, replyTo));
+		toPrepare.back().withConfirm = true;
 		result = toPrepare.back().id;
 	}
-	if (!thread) {
-		thread = new QThread();
-		priv = new LocalImageLoaderPrivate(MTP::authedId(), this, thread);
+	startWorkers();
+	return result;
+}
+
+void LocalImageLoader::startWorkers() {
+	int32 need = 0;
+	{
+		QMutexLocker lock(toPrepareMutex());
+		need = toPrepare.size() + preparing;
+	}
+	int32 maxThreads = qMax(qMin(QThread::idealThreadCount(), int32(LocalImageLoaderMaxThreads)), 1);
+	if (need > maxThreads) need = maxThreads;
+	while (threads.size() < need) {
+		QThread *thread = new QThread();
+		workers.push_back(new LocalImageLoaderPrivate(MTP::authedId(), this, thread));
+		threads.push_back(thread);
 		thread->start();
 	}
 	emit needToPrepare();
-	return result;
 }
 
-void LocalImageLoader::onImageReady() {
+void LocalImageLoader::stopWorkersIfDone() {
 	{
 		QMutexLocker lock(toPrepareMutex());
-		if (toPrepare.isEmpty()) {
-			if (priv) priv->deleteLater();
-			priv = 0;
-			if (thread) thread->deleteLater();
-			thread = 0;
-		}
+		if (!toPrepare.isEmpty() || preparing) return;
+	}
+	for (Workers::const_iterator i = workers.cbegin(), e = workers.cend(); i != e; ++i) {
+		(*i)->deleteLater();
 	}
+	workers.clear();
+	for (Threads::const_iterator i = threads.cbegin(), e = threads.cend(); i != e; ++i) {
+		connect(*i, SIGNAL(finished()), *i, SLOT(deleteLater()));
+		(*i)->quit();
+	}
+	threads.clear();
+}
 
-	emit imageReady();
+uint64 LocalImageLoader::takeToPrepare() {
+	toPrepare.pop_front();
+	++preparing;
+	return takenSeq++;
 }
 
-void LocalImageLoader::onImageFailed(quint64 id) {
+void LocalImageLoader::prepared(uint64 seq, ReadyLocalMedia *media) {
 	{
-		QMutexLocker lock(toPrepareMutex());
-		if (toPrepare.isEmpty()) {
-			if (priv) priv->deleteLater();
-			priv = 0;
-			if (thread) thread->deleteLater();
-			thread = 0;
+		QMutexLocker lock(readyMutex());
+		preparedBySeq.insert(seq, media);
+		for (PreparedBySeq::iterator i = preparedBySeq.begin(); i != preparedBySeq.end() && i.key() == readySeq; i = preparedBySeq.erase(i)) {
+			if (i.value()) {
+				ready.push_back(*i.value());
+				delete i.value();
+			}
+			++readySeq;
 		}
 	}
+	{
+		QMutexLocker lock(toPrepareMutex());
+		--preparing;
+	}
+}
+
+void LocalImageLoader::onImageReady() {
+	stopWorkersIfDone();
+
+	bool hasReady = false;
+	{
+		QMutexLocker lock(readyMutex());
+		hasReady = !ready.isEmpty();
+	}
+	if (hasReady) emit imageReady();
+}
+
+void LocalImageLoader::onImageFailed(quint64 id) {
+	stopWorkersIfDone();
 
 	emit imageFailed(id);
+
+	bool hasReady = false; // failed media could hold back the ones prepared after it
+	{
+		QMutexLocker lock(readyMutex());
+		hasReady = !ready.isEmpty();
+	}
+	if (hasReady) emit imageReady();
 }
 
 QMutex *LocalImageLoader::readyMutex() {
@@ -344,6 +459,17 @@ ToPrepareMedias &LocalImageLoader::toPrepareMedias() {
 }
 
 LocalImageLoader::~LocalImageLoader() {
-	delete priv;
-	delete thread;
+	for (Threads::const_iterator i = threads.cbegin(), e = threads.cend(); i != e; ++i) {
+		(*i)->quit();
+		(*i)->wait();
+	}
+	for (Workers::const_iterator i = workers.cbegin(), e = workers.cend(); i != e; ++i) {
+		delete *i;
+	}
+	for (Threads::const_iterator i = threads.cbegin(), e = threads.cend(); i != e; ++i) {
+		delete *i;
+	}
+	for (PreparedBySeq::const_iterator i = preparedBySeq.cbegin(), e = preparedBySeq.cend(); i != e; ++i) {
+		delete i.value();
+	}
 }
@@ -25,11 +25,11 @@ enum ToPrepareMediaType {
 };
 
 struct ToPrepareMedia {
-	ToPrepareMedia(const QString &file, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), file(file), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo) {
+	ToPrepareMedia(const QString &file, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), file(file), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo), withConfirm(false) {
 	}
-	ToPrepareMedia(const QImage &img, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), img(img), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo) {
+	ToPrepareMedia(const QImage &img, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), img(img), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo), withConfirm(false) {
 	}
-	ToPrepareMedia(const QByteArray &data, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), data(data), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo) {
+	ToPrepareMedia(const QByteArray &data, const PeerId &peer, ToPrepareMediaType t, bool ctrlShiftEnter, MsgId replyTo) : id(MTP::nonce<PhotoId>()), data(data), peer(peer), type(t), ctrlShiftEnter(ctrlShiftEnter), replyTo(replyTo), withConfirm(false) {
 	}
 	PhotoId id;
 	QString file;
@@ -39,13 +39,14 @@ struct ToPrepareMedia {
 	ToPrepareMediaType type;
 	bool ctrlShiftEnter;
 	MsgId replyTo;
+	bool withConfirm; // will be shown in PhotoSendBox, so the thumbnails should be prepared
 };
 typedef QList<ToPrepareMedia> ToPrepareMedias;
 
 typedef QMap<int32, QByteArray> LocalFileParts;
 struct ReadyLocalMedia {
 	ReadyLocalMedia(ToPrepareMediaType type, const QString &file, const QString &filename, int32 filesize, const QByteArray &data, const uint64 &id, const uint64 &thumbId, const QString &thumbExt, const PeerId &peer, const MTPPhoto &photo, const PreparedPhotoThumbs &photoThumbs, const MTPDocument &document, const QByteArray &jpeg, bool ctrlShiftEnter, MsgId replyTo) :
-		replyTo(replyTo), type(type), file(file), filename(filename), filesize(filesize), data(data), thumbExt(thumbExt), id(id), thumbId(thumbId), peer(peer), photo(photo), document(document), photoThumbs(photoThumbs), ctrlShiftEnter(ctrlShiftEnter) {
+		replyTo(replyTo), type(type), file(file), filename(filename), filesize(filesize), data(data), thumbExt(thumbExt), id(id), thumbId(thumbId), peer(peer), photo(photo), document(document), photoThumbs(photoThumbs), contentKey(0, 0), reused(false), ctrlShiftEnter(ctrlShiftEnter) {
 		if (!jpeg.isEmpty()) {
 			int32 size = jpeg.size();
 			for (int32 i = 0, part = 0; i < size; i += UploadPartSize, ++part) {
@@ -70,6 +71,10 @@ struct ReadyLocalMedia {
 	LocalFileParts parts;
 	QByteArray jpeg_md5;
 
+	MediaKey contentKey; // md5 of content (first and last parts for files) with type and size, (0, 0) if not known
+	FileLocation contentLocation; // file the content key was computed from
+	bool reused; // photo or document were already sent from the same content, no upload is needed
+
 	bool ctrlShiftEnter;
 };
 typedef QList<ReadyLocalMedia> ReadyLocalMedias;
@@ -105,8 +110,8 @@ class LocalImageLoader : public QObject {
 public:
 
 	LocalImageLoader(QObject *parent);
-	void append(const QStringList &files, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t);
-	PhotoId append(const QByteArray &img, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t);
+	void append(const QStringList &files, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t, bool ctrlShiftEnter = false);
+	PhotoId append(const QByteArray &img, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t, bool ctrlShiftEnter = false);
 	PhotoId append(const QImage &img, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t, bool ctrlShiftEnter = false);
 	PhotoId append(const QString &file, const PeerId &peer, MsgId replyTo, ToPrepareMediaType t);
 
@@ -116,6 +121,10 @@ public:
 	QMutex *toPrepareMutex();
 	ToPrepareMedias &toPrepareMedias();
 
+	// called by workers: takeToPrepare under toPrepareMutex(), prepared() without any lock held
+	uint64 takeToPrepare();
+	void prepared(uint64 seq, ReadyLocalMedia *media); // media == 0 if failed, ownership is taken
+
 	~LocalImageLoader();
 
 public slots:
@@ -131,10 +140,21 @@ signals:
 
 private:
 
+	void startWorkers();
+	void stopWorkersIfDone();
+
 	ReadyLocalMedias ready;
 	ToPrepareMedias toPrepare;
 	QMutex readyLock, toPrepareLock;
-	QThread *thread;
-	LocalImageLoaderPrivate *priv;
+
+	uint64 takenSeq, readySeq; // medias are taken by workers and put to ready list in the order of appending
+	int32 preparing; // guarded by toPrepareLock
+	typedef QMap<uint64, ReadyLocalMedia*> PreparedBySeq;
+	PreparedBySeq preparedBySeq; // guarded by readyLock, waiting for earlier medias to finish
+
+	typedef QList<QThread*> Threads;
+	Threads threads;
+	typedef QList<LocalImageLoaderPrivate*> Workers;
+	Workers workers;
 
 };
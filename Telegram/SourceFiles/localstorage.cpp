@@ -495,6 +495,7 @@ namespace {
 		lskBackground, // no data
 		lskUserSettings, // no data
 		lskRecentHashtags, // no data
+		lskSentMedia, // no data
 	};
 
 	typedef QMap<PeerId, FileKey> DraftsMap;
@@ -510,6 +511,7 @@ namespace {
 	FileKey _locationsKey = 0;
 	
 	FileKey _recentStickersKey = 0;
+	bool _recentStickersWereRead = false;
 	
 	FileKey _backgroundKey = 0;
 	bool _backgroundWasRead = false;
@@ -518,6 +520,34 @@ namespace {
 	FileKey _recentHashtagsKey = 0;
 	bool _recentHashtagsWereRead = false;
 
+	struct SentMediaDesc {
+		SentMediaDesc() : order(0) {
+		}
+		QByteArray media; // MTPMessageMedia serialized in mtpCurrentLayer
+		FileLocation location; // file the content was read from, empty for in-memory data
+		QByteArray md5; // full content md5 if it was computed while uploading
+		uint64 order; // key in _sentMediaOrder
+	};
+	typedef QMap<MediaKey, SentMediaDesc> SentMediaMap;
+	typedef QMap<uint64, MediaKey> SentMediaOrder; // least recently used first
+	SentMediaMap _sentMediaMap; // content key -> media received from server, guarded by _sentMediaLock
+	SentMediaOrder _sentMediaOrder;
+	uint64 _sentMediaLastOrder = 0;
+	QMutex _sentMediaLock;
+	FileKey _sentMediaKey = 0;
+
+	void _sentMediaTouch(SentMediaMap::iterator i) { // under _sentMediaLock
+		if (i.value().order) _sentMediaOrder.remove(i.value().order);
+		i.value().order = ++_sentMediaLastOrder;
+		_sentMediaOrder.insert(i.value().order, i.key());
+	}
+
+	void _sentMediaClear() {
+		QMutexLocker lock(&_sentMediaLock);
+		_sentMediaMap.clear();
+		_sentMediaOrder.clear();
+	}
+
 	typedef QPair<FileKey, qint32> FileDesc; // file, size
 	typedef QMap<StorageKey, FileDesc> StorageMap;
 	StorageMap _imagesMap, _stickersMap, _audiosMap;
@@ -596,6 +626,83 @@ namespace {
 		}
 	}
 
+	void _writeSentMedia(WriteMapWhen when = WriteMapSoon) {
+		if (when != WriteMapNow) {
+			_manager->writeSentMedia(when == WriteMapFast);
+			return;
+		}
+		if (!_working()) return;
+
+		_manager->writingSentMedia();
+		QList<QPair<MediaKey, SentMediaDesc> > sentMedia;
+		{
+			QMutexLocker lock(&_sentMediaLock);
+			for (SentMediaOrder::const_iterator i = _sentMediaOrder.cbegin(), e = _sentMediaOrder.cend(); i != e; ++i) {
+				sentMedia.push_back(qMakePair(i.value(), _sentMediaMap.value(i.value())));
+			}
+		}
+		if (sentMedia.isEmpty()) {
+			if (_sentMediaKey) {
+				clearKey(_sentMediaKey);
+				_sentMediaKey = 0;
+				_mapChanged = true;
+				_writeMap();
+			}
+		} else {
+			if (!_sentMediaKey) {
+				_sentMediaKey = genKey();
+				_mapChanged = true;
+				_writeMap(WriteMapFast);
+			}
+			quint32 size = sizeof(quint32) + sizeof(qint32);
+			for (QList<QPair<MediaKey, SentMediaDesc> >::const_iterator i = sentMedia.cbegin(), e = sentMedia.cend(); i != e; ++i) {
+				// content key + media + location name + location modified + location size + md5
+				const SentMediaDesc &desc(i->second);
+				size += sizeof(quint64) * 2 + sizeof(quint32) + desc.media.size() + _stringSize(desc.location.name) + _dateTimeSize() + sizeof(qint32) + sizeof(quint32) + desc.md5.size();
+			}
+			EncryptedDescriptor data(size);
+			data.stream << qint32(mtpCurrentLayer) << quint32(sentMedia.size());
+			for (QList<QPair<MediaKey, SentMediaDesc> >::const_iterator i = sentMedia.cbegin(), e = sentMedia.cend(); i != e; ++i) { // oldest first
+				const SentMediaDesc &desc(i->second);
+				data.stream << quint64(i->first.first) << quint64(i->first.second) << desc.media << desc.location.name << desc.location.modified << qint32(desc.location.size) << desc.md5;
+			}
+			FileWriteDescriptor file(_sentMediaKey);
+			file.writeEncrypted(data);
+		}
+	}
+
+	void _readSentMedia() {
+		FileReadDescriptor sent;
+		if (!readEncryptedFile(sent, _sentMediaKey)) {
+			clearKey(_sentMediaKey);
+			_sentMediaKey = 0;
+			_writeMap();
+			return;
+		}
+
+		qint32 layer = 0;
+		quint32 count = 0;
+		sent.stream >> layer >> count;
+		if (!_checkStreamStatus(sent.stream) || layer != mtpCurrentLayer) { // media of another layer can't be read
+			_sentMediaClear();
+			_writeSentMedia();
+			return;
+		}
+
+		QMutexLocker lock(&_sentMediaLock);
+		_sentMediaMap.clear();
+		_sentMediaOrder.clear();
+		for (quint32 i = 0; i < count; ++i) {
+			quint64 first, second;
+			SentMediaDesc desc;
+			sent.stream >> first >> second >> desc.media >> desc.location.name >> desc.location.modified >> desc.location.size >> desc.md5;
+			if (!_checkStreamStatus(sent.stream)) break;
+
+			desc.location.type = mtpc_storage_filePartial;
+			_sentMediaTouch(_sentMediaMap.insert(MediaKey(first, second), desc));
+		}
+	}
+
 	mtpDcOptions *_dcOpts = 0;
 	bool _readSetting(quint32 blockId, QDataStream &stream, int version) {
 		switch (blockId) {
@@ -1287,7 +1394,7 @@ namespace {
 		DraftsNotReadMap draftsNotReadMap;
 		StorageMap imagesMap, stickersMap, audiosMap;
 		qint64 storageImagesSize = 0, storageStickersSize = 0, storageAudiosSize = 0;
-		quint64 locationsKey = 0, recentStickersKey = 0, backgroundKey = 0, userSettingsKey = 0, recentHashtagsKey = 0;
+		quint64 locationsKey = 0, recentStickersKey = 0, backgroundKey = 0, userSettingsKey = 0, recentHashtagsKey = 0, sentMediaKey = 0;
 		while (!map.stream.atEnd()) {
 			quint32 keyType;
 			map.stream >> keyType;
@@ -1364,6 +1471,9 @@ namespace {
 			case lskRecentHashtags: {
 				map.stream >> recentHashtagsKey;
 			} break;
+			case lskSentMedia: {
+				map.stream >> sentMediaKey;
+			} break;
 			default:
 				LOG(("App Error: unknown key type in encrypted map: %1").arg(keyType));
 				return Local::ReadMapFailed;
@@ -1389,6 +1499,7 @@ namespace {
 		_backgroundKey = backgroundKey;
 		_userSettingsKey = userSettingsKey;
 		_recentHashtagsKey = recentHashtagsKey;
+		_sentMediaKey = sentMediaKey;
 		_oldMapVersion = mapData.version;
 		if (_oldMapVersion < AppVersion) {
 			_mapChanged = true;
@@ -1400,6 +1511,9 @@ namespace {
 		if (_locationsKey) {
 			_readLocations();
 		}
+		if (_sentMediaKey) {
+			_readSentMedia();
+		}
 
 		_readUserSettings();
 		_readMtpData();
@@ -1452,6 +1566,7 @@ namespace {
 		if (_backgroundKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_userSettingsKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_recentHashtagsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_sentMediaKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		EncryptedDescriptor mapData(mapSize);
 		if (!_draftsMap.isEmpty()) {
 			mapData.stream << quint32(lskDraft) << quint32(_draftsMap.size());
@@ -1498,6 +1613,9 @@ namespace {
 		if (_recentHashtagsKey) {
 			mapData.stream << quint32(lskRecentHashtags) << quint64(_recentHashtagsKey);
 		}
+		if (_sentMediaKey) {
+			mapData.stream << quint32(lskSentMedia) << quint64(_sentMediaKey);
+		}
 		map.writeEncrypted(mapData);
 
 		_mapChanged = false;
@@ -1512,6 +1630,8 @@ namespace _local_inner {
 		connect(&_mapWriteTimer, SIGNAL(timeout()), this, SLOT(mapWriteTimeout()));
 		_locationsWriteTimer.setSingleShot(true);
 		connect(&_locationsWriteTimer, SIGNAL(timeout()), this, SLOT(locationsWriteTimeout()));
+		_sentMediaWriteTimer.setSingleShot(true);
+		connect(&_sentMediaWriteTimer, SIGNAL(timeout()), this, SLOT(sentMediaWriteTimeout()));
 	}
 
 	void Manager::writeMap(bool fast) {
@@ -1538,6 +1658,18 @@ namespace _local_inner {
 		_locationsWriteTimer.stop();
 	}
 
+	void Manager::writeSentMedia(bool fast) {
+		if (!_sentMediaWriteTimer.isActive() || fast) {
+			_sentMediaWriteTimer.start(fast ? 1 : WriteMapTimeout);
+		} else if (_sentMediaWriteTimer.remainingTime() <= 0) {
+			sentMediaWriteTimeout();
+		}
+	}
+
+	void Manager::writingSentMedia() {
+		_sentMediaWriteTimer.stop();
+	}
+
 	void Manager::mapWriteTimeout() {
 		_writeMap(WriteMapNow);
 	}
@@ -1546,6 +1678,10 @@ namespace _local_inner {
 		_writeLocations(WriteMapNow);
 	}
 
+	void Manager::sentMediaWriteTimeout() {
+		_writeSentMedia(WriteMapNow);
+	}
+
 	void Manager::finish() {
 		if (_mapWriteTimer.isActive()) {
 			mapWriteTimeout();
@@ -1553,6 +1689,9 @@ namespace _local_inner {
 		if (_locationsWriteTimer.isActive()) {
 			locationsWriteTimeout();
 		}
+		if (_sentMediaWriteTimer.isActive()) {
+			sentMediaWriteTimeout();
+		}
 	}
 
 }
@@ -1720,7 +1859,9 @@ namespace Local {
 		_draftsNotReadMap.clear();
 		_stickersMap.clear();
 		_audiosMap.clear();
-		_locationsKey = _recentStickersKey = _backgroundKey = _userSettingsKey = _recentHashtagsKey = 0;
+		_locationsKey = _recentStickersKey = _backgroundKey = _userSettingsKey = _recentHashtagsKey = _sentMediaKey = 0;
+		_recentStickersWereRead = false;
+		_sentMediaClear();
 		_mapChanged = true;
 		_writeMap(WriteMapNow);
 
@@ -2136,7 +2277,14 @@ namespace Local {
 		}
 	}
 
+	void forgetRecentStickers() {
+		_recentStickersWereRead = false;
+	}
+
 	void readRecentStickers() {
+		if (_recentStickersWereRead) return;
+		_recentStickersWereRead = true;
+
 		if (!_recentStickersKey) return;
 
 		FileReadDescriptor stickers;
@@ -2280,6 +2428,64 @@ namespace Local {
 		}
 	}
 
+	void writeSentMedia(const MediaKey &content, const FileLocation &location, const QByteArray &md5, const MTPMessageMedia &media) {
+		if (!content.first && !content.second) return;
+
+		mtpBuffer buffer;
+		media.write(buffer);
+		{
+			QMutexLocker lock(&_sentMediaLock);
+			SentMediaMap::iterator i = _sentMediaMap.find(content);
+			if (i == _sentMediaMap.end()) {
+				i = _sentMediaMap.insert(content, SentMediaDesc());
+			}
+			i.value().media = QByteArray((const char*)buffer.constData(), buffer.size() * sizeof(mtpPrime));
+			i.value().location = location;
+			i.value().md5 = md5;
+			_sentMediaTouch(i);
+			while (_sentMediaMap.size() > SentMediaRememberCount) {
+				_sentMediaMap.remove(_sentMediaOrder.begin().value());
+				_sentMediaOrder.erase(_sentMediaOrder.begin());
+			}
+		}
+		_writeSentMedia();
+	}
+
+	bool readSentMedia(const MediaKey &content, FileLocation &location, QByteArray &md5, MTPMessageMedia &media) {
+		QByteArray serialized;
+		{
+			QMutexLocker lock(&_sentMediaLock);
+			SentMediaMap::iterator i = _sentMediaMap.find(content);
+			if (i == _sentMediaMap.end()) return false;
+
+			serialized = i.value().media;
+			location = i.value().location;
+			md5 = i.value().md5;
+			_sentMediaTouch(i); // new order is written with the next change
+		}
+		if (serialized.size() % sizeof(mtpPrime)) return false;
+
+		const mtpPrime *from = (const mtpPrime*)serialized.constData(), *end = from + (serialized.size() / sizeof(mtpPrime));
+		try {
+			media.read(from, end);
+		} catch (Exception &e) {
+			return false;
+		}
+		return (from == end);
+	}
+
+	void removeSentMedia(const MediaKey &content) {
+		{
+			QMutexLocker lock(&_sentMediaLock);
+			SentMediaMap::iterator i = _sentMediaMap.find(content);
+			if (i == _sentMediaMap.end()) return;
+
+			_sentMediaOrder.remove(i.value().order);
+			_sentMediaMap.erase(i);
+		}
+		_writeSentMedia();
+	}
+
 	void readRecentHashtags() {
 		if (_recentHashtagsWereRead) return;
 		_recentHashtagsWereRead = true;
@@ -2374,6 +2580,11 @@ namespace Local {
 				_recentHashtagsKey = 0;
 				_mapChanged = true;
 			}
+			if (_sentMediaKey) {
+				_sentMediaKey = 0;
+				_mapChanged = true;
+			}
+			_sentMediaClear();
 			_writeMap();
 		} else {
 			if (task & ClearManagerStorage) {
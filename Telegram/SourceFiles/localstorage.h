@@ -32,17 +32,21 @@ namespace _local_inner {
 		void writingMap();
 		void writeLocations(bool fast);
 		void writingLocations();
+		void writeSentMedia(bool fast);
+		void writingSentMedia();
 		void finish();
 
 	public slots:
 
 		void mapWriteTimeout();
 		void locationsWriteTimeout();
+		void sentMediaWriteTimeout();
 
 	private:
 
 		QTimer _mapWriteTimer;
 		QTimer _locationsWriteTimer;
+		QTimer _sentMediaWriteTimer;
 
 	};
 
@@ -134,6 +138,7 @@ namespace Local {
 
 	void writeRecentStickers();
 	void readRecentStickers();
+	void forgetRecentStickers(); // recent stickers pack was cleared in memory, next readRecentStickers() reads it again
 
 	void writeBackground(int32 id, const QImage &img);
 	bool readBackground();
@@ -141,4 +146,8 @@ namespace Local {
 	void writeRecentHashtags();
 	void readRecentHashtags();
 
+	void writeSentMedia(const MediaKey &content, const FileLocation &location, const QByteArray &md5, const MTPMessageMedia &media);
+	bool readSentMedia(const MediaKey &content, FileLocation &location, QByteArray &md5, MTPMessageMedia &media); // may be called from any thread
+	void removeSentMedia(const MediaKey &content);
+
 };
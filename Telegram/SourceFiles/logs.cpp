@@ -358,3 +358,260 @@ QString logVectorLong(const QVector<uint64> &ids) {
 	}
 	return idsStr + "]";
 }
+
+enum MetricType {
+	MetricCounter,
+	MetricGauge,
+	MetricHistogram,
+};
+struct MetricData {
+	MetricData(MetricType type) : type(type), min(Q_INT64_C(0x7FFFFFFFFFFFFFFF)) {
+	}
+	const MetricType type;
+	QAtomicInteger<qint64> value; // counter sum, gauge value or histogram sum
+	QAtomicInteger<qint64> count, min, max;
+	QAtomicInteger<qint64> buckets[MTPMetricsBuckets];
+};
+
+namespace {
+	struct MetricSnapshot {
+		MetricSnapshot(const MetricData &m) : type(m.type), value(m.value.load()), count(m.count.load()), min(count ? m.min.load() : 0), max(m.max.load()) {
+			for (int32 i = 0; i < MTPMetricsBuckets; ++i) {
+				buckets[i] = m.buckets[i].load();
+			}
+		}
+		MetricType type;
+		int64 value, count, min, max;
+		int64 buckets[MTPMetricsBuckets];
+	};
+
+	typedef QMap<QString, MetricData*> Metrics;
+	Metrics metrics; // never removed, handles stay valid till the end
+	QMutex metricsMutex; // only for registering and snapshots
+
+	MetricHandle metricRegister(const QString &name, MetricType type) {
+		QMutexLocker lock(&metricsMutex);
+		Metrics::const_iterator i = metrics.constFind(name);
+		if (i != metrics.cend()) {
+			return i.value();
+		}
+		return metrics.insert(name, new MetricData(type)).value();
+	}
+
+	int32 metricBucket(int64 value) {
+		int32 result = 0;
+		for (int64 edge = 1; result + 1 < MTPMetricsBuckets && value > edge; edge <<= 1) {
+			++result;
+		}
+		return result;
+	}
+
+	int64 metricPercentile(const MetricSnapshot &m, int32 percent) { // upper edge of the bucket
+		int64 need = (m.count * percent + 99) / 100, have = 0;
+		for (int32 i = 0; i < MTPMetricsBuckets; ++i) {
+			have += m.buckets[i];
+			if (have >= need) return qMin(m.max, int64(1) << i);
+		}
+		return m.max;
+	}
+}
+
+MetricHandle metricCounter(const QString &name) {
+	return metricRegister(name, MetricCounter);
+}
+
+MetricHandle metricGauge(const QString &name) {
+	return metricRegister(name, MetricGauge);
+}
+
+MetricHandle metricHistogram(const QString &name) {
+	return metricRegister(name, MetricHistogram);
+}
+
+void metricAdd(MetricHandle metric, int64 value) {
+	if (!metric) return;
+	metric->value.fetchAndAddRelaxed(value);
+}
+
+void metricSet(MetricHandle metric, int64 value) {
+	if (!metric) return;
+	metric->value.store(value);
+}
+
+void metricSample(MetricHandle metric, int64 value) {
+	if (!metric) return;
+	metric->value.fetchAndAddRelaxed(value);
+	metric->count.fetchAndAddRelaxed(1);
+	metric->buckets[metricBucket(value)].fetchAndAddRelaxed(1);
+	for (qint64 was = metric->min.load(); value < was && !metric->min.testAndSetRelaxed(was, value); was = metric->min.load()) {
+	}
+	for (qint64 was = metric->max.load(); value > was && !metric->max.testAndSetRelaxed(was, value); was = metric->max.load()) {
+	}
+}
+
+QString metricsText(int32 maxLines) {
+	QMutexLocker lock(&metricsMutex);
+
+	QStringList lines;
+	for (Metrics::const_iterator i = metrics.cbegin(), e = metrics.cend(); i != e; ++i) {
+		if (lines.size() == maxLines) {
+			lines.push_back(qsl("..and %1 more").arg(metrics.size() - maxLines));
+			break;
+		}
+		MetricSnapshot m(*i.value());
+		if (m.type == MetricHistogram) {
+			lines.push_back(qsl("%1: %2 samples, avg %3, p90 %4, max %5").arg(i.key()).arg(m.count).arg(m.count ? (m.value / m.count) : 0).arg(metricPercentile(m, 90)).arg(m.max));
+		} else {
+			lines.push_back(qsl("%1: %2").arg(i.key()).arg(m.value));
+		}
+	}
+	return lines.join('\n');
+}
+
+QByteArray metricsJson() {
+	QJsonObject counters, gauges, histograms;
+	{
+		QMutexLocker lock(&metricsMutex);
+		for (Metrics::const_iterator i = metrics.cbegin(), e = metrics.cend(); i != e; ++i) {
+			MetricSnapshot m(*i.value());
+			switch (m.type) {
+			case MetricCounter: counters.insert(i.key(), double(m.value)); break;
+			case MetricGauge: gauges.insert(i.key(), double(m.value)); break;
+			case MetricHistogram: {
+				QJsonObject h;
+				h.insert(qsl("count"), double(m.count));
+				h.insert(qsl("sum"), double(m.value));
+				h.insert(qsl("min"), double(m.min));
+				h.insert(qsl("max"), double(m.max));
+				h.insert(qsl("p50"), double(metricPercentile(m, 50)));
+				h.insert(qsl("p90"), double(metricPercentile(m, 90)));
+				h.insert(qsl("p99"), double(metricPercentile(m, 99)));
+				QJsonArray buckets;
+				int32 last = MTPMetricsBuckets;
+				while (last > 0 && !m.buckets[last - 1]) --last;
+				for (int32 j = 0; j < last; ++j) {
+					buckets.append(double(m.buckets[j]));
+				}
+				h.insert(qsl("buckets"), buckets);
+				histograms.insert(i.key(), h);
+			} break;
+			}
+		}
+	}
+	QJsonObject result;
+	result.insert(qsl("time"), QDateTime::currentDateTime().toString(Qt::ISODate));
+	result.insert(qsl("counters"), counters);
+	result.insert(qsl("gauges"), gauges);
+	result.insert(qsl("histograms"), histograms);
+	return QJsonDocument(result).toJson();
+}
+
+QString metricsDump() {
+	QString path(cWorkingDir() + qsl("DebugLogs/metrics.json"));
+	QDir().mkpath(cWorkingDir() + qsl("DebugLogs"));
+
+	QFile f(path);
+	if (!f.open(QIODevice::WriteOnly)) {
+		LOG(("Metrics Error: could not open '%1' for writing").arg(path));
+		return QString();
+	}
+	f.write(metricsJson());
+	f.close();
+	return path;
+}
+
+namespace {
+	struct TraceEvent {
+		TraceEvent(const char *name = 0, char phase = 0, int64 us = 0, quintptr thread = 0) : name(name), phase(phase), us(us), thread(thread) {
+		}
+		const char *name; // static strings only
+		char phase; // 'B' - span begin, 'E' - span end, 'i' - instant
+		int64 us;
+		quintptr thread;
+	};
+	typedef QVector<TraceEvent> TraceEvents;
+	TraceEvents traceEvents;
+	QElapsedTimer traceTimer;
+	bool traceCollecting = false;
+	QMutex traceMutex;
+
+	void traceAdd(const char *name, char phase) {
+		QMutexLocker lock(&traceMutex);
+		if (!traceCollecting) return;
+		if (traceEvents.size() >= StartupTraceMaxEvents) {
+			traceCollecting = false;
+			return;
+		}
+		traceEvents.push_back(TraceEvent(name, phase, traceTimer.nsecsElapsed() / 1000, quintptr(QThread::currentThreadId())));
+	}
+}
+
+void traceStart() {
+	QMutexLocker lock(&traceMutex);
+	traceTimer.start();
+	traceEvents.reserve(256);
+	traceCollecting = true;
+}
+
+int64 traceElapsed() {
+	return traceTimer.isValid() ? traceTimer.elapsed() : 0;
+}
+
+void traceBegin(const char *name) {
+	traceAdd(name, 'B');
+}
+
+void traceEnd(const char *name) {
+	traceAdd(name, 'E');
+}
+
+void traceMark(const char *name) {
+	traceAdd(name, 'i');
+}
+
+void traceStop() {
+	QMutexLocker lock(&traceMutex);
+	traceCollecting = false;
+	traceEvents = TraceEvents();
+}
+
+QString traceDump() {
+	TraceEvents events;
+	{
+		QMutexLocker lock(&traceMutex);
+		traceCollecting = false;
+		events = traceEvents;
+		traceEvents = TraceEvents();
+	}
+	if (events.isEmpty()) return QString();
+
+	double pid = double(QCoreApplication::applicationPid());
+	QJsonArray list;
+	for (TraceEvents::const_iterator i = events.cbegin(), e = events.cend(); i != e; ++i) {
+		QJsonObject event;
+		event.insert(qsl("name"), QString::fromLatin1(i->name));
+		event.insert(qsl("ph"), QString(QChar::fromLatin1(i->phase)));
+		event.insert(qsl("ts"), double(i->us));
+		event.insert(qsl("pid"), pid);
+		event.insert(qsl("tid"), double(i->thread));
+		if (i->phase == 'i') {
+			event.insert(qsl("s"), qsl("p")); // instant events are drawn over the whole process
+		}
+		list.append(event);
+	}
+	QJsonObject result;
+	result.insert(qsl("traceEvents"), list);
+	result.insert(qsl("displayTimeUnit"), qsl("ms"));
+
+	QString path(cWorkingDir() + qsl("DebugLogs/startup_trace.json"));
+	QDir().mkpath(cWorkingDir() + qsl("DebugLogs"));
+
+	QFile f(path);
+	if (!f.open(QIODevice::WriteOnly)) {
+		LOG(("Trace Error: could not open '%1' for writing").arg(path));
+		return QString();
+	}
+	f.write(QJsonDocument(result).toJson(QJsonDocument::Compact));
+	f.close();
+	return path;
+}
@@ -82,3 +82,42 @@ void logWrite(const QString &v);
 void logsInit();
 void logsInitDebug();
 void logsClose();
+
+// metrics are named like "mtp.dc2.rtt_ms" and are always collected, thread safe
+// the name is registered once under a lock, updates through the handle are lock free
+struct MetricData;
+typedef MetricData *MetricHandle;
+MetricHandle metricCounter(const QString &name); // values are summed
+MetricHandle metricGauge(const QString &name); // last value is kept
+MetricHandle metricHistogram(const QString &name); // samples are counted in power of two buckets
+
+void metricAdd(MetricHandle metric, int64 value = 1);
+void metricSet(MetricHandle metric, int64 value);
+void metricSample(MetricHandle metric, int64 value);
+
+QString metricsText(int32 maxLines); // short snapshot for the in-app debug box
+QByteArray metricsJson();
+QString metricsDump(); // writes json snapshot to DebugLogs/metrics.json, returns the path or empty string on fail
+
+// startup trace, spans are kept in memory until traceDump() writes them to DebugLogs/startup_trace.json
+// in chrome trace event format, it can be opened in chrome://tracing, thread safe
+void traceStart(); // starts the clock, first thing in main()
+int64 traceElapsed(); // ms since traceStart()
+void traceBegin(const char *name);
+void traceEnd(const char *name);
+void traceMark(const char *name); // instant event
+void traceStop(); // stops collecting and drops the trace
+QString traceDump(); // stops collecting and writes the trace, returns the path or empty string on fail
+
+class TraceSpan {
+public:
+	TraceSpan(const char *name) : _name(name) {
+		traceBegin(_name);
+	}
+	~TraceSpan() {
+		traceEnd(_name);
+	}
+
+private:
+	const char *_name;
+};
@@ -22,6 +22,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "localstorage.h"
 
 int main(int argc, char *argv[]) {
+	traceStart();
+
 #ifdef _NEED_WIN_GENERATE_DUMP
 	_oldWndExceptionFilter = SetUnhandledExceptionFilter(_exceptionFilter);
 #endif
@@ -36,7 +38,9 @@ int main(int argc, char *argv[]) {
 	}
 	logsInit();
 
+	traceBegin("Local::readSettings");
 	Local::readSettings();
+	traceEnd("Local::readSettings");
 	if (cFromAutoStart() && !cAutoStart()) {
 		psAutoStart(false, true);
 		Local::stop();
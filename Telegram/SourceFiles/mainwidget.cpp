@@ -372,10 +372,7 @@ _failDifferenceTimeout(1), _lastUpdateTime(0), _cachedX(0), _cachedY(0), _backgr
 	connect(&history, SIGNAL(peerShown(PeerData*)), this, SLOT(onPeerShown(PeerData*)));
 	connect(&updateNotifySettingTimer, SIGNAL(timeout()), this, SLOT(onUpdateNotifySettings()));
 	connect(this, SIGNAL(showPeerAsync(quint64,qint32,bool,bool)), this, SLOT(showPeer(quint64,qint32,bool,bool)), Qt::QueuedConnection);
-	if (audioVoice()) {
-		connect(audioVoice(), SIGNAL(updated(AudioData*)), this, SLOT(audioPlayProgress(AudioData*)));
-		connect(audioVoice(), SIGNAL(stopped(AudioData*)), this, SLOT(audioPlayProgress(AudioData*)));
-	}
+	audioInited();
 
 	_webPageUpdater.setSingleShot(true);
 	connect(&_webPageUpdater, SIGNAL(timeout()), this, SLOT(webPagesUpdate()));
@@ -494,7 +491,7 @@ void MainWidget::finishForwarding(History *hist) {
 			MsgId newId = clientMsgId();
 			hist->addToBackForwarded(newId, static_cast<HistoryMessage*>(_toForward.cbegin().value()));
 			App::historyRegRandom(randomId, newId);
-			hist->sendRequestId = MTP::send(MTPmessages_ForwardMessage(hist->peer->input, MTP_int(_toForward.cbegin().key()), MTP_long(randomId)), rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+			hist->sendRequestId = MTP::send(MTPmessages_ForwardMessage(hist->peer->input, MTP_int(_toForward.cbegin().key()), MTP_long(randomId)), rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId, MTPRequestInteractive);
 		} else {
 			QVector<MTPint> ids;
 			QVector<MTPlong> randomIds;
@@ -508,7 +505,7 @@ void MainWidget::finishForwarding(History *hist) {
 				ids.push_back(MTP_int(i.key()));
 				randomIds.push_back(MTP_long(randomId));
 			}
-			hist->sendRequestId = MTP::send(MTPmessages_ForwardMessages(hist->peer->input, MTP_vector<MTPint>(ids), MTP_vector<MTPlong>(randomIds)), rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+			hist->sendRequestId = MTP::send(MTPmessages_ForwardMessages(hist->peer->input, MTP_vector<MTPint>(ids), MTP_vector<MTPlong>(randomIds)), rpcDone(&MainWidget::sentUpdatesReceived), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId, MTPRequestInteractive);
 		}
 		if (history.peer() == hist->peer) history.peerMessagesUpdated();
 		cancelForwarding();
@@ -934,7 +931,7 @@ void MainWidget::sendPreparedText(History *hist, const QString &text, MsgId repl
 			media = MTP_messageMediaWebPage(MTP_webPagePending(MTP_long(page->id), MTP_int(page->pendingTill)));
 		}
 		hist->addToBack(MTP_message(MTP_int(flags), MTP_int(newId), MTP_int(MTP::authedId()), App::peerToMTP(hist->peer->id), MTPint(), MTPint(), MTP_int(replyTo), MTP_int(unixtime()), msgText, media));
-		hist->sendRequestId = MTP::send(MTPmessages_SendMessage(MTP_int(sendFlags), hist->peer->input, MTP_int(replyTo), msgText, MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentDataReceived, randomId), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId);
+		hist->sendRequestId = MTP::send(MTPmessages_SendMessage(MTP_int(sendFlags), hist->peer->input, MTP_int(replyTo), msgText, MTP_long(randomId)), App::main()->rpcDone(&MainWidget::sentDataReceived, randomId), RPCFailHandlerPtr(), 0, 0, hist->sendRequestId, MTPRequestInteractive);
 	}
 
 	finishForwarding(hist);
@@ -1348,6 +1345,7 @@ void MainWidget::audioLoadProgress(mtpFileLoader *loader) {
 						audioVoice()->pauseresume();
 					} else {
 						audioVoice()->play(audio);
+						preloadNextVoice(audio);
 					}
 				} else {
 					QPoint pos(QCursor::pos());
@@ -2357,6 +2355,7 @@ bool MainWidget::updPtsUpdated(int pts, int ptsCount) { // return false if need
 }
 
 void MainWidget::feedDifference(const MTPVector<MTPUser> &users, const MTPVector<MTPChat> &chats, const MTPVector<MTPMessage> &msgs, const MTPVector<MTPUpdate> &other) {
+	uint64 ms = getms(true);
 	App::wnd()->checkAutoLock();
 	App::feedUsers(users);
 	App::feedChats(chats);
@@ -2364,6 +2363,10 @@ void MainWidget::feedDifference(const MTPVector<MTPUser> &users, const MTPVector
 	App::feedMsgs(msgs, 1);
 	feedUpdates(other, true);
 	history.peerMessagesUpdated();
+	static MetricHandle updatesDifferenceMsMetric = metricHistogram(qsl("updates.difference_ms"));
+	metricSample(updatesDifferenceMsMetric, getms(true) - ms);
+	static MetricHandle updatesDifferenceItemsMetric = metricCounter(qsl("updates.difference_items"));
+	metricAdd(updatesDifferenceItemsMetric, users.c_vector().v.size() + chats.c_vector().v.size() + msgs.c_vector().v.size() + other.c_vector().v.size());
 }
 
 bool MainWidget::failDifference(const RPCError &error) {
@@ -2434,6 +2437,13 @@ bool MainWidget::started() {
 	return _started;
 }
 
+void MainWidget::audioInited() {
+	if (audioVoice()) {
+		connect(audioVoice(), SIGNAL(updated(AudioData*)), this, SLOT(audioPlayProgress(AudioData*)), Qt::UniqueConnection);
+		connect(audioVoice(), SIGNAL(stopped(AudioData*)), this, SLOT(audioPlayProgress(AudioData*)), Qt::UniqueConnection);
+	}
+}
+
 void MainWidget::openLocalUrl(const QString &url) {
 	QString u(url.trimmed());
 	if (u.startsWith(QLatin1String("tg://resolve"), Qt::CaseInsensitive)) {
@@ -2864,290 +2874,252 @@ void MainWidget::handleUpdates(const MTPUpdates &updates) {
 	}
 }
 
+struct MainWidget::FeedUpdateVisitor {
+	FeedUpdateVisitor(MainWidget *main, const MTPUpdate &update) : main(main), update(update) {
+	}
+	template <typename UpdateData>
+	void operator()(const UpdateData &d) {
+		main->feedUpdateData(update, d);
+	}
+	MainWidget *main;
+	const MTPUpdate &update;
+};
+
 void MainWidget::feedUpdate(const MTPUpdate &update) {
 	if (!MTP::authedId()) return;
 
-	switch (update.type()) {
-	case mtpc_updateNewMessage: {
-		const MTPDupdateNewMessage &d(update.c_updateNewMessage());
-		if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
-			_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
-			return;
-		}
-		HistoryItem *item = App::histories().addToBack(d.vmessage);
-		if (item) {
-			history.peerMessagesUpdated(item->history()->peer->id);
-		}
-	} break;
+	FeedUpdateVisitor visitor(this, update);
+	mtpVisit(update, visitor);
+}
 
-	case mtpc_updateMessageID: {
-		const MTPDupdateMessageID &d(update.c_updateMessageID());
-		MsgId msg = App::histItemByRandom(d.vrandom_id.v);
-		if (msg) {
-			HistoryItem *msgRow = App::histItemById(msg);
-			if (msgRow) {
-				App::historyUnregItem(msgRow);
-				History *h = msgRow->history();
-				for (int32 i = 0; i < OverviewCount; ++i) {
-					History::MediaOverviewIds::iterator j = h->_overviewIds[i].find(msgRow->id);
-					if (j != h->_overviewIds[i].cend()) {
-						h->_overviewIds[i].erase(j);
-						if (h->_overviewIds[i].constFind(d.vid.v) == h->_overviewIds[i].cend()) {
-							h->_overviewIds[i].insert(d.vid.v, NullType());
-							for (int32 k = 0, l = h->_overview[i].size(); k != l; ++k) {
-								if (h->_overview[i].at(k) == msgRow->id) {
-									h->_overview[i][k] = d.vid.v;
-									break;
-								}
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateNewMessage &d) {
+	if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
+		_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
+		return;
+	}
+	HistoryItem *item = App::histories().addToBack(d.vmessage);
+	if (item) {
+		history.peerMessagesUpdated(item->history()->peer->id);
+	}
+}
+
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateMessageID &d) {
+	MsgId msg = App::histItemByRandom(d.vrandom_id.v);
+	if (msg) {
+		HistoryItem *msgRow = App::histItemById(msg);
+		if (msgRow) {
+			App::historyUnregItem(msgRow);
+			History *h = msgRow->history();
+			for (int32 i = 0; i < OverviewCount; ++i) {
+				History::MediaOverviewIds::iterator j = h->_overviewIds[i].find(msgRow->id);
+				if (j != h->_overviewIds[i].cend()) {
+					h->_overviewIds[i].erase(j);
+					if (h->_overviewIds[i].constFind(d.vid.v) == h->_overviewIds[i].cend()) {
+						h->_overviewIds[i].insert(d.vid.v, NullType());
+						for (int32 k = 0, l = h->_overview[i].size(); k != l; ++k) {
+							if (h->_overview[i].at(k) == msgRow->id) {
+								h->_overview[i][k] = d.vid.v;
+								break;
 							}
 						}
 					}
 				}
-				if (App::wnd()) App::wnd()->changingMsgId(msgRow, d.vid.v);
-				msgRow->id = d.vid.v;
-				if (!App::historyRegItem(msgRow)) {
-					msgUpdated(h->peer->id, msgRow);
-				} else {
-					msgRow->destroy();
-					history.peerMessagesUpdated();
-				}
 			}
-			App::historyUnregRandom(d.vrandom_id.v);
-		}
-	} break;
-
-	case mtpc_updateReadMessages: {
-		const MTPDupdateReadMessages &d(update.c_updateReadMessages());
-		if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
-			_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
-			return;
+			if (App::wnd()) App::wnd()->changingMsgId(msgRow, d.vid.v);
+			msgRow->id = d.vid.v;
+			if (!App::historyRegItem(msgRow)) {
+				msgUpdated(h->peer->id, msgRow);
+			} else {
+				msgRow->destroy();
+				history.peerMessagesUpdated();
+			}
 		}
-		App::feedWereRead(d.vmessages.c_vector().v);
-	} break;
+		App::historyUnregRandom(d.vrandom_id.v);
+	}
+}
 
-	case mtpc_updateReadHistoryInbox: {
-		const MTPDupdateReadHistoryInbox &d(update.c_updateReadHistoryInbox());
-		if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
-			_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
-			return;
-		}
-		App::feedInboxRead(App::peerFromMTP(d.vpeer), d.vmax_id.v);
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateReadMessages &d) {
+	if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
+		_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
+		return;
+	}
+	App::feedWereRead(d.vmessages.c_vector().v);
+}
 
-	case mtpc_updateReadHistoryOutbox: {
-		const MTPDupdateReadHistoryOutbox &d(update.c_updateReadHistoryOutbox());
-		if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
-			_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
-			return;
-		}
-		PeerId peer = App::peerFromMTP(d.vpeer);
-		App::feedOutboxRead(peer, d.vmax_id.v);
-		if (history.peer() && history.peer()->id == peer) history.update();
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateReadHistoryInbox &d) {
+	if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
+		_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
+		return;
+	}
+	App::feedInboxRead(App::peerFromMTP(d.vpeer), d.vmax_id.v);
+}
 
-	case mtpc_updateWebPage: {
-		const MTPDupdateWebPage &d(update.c_updateWebPage());
-		App::feedWebPage(d.vwebpage);
-		history.updatePreview();
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateReadHistoryOutbox &d) {
+	if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
+		_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
+		return;
+	}
+	PeerId peer = App::peerFromMTP(d.vpeer);
+	App::feedOutboxRead(peer, d.vmax_id.v);
+	if (history.peer() && history.peer()->id == peer) history.update();
+}
 
-	case mtpc_updateDeleteMessages: {
-		const MTPDupdateDeleteMessages &d(update.c_updateDeleteMessages());
-		if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
-			_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
-			return;
-		}
-		App::feedWereDeleted(d.vmessages.c_vector().v);
-		history.peerMessagesUpdated();
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateWebPage &d) {
+	App::feedWebPage(d.vwebpage);
+	history.updatePreview();
+}
 
-	case mtpc_updateUserTyping: {
-		const MTPDupdateUserTyping &d(update.c_updateUserTyping());
-		History *history = App::historyLoaded(App::peerFromUser(d.vuser_id));
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (history && user) {
-			if (d.vaction.type() == mtpc_sendMessageTypingAction) {
-				App::histories().regTyping(history, user);
-			} else if (d.vaction.type() == mtpc_sendMessageCancelAction) {
-				history->unregTyping(user);
-			}
-		}
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateDeleteMessages &d) {
+	if (!updPtsUpdated(d.vpts.v, d.vpts_count.v)) {
+		_byPtsUpdate.insert(ptsKey(SkippedUpdate), update);
+		return;
+	}
+	App::feedWereDeleted(d.vmessages.c_vector().v);
+	history.peerMessagesUpdated();
+}
 
-	case mtpc_updateChatUserTyping: {
-		const MTPDupdateChatUserTyping &d(update.c_updateChatUserTyping());
-		History *history = App::historyLoaded(App::peerFromChat(d.vchat_id));
-		UserData *user = (d.vuser_id.v == MTP::authedId()) ? 0 : App::userLoaded(d.vuser_id.v);
-		if (history && user) {
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateUserTyping &d) {
+	History *history = App::historyLoaded(App::peerFromUser(d.vuser_id));
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (history && user) {
+		if (d.vaction.type() == mtpc_sendMessageTypingAction) {
 			App::histories().regTyping(history, user);
+		} else if (d.vaction.type() == mtpc_sendMessageCancelAction) {
+			history->unregTyping(user);
 		}
-	} break;
+	}
+}
 
-	case mtpc_updateChatParticipants: {
-		const MTPDupdateChatParticipants &d(update.c_updateChatParticipants());
-		App::feedParticipants(d.vparticipants);
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateChatUserTyping &d) {
+	History *history = App::historyLoaded(App::peerFromChat(d.vchat_id));
+	UserData *user = (d.vuser_id.v == MTP::authedId()) ? 0 : App::userLoaded(d.vuser_id.v);
+	if (history && user) {
+		App::histories().regTyping(history, user);
+	}
+}
 
-	case mtpc_updateChatParticipantAdd: {
-		const MTPDupdateChatParticipantAdd &d(update.c_updateChatParticipantAdd());
-		App::feedParticipantAdd(d);
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipants &d) {
+	App::feedParticipants(d.vparticipants);
+}
 
-	case mtpc_updateChatParticipantDelete: {
-		const MTPDupdateChatParticipantDelete &d(update.c_updateChatParticipantDelete());
-		App::feedParticipantDelete(d);
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipantAdd &d) {
+	App::feedParticipantAdd(d);
+}
 
-	case mtpc_updateUserStatus: {
-		const MTPDupdateUserStatus &d(update.c_updateUserStatus());
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (user) {
-			switch (d.vstatus.type()) {
-			case mtpc_userStatusEmpty: user->onlineTill = 0; break;
-			case mtpc_userStatusRecently:
-				if (user->onlineTill > -10) { // don't modify pseudo-online
-					user->onlineTill = -2;
-				}
-			break;
-			case mtpc_userStatusLastWeek: user->onlineTill = -3; break;
-			case mtpc_userStatusLastMonth: user->onlineTill = -4; break;
-			case mtpc_userStatusOffline: user->onlineTill = d.vstatus.c_userStatusOffline().vwas_online.v; break;
-			case mtpc_userStatusOnline: user->onlineTill = d.vstatus.c_userStatusOnline().vexpires.v; break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipantDelete &d) {
+	App::feedParticipantDelete(d);
+}
+
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateUserStatus &d) {
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (user) {
+		switch (d.vstatus.type()) {
+		case mtpc_userStatusEmpty: user->onlineTill = 0; break;
+		case mtpc_userStatusRecently:
+			if (user->onlineTill > -10) { // don't modify pseudo-online
+				user->onlineTill = -2;
 			}
-			if (App::main()) App::main()->peerUpdated(user);
-		}
-		if (d.vuser_id.v == MTP::authedId()) {
-			if (d.vstatus.type() == mtpc_userStatusOffline || d.vstatus.type() == mtpc_userStatusEmpty) {
-				updateOnline(true);
-				if (d.vstatus.type() == mtpc_userStatusOffline) {
-					cSetOtherOnline(d.vstatus.c_userStatusOffline().vwas_online.v);
-				}
-			} else if (d.vstatus.type() == mtpc_userStatusOnline) {
-				cSetOtherOnline(d.vstatus.c_userStatusOnline().vexpires.v);
+		break;
+		case mtpc_userStatusLastWeek: user->onlineTill = -3; break;
+		case mtpc_userStatusLastMonth: user->onlineTill = -4; break;
+		case mtpc_userStatusOffline: user->onlineTill = d.vstatus.c_userStatusOffline().vwas_online.v; break;
+		case mtpc_userStatusOnline: user->onlineTill = d.vstatus.c_userStatusOnline().vexpires.v; break;
+		}
+		if (App::main()) App::main()->peerUpdated(user);
+	}
+	if (d.vuser_id.v == MTP::authedId()) {
+		if (d.vstatus.type() == mtpc_userStatusOffline || d.vstatus.type() == mtpc_userStatusEmpty) {
+			updateOnline(true);
+			if (d.vstatus.type() == mtpc_userStatusOffline) {
+				cSetOtherOnline(d.vstatus.c_userStatusOffline().vwas_online.v);
 			}
+		} else if (d.vstatus.type() == mtpc_userStatusOnline) {
+			cSetOtherOnline(d.vstatus.c_userStatusOnline().vexpires.v);
 		}
-	} break;
+	}
+}
 
-	case mtpc_updateUserName: {
-		const MTPDupdateUserName &d(update.c_updateUserName());
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (user) {
-			if (user->contact <= 0) {
-				user->setName(textOneLine(qs(d.vfirst_name)), textOneLine(qs(d.vlast_name)), user->nameOrPhone, textOneLine(qs(d.vusername)));
-			} else {
-				user->setName(textOneLine(user->firstName), textOneLine(user->lastName), user->nameOrPhone, textOneLine(qs(d.vusername)));
-			}
-			if (App::main()) App::main()->peerUpdated(user);
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateUserName &d) {
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (user) {
+		if (user->contact <= 0) {
+			user->setName(textOneLine(qs(d.vfirst_name)), textOneLine(qs(d.vlast_name)), user->nameOrPhone, textOneLine(qs(d.vusername)));
+		} else {
+			user->setName(textOneLine(user->firstName), textOneLine(user->lastName), user->nameOrPhone, textOneLine(qs(d.vusername)));
 		}
-	} break;
+		if (App::main()) App::main()->peerUpdated(user);
+	}
+}
 
-	case mtpc_updateUserPhoto: {
-		const MTPDupdateUserPhoto &d(update.c_updateUserPhoto());
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (user) {
-			user->setPhoto(d.vphoto);
-			user->photo->load();
-			if (d.vprevious.v) {
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateUserPhoto &d) {
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (user) {
+		user->setPhoto(d.vphoto);
+		user->photo->load();
+		if (d.vprevious.v) {
+			user->photosCount = -1;
+			user->photos.clear();
+		} else {
+			if (user->photoId) {
+				if (user->photosCount > 0) ++user->photosCount;
+				user->photos.push_front(App::photo(user->photoId));
+			} else {
 				user->photosCount = -1;
 				user->photos.clear();
-			} else {
-				if (user->photoId) {
-					if (user->photosCount > 0) ++user->photosCount;
-					user->photos.push_front(App::photo(user->photoId));
-				} else {
-					user->photosCount = -1;
-					user->photos.clear();
-				}
-			}
-			if (App::main()) App::main()->peerUpdated(user);
-			if (App::wnd()) App::wnd()->mediaOverviewUpdated(user);
-		}
-	} break;
-
-	case mtpc_updateContactRegistered: {
-		const MTPDupdateContactRegistered &d(update.c_updateContactRegistered());
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (user) {
-			if (App::history(user->id)->loadedAtBottom()) {
-				App::history(user->id)->addToBackService(clientMsgId(), date(d.vdate), lng_action_user_registered(lt_from, user->name), MTPDmessage_flag_unread);
 			}
 		}
-	} break;
-
-	case mtpc_updateContactLink: {
-		const MTPDupdateContactLink &d(update.c_updateContactLink());
-		App::feedUserLink(d.vuser_id, d.vmy_link, d.vforeign_link);
-	} break;
-
-	case mtpc_updateNotifySettings: {
-		const MTPDupdateNotifySettings &d(update.c_updateNotifySettings());
-		applyNotifySetting(d.vpeer, d.vnotify_settings);
-	} break;
-
-	case mtpc_updateDcOptions: {
-		const MTPDupdateDcOptions &d(update.c_updateDcOptions());
-		MTP::updateDcOptions(d.vdc_options.c_vector().v);
-	} break;
+		if (App::main()) App::main()->peerUpdated(user);
+		if (App::wnd()) App::wnd()->mediaOverviewUpdated(user);
+	}
+}
 
-	case mtpc_updateUserPhone: {
-		const MTPDupdateUserPhone &d(update.c_updateUserPhone());
-		UserData *user = App::userLoaded(d.vuser_id.v);
-		if (user) {
-			user->setPhone(qs(d.vphone));
-			user->setName(user->firstName, user->lastName, (user->contact || isServiceUser(user->id) || user->phone.isEmpty()) ? QString() : App::formatPhone(user->phone), user->username);
-			if (App::main()) App::main()->peerUpdated(user);
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateContactRegistered &d) {
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (user) {
+		if (App::history(user->id)->loadedAtBottom()) {
+			App::history(user->id)->addToBackService(clientMsgId(), date(d.vdate), lng_action_user_registered(lt_from, user->name), MTPDmessage_flag_unread);
 		}
-	} break;
-
-	case mtpc_updateNewGeoChatMessage: {
-		const MTPDupdateNewGeoChatMessage &d(update.c_updateNewGeoChatMessage());
-	} break;
-
-	case mtpc_updateNewEncryptedMessage: {
-		const MTPDupdateNewEncryptedMessage &d(update.c_updateNewEncryptedMessage());
-	} break;
-
-	case mtpc_updateEncryptedChatTyping: {
-		const MTPDupdateEncryptedChatTyping &d(update.c_updateEncryptedChatTyping());
-	} break;
+	}
+}
 
-	case mtpc_updateEncryption: {
-		const MTPDupdateEncryption &d(update.c_updateEncryption());
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateContactLink &d) {
+	App::feedUserLink(d.vuser_id, d.vmy_link, d.vforeign_link);
+}
 
-	case mtpc_updateEncryptedMessagesRead: {
-		const MTPDupdateEncryptedMessagesRead &d(update.c_updateEncryptedMessagesRead());
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateNotifySettings &d) {
+	applyNotifySetting(d.vpeer, d.vnotify_settings);
+}
 
-	case mtpc_updateUserBlocked: {
-		const MTPDupdateUserBlocked &d(update.c_updateUserBlocked());
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateDcOptions &d) {
+	MTP::updateDcOptions(d.vdc_options.c_vector().v);
+}
 
-	case mtpc_updateNewAuthorization: {
-		const MTPDupdateNewAuthorization &d(update.c_updateNewAuthorization());
-		QDateTime datetime = date(d.vdate);
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateUserPhone &d) {
+	UserData *user = App::userLoaded(d.vuser_id.v);
+	if (user) {
+		user->setPhone(qs(d.vphone));
+		user->setName(user->firstName, user->lastName, (user->contact || isServiceUser(user->id) || user->phone.isEmpty()) ? QString() : App::formatPhone(user->phone), user->username);
+		if (App::main()) App::main()->peerUpdated(user);
+	}
+}
 
-		QString name = App::self()->firstName;
-		QString day = langDayOfWeekFull(datetime.date()), date = langDayOfMonth(datetime.date()), time = datetime.time().toString(cTimeFormat());
-		QString device = qs(d.vdevice), location = qs(d.vlocation);
-		LangString text = lng_new_authorization(lt_name, App::self()->firstName, lt_day, day, lt_date, date, lt_time, time, lt_device, device, lt_location, location);
-		App::wnd()->serviceNotification(text);
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateNewAuthorization &d) {
+	QDateTime datetime = date(d.vdate);
 
-		emit App::wnd()->newAuthorization();
-	} break;
+	QString name = App::self()->firstName;
+	QString day = langDayOfWeekFull(datetime.date()), date = langDayOfMonth(datetime.date()), time = datetime.time().toString(cTimeFormat());
+	QString device = qs(d.vdevice), location = qs(d.vlocation);
+	LangString text = lng_new_authorization(lt_name, App::self()->firstName, lt_day, day, lt_date, date, lt_time, time, lt_device, device, lt_location, location);
+	App::wnd()->serviceNotification(text);
 
-	case mtpc_updateServiceNotification: {
-		const MTPDupdateServiceNotification &d(update.c_updateServiceNotification());
-		if (d.vpopup.v) {
-			App::wnd()->showLayer(new ConfirmBox(qs(d.vmessage), true));
-			App::wnd()->serviceNotification(qs(d.vmessage), false, d.vmedia);
-		} else {
-			App::wnd()->serviceNotification(qs(d.vmessage), true, d.vmedia);
-		}
-	} break;
+	emit App::wnd()->newAuthorization();
+}
 
-	case mtpc_updatePrivacy: {
-		const MTPDupdatePrivacy &d(update.c_updatePrivacy());
-	} break;
+void MainWidget::feedUpdateData(const MTPUpdate &update, const MTPDupdateServiceNotification &d) {
+	if (d.vpopup.v) {
+		App::wnd()->showLayer(new ConfirmBox(qs(d.vmessage), true));
+		App::wnd()->serviceNotification(qs(d.vmessage), false, d.vmedia);
+	} else {
+		App::wnd()->serviceNotification(qs(d.vmessage), true, d.vmedia);
 	}
 }
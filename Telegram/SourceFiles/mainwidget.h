@@ -189,6 +189,7 @@ public:
 	void openUserByName(const QString &name, bool toProfile = false);
 	void startFull(const MTPVector<MTPUser> &users);
 	bool started();
+	void audioInited(); // audio device is opened after the first frame, see App::initMediaDelayed()
 	void applyNotifySetting(const MTPNotifyPeer &peer, const MTPPeerNotifySettings &settings, History *history = 0);
 	void gotNotifySetting(MTPInputNotifyPeer peer, const MTPPeerNotifySettings &settings);
 	bool failNotifySetting(MTPInputNotifyPeer peer, const RPCError &error);
@@ -423,6 +424,34 @@ private:
 	void feedMessageIds(const MTPVector<MTPUpdate> &updates);
 	void feedUpdate(const MTPUpdate &update);
 
+	struct FeedUpdateVisitor; // passes the update data to the feedUpdateData() overload for its constructor
+	friend struct FeedUpdateVisitor;
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateNewMessage &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateMessageID &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateReadMessages &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateReadHistoryInbox &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateReadHistoryOutbox &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateWebPage &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateDeleteMessages &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateUserTyping &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateChatUserTyping &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipants &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipantAdd &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateChatParticipantDelete &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateUserStatus &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateUserName &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateUserPhoto &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateContactRegistered &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateContactLink &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateNotifySettings &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateDcOptions &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateUserPhone &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateNewAuthorization &d);
+	void feedUpdateData(const MTPUpdate &update, const MTPDupdateServiceNotification &d);
+	template <typename UpdateData>
+	void feedUpdateData(const MTPUpdate &update, const UpdateData &d) { // updates without a handler are ignored
+	}
+
 	void updateReceived(const mtpPrime *from, const mtpPrime *end);
 	void handleUpdates(const MTPUpdates &updates);
 	bool updateFail(const RPCError &e);
@@ -390,6 +390,7 @@ for restype in typesList:
   sizeFast = '';
   newFast = '';
   sizeCases = '';
+  visitCases = '';
   for data in v:
     name = data[0];
     typeid = data[1];
@@ -469,7 +470,8 @@ for restype in typesList:
         paramType = prms[paramName];
         dataText += '\tMTP' + paramType + ' v' + paramName + ';\n';
       sizeCases += '\t\tcase mtpc_' + name + ': {\n';
-      sizeCases += '\t\t\tconst MTPD' + name + ' &v(c_' + name + '());\n';
+      sizeCases += '\t\t\tconst MTPD' + name + ' &v(*(const MTPD' + name + '*)data);\n'; # type is checked by switch
+      visitCases += '\tcase mtpc_' + name + ': visitor(*(const MTPD' + name + '*)value.data); return true;\n';
       sizeCases += '\t\t\treturn ' + ' + '.join(sizeList) + ';\n';
       sizeCases += '\t\t}\n';
       sizeFast = '\tconst MTPD' + name + ' &v(c_' + name + '());\n\treturn ' + ' + '.join(sizeList) + ';\n';
@@ -509,12 +511,13 @@ for restype in typesList:
       if (len(prms)):
         reader += '{\n';
         reader += '\t\t\tif (!data) setData(new MTPD' + name + '());\n';
-        reader += '\t\t\tMTPD' + name + ' &v(_' + name + '());\n';
+        reader += '\t\t\tsplit();\n';
+        reader += '\t\t\tMTPD' + name + ' &v(*(MTPD' + name + '*)data);\n'; # type is checked by switch
         reader += readText;
         reader += '\t\t} break;\n';
 
         writer += '\t\tcase mtpc_' + name + ': {\n'; # write switch line
-        writer += '\t\t\tconst MTPD' + name + ' &v(c_' + name + '());\n';
+        writer += '\t\t\tconst MTPD' + name + ' &v(*(const MTPD' + name + '*)data);\n'; # type is checked by switch
         writer += writeText;
         writer += '\t\t} break;\n';
       else:
@@ -639,6 +642,17 @@ for restype in typesList:
     typesText += constructsText;
     inlineMethods += constructsInline;
 
+  if (withType and visitCases): # one switch dispatch to visitor(const MTPD* &) without repeated type checks
+    friendDecl += '\ttemplate <typename Visitor>\n';
+    friendDecl += '\tfriend bool mtpVisit(const MTP' + restype + ' &value, Visitor &visitor);\n';
+    creatorsText += 'template <typename Visitor>\n';
+    creatorsText += 'inline bool mtpVisit(const MTP' + restype + ' &value, Visitor &visitor) {\n';
+    creatorsText += '\tswitch (value._type) {\n';
+    creatorsText += visitCases;
+    creatorsText += '\t}\n';
+    creatorsText += '\treturn false; // constructor without data\n';
+    creatorsText += '}\n';
+
   if (friendDecl):
     typesText += '\n' + friendDecl;
 
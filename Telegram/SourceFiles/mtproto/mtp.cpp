@@ -25,10 +25,6 @@ namespace {
 	Sessions sessions;
 	MTProtoSessionPtr mainSession;
 
-	typedef QMap<mtpRequestId, int32> RequestsByDC; // holds dc for request to this dc or -dc for request to main dc
-	RequestsByDC requestsByDC;
-	QMutex requestByDCLock;
-
 	typedef QMap<mtpRequestId, int32> AuthExportRequests; // holds target dc for auth export request
 	AuthExportRequests authExportRequests;
 
@@ -36,13 +32,87 @@ namespace {
 
 	uint32 layer;
 	
-	typedef QMap<mtpRequestId, RPCResponseHandler> ParserMap;
-	ParserMap parserMap;
-	QMutex parserMapLock;
+	struct RequestInfo {
+		RequestInfo() : dc(0) {
+		}
+		mtpRequest request;
+		RPCResponseHandler parser;
+		int32 dc; // holds dc for request to this dc or -dc for request to main dc
+	};
+	inline bool requestInfoEmpty(const RequestInfo &info) {
+		return !info.request && !info.parser.onDone && !info.parser.onFail && !info.dc;
+	}
+
+	// requests are spread by id between shards, so that sessions of different dcs
+	// dispatching responses at the same time rarely wait for the same lock
+	typedef QHash<mtpRequestId, RequestInfo> RequestInfos;
+	struct RequestsShard {
+		RequestInfos infos;
+		QReadWriteLock lock;
+	};
+	RequestsShard requestsShards[MTPRequestsShardsCount];
+
+	inline RequestsShard &requestsShard(mtpRequestId requestId) {
+		return requestsShards[uint32(requestId) % MTPRequestsShardsCount];
+	}
+
+	mtpRequest findRequest(mtpRequestId requestId) {
+		RequestsShard &shard(requestsShard(requestId));
+		QReadLocker locker(&shard.lock);
+		RequestInfos::const_iterator i = shard.infos.constFind(requestId);
+		return (i == shard.infos.cend()) ? mtpRequest() : i.value().request;
+	}
+
+	int32 findRequestDC(mtpRequestId requestId) { // 0 if not found
+		RequestsShard &shard(requestsShard(requestId));
+		QReadLocker locker(&shard.lock);
+		RequestInfos::const_iterator i = shard.infos.constFind(requestId);
+		return (i == shard.infos.cend()) ? 0 : i.value().dc;
+	}
+
+	void setRequestDC(mtpRequestId requestId, int32 dc) {
+		RequestsShard &shard(requestsShard(requestId));
+		QWriteLocker locker(&shard.lock);
+		shard.infos[requestId].dc = dc;
+	}
+
+	void setRequestParser(mtpRequestId requestId, const RPCResponseHandler &parser) {
+		RequestsShard &shard(requestsShard(requestId));
+		QWriteLocker locker(&shard.lock);
+		shard.infos[requestId].parser = parser;
+	}
+
+	bool takeRequestParser(mtpRequestId requestId, RPCResponseHandler &parser) {
+		RequestsShard &shard(requestsShard(requestId));
+		QWriteLocker locker(&shard.lock);
+		RequestInfos::iterator i = shard.infos.find(requestId);
+		if (i == shard.infos.end() || (!i.value().parser.onDone && !i.value().parser.onFail)) return false;
 
-	typedef QMap<mtpRequestId, mtpRequest> RequestMap;
-	RequestMap requestMap;
-	QReadWriteLock requestMapLock;
+		parser = i.value().parser;
+		i.value().parser = RPCResponseHandler();
+		if (requestInfoEmpty(i.value())) shard.infos.erase(i);
+		return true;
+	}
+
+	bool hasRequestParser(mtpRequestId requestId) {
+		RequestsShard &shard(requestsShard(requestId));
+		QReadLocker locker(&shard.lock);
+		RequestInfos::const_iterator i = shard.infos.constFind(requestId);
+		return (i != shard.infos.cend()) && (i.value().parser.onDone || i.value().parser.onFail);
+	}
+
+	void removeRequest(mtpRequestId requestId, mtpMsgId *msgId = 0, int32 *dc = 0) { // keeps parser, it is cleared separately
+		RequestsShard &shard(requestsShard(requestId));
+		QWriteLocker locker(&shard.lock);
+		RequestInfos::iterator i = shard.infos.find(requestId);
+		if (i == shard.infos.end()) return;
+
+		if (msgId && i.value().request) *msgId = *(mtpMsgId*)(i.value().request->constData() + 4);
+		if (dc) *dc = i.value().dc;
+		i.value().request = mtpRequest();
+		i.value().dc = 0;
+		if (requestInfoEmpty(i.value())) shard.infos.erase(i);
+	}
 
 	typedef QPair<mtpRequestId, uint64> DelayedRequest;
 	typedef QList<DelayedRequest> DelayedRequestsList;
@@ -67,45 +137,42 @@ namespace {
 	_mtp_internal::RequestResender *resender = 0;
 
 	void importDone(const MTPauth_Authorization &result, mtpRequestId req) {
-		QMutexLocker locker1(&requestByDCLock);
-
-		RequestsByDC::iterator i = requestsByDC.find(req);
-		if (i == requestsByDC.end()) {
-			LOG(("MTP Error: auth import request not found in requestsByDC, requestId: %1").arg(req));
-			RPCError error(rpcClientError("AUTH_IMPORT_FAIL", QString("did not find import request in requestsByDC, request %1").arg(req)));
+		int32 newdc = findRequestDC(req);
+		if (!newdc) {
+			LOG(("MTP Error: auth import request not found in requests registry, requestId: %1").arg(req));
+			RPCError error(rpcClientError("AUTH_IMPORT_FAIL", QString("did not find import request in requests registry, request %1").arg(req)));
 			if (globalHandler.onFail && MTP::authedId()) (*globalHandler.onFail)(req, error); // auth failed in main dc
 			return;
 		}
-		int32 newdc = i.value();
 
 		DEBUG_LOG(("MTP Info: auth import to dc %1 succeeded").arg(newdc));
 
 		DCAuthWaiters &waiters(authWaiters[newdc]);
 		MTProtoSessionPtr session(_mtp_internal::getSession(newdc));
 		if (waiters.size()) {
-			QReadLocker locker(&requestMapLock);
 			for (DCAuthWaiters::iterator i = waiters.begin(), e = waiters.end(); i != e; ++i) {
 				mtpRequestId requestId = *i;
-				RequestMap::const_iterator j = requestMap.constFind(requestId);
-				if (j == requestMap.cend()) {
+				mtpRequest req(findRequest(requestId));
+				if (!req) {
 					LOG(("MTP Error: could not find request %1 for resending").arg(requestId));
 					continue;
 				}
 				{
-					RequestsByDC::iterator k = requestsByDC.find(requestId);
-					if (k == requestsByDC.cend()) {
+					int32 dc = findRequestDC(requestId);
+					if (!dc) {
 						LOG(("MTP Error: could not find request %1 by dc for resending").arg(requestId));
 						continue;
 					}
-					if (k.value() < 0) {
+					if (dc < 0) {
 						MTP::setdc(newdc);
-						k.value() = -newdc;
+						dc = -newdc;
 					} else {
-						k.value() = k.value() - (k.value() % _mtp_internal::dcShift) + newdc;
+						dc = dc - (dc % _mtp_internal::dcShift) + newdc;
 					}
-					DEBUG_LOG(("MTP Info: resending request %1 to dc %2 after import auth").arg(requestId).arg(k.value()));
+					setRequestDC(requestId, dc);
+					DEBUG_LOG(("MTP Info: resending request %1 to dc %2 after import auth").arg(requestId).arg(dc));
 				}
-				session->sendPrepared(j.value());
+				session->sendPrepared(req);
 			}
 			waiters.clear();
 		}
@@ -151,15 +218,9 @@ namespace {
 		if ((m = QRegularExpression("^(FILE|PHONE|NETWORK|USER)_MIGRATE_(\\d+)$").match(err)).hasMatch()) {
 			if (!requestId) return false;
 
-			int32 dc = 0, newdc = m.captured(2).toInt();
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 for migrating to %2").arg(requestId).arg(newdc));
-				} else {
-					dc = i.value();
-				}
+			int32 dc = findRequestDC(requestId), newdc = m.captured(2).toInt();
+			if (!dc) {
+				LOG(("MTP Error: could not find request %1 for migrating to %2").arg(requestId).arg(newdc));
 			}
 			if (!dc || !newdc) return false;
 
@@ -178,15 +239,10 @@ namespace {
 				}
 			}
 
-			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			mtpRequest req(findRequest(requestId));
+			if (!req) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
 			_mtp_internal::registerRequest(requestId, (dc < 0) ? -newdc : newdc);
 			_mtp_internal::getSession(newdc)->sendPrepared(req);
@@ -218,15 +274,9 @@ namespace {
 
 			return true;
 		} else if (code == 401 || (badGuestDC && badGuestDCRequests.constFind(requestId) == badGuestDCRequests.cend())) {
-			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i != requestsByDC.end()) {
-					dc = i.value();
-				} else {
-					LOG(("MTP Error: unauthorized request without dc info, requestId %1").arg(requestId));
-				}
+			int32 dc = findRequestDC(requestId);
+			if (!dc) {
+				LOG(("MTP Error: unauthorized request without dc info, requestId %1").arg(requestId));
 			}
 			int32 newdc = abs(dc) % _mtp_internal::dcShift;
 			if (!newdc || newdc == mtpMainDC() || !MTP::authedId()) {
@@ -243,62 +293,40 @@ namespace {
 			if (badGuestDC) badGuestDCRequests.insert(requestId);
 			return true;
 		} else if (err == qsl("CONNECTION_NOT_INITED") || err == qsl("CONNECTION_LAYER_INVALID")) {
-			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			mtpRequest req(findRequest(requestId));
+			if (!req) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
-			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 for resending with init connection").arg(requestId));
-				} else {
-					dc = i.value();
-				}
+			int32 dc = findRequestDC(requestId);
+			if (!dc) {
+				LOG(("MTP Error: could not find request %1 for resending with init connection").arg(requestId));
+				return false;
 			}
-			if (!dc) return false;
 
 			req->needsLayer = true;
 			_mtp_internal::getSession(dc < 0 ? (-dc) : dc)->sendPrepared(req);
 			return true;
 		} else if (err == qsl("MSG_WAIT_FAILED")) {
-			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			mtpRequest req(findRequest(requestId));
+			if (!req) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
 			if (!req->after) {
 				LOG(("MTP Error: wait failed for not dependent request %1").arg(requestId));
 				return false;
 			}
-			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId), j = requestsByDC.find(req->after->requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 by dc").arg(requestId));
-				} else if (j == requestsByDC.end()) {
-					LOG(("MTP Error: could not find dependent request %1 by dc").arg(req->after->requestId));
-				} else {
-					dc = i.value();
-					if (i.value() != j.value()) {
-						req->after = mtpRequest();
-					}
-				}
+			int32 dc = findRequestDC(requestId), afterDC = findRequestDC(req->after->requestId);
+			if (!dc) {
+				LOG(("MTP Error: could not find request %1 by dc").arg(requestId));
+				return false;
+			} else if (!afterDC) {
+				LOG(("MTP Error: could not find dependent request %1 by dc").arg(req->after->requestId));
+				return false;
+			} else if (dc != afterDC) {
+				req->after = mtpRequest();
 			}
-			if (!dc) return false;
 
 			if (!req->after) {
 				req->needsLayer = true;
@@ -356,48 +384,31 @@ namespace _mtp_internal {
 	}
 	
 	void registerRequest(mtpRequestId requestId, int32 dc) {
-		{
-			QMutexLocker locker(&requestByDCLock);
-			requestsByDC.insert(requestId, dc);
-		}
+		setRequestDC(requestId, dc);
 		_mtp_internal::performDelayedClear(); // need to do it somewhere..
 	}
 
 	void unregisterRequest(mtpRequestId requestId) {
 		requestsDelays.remove(requestId);
-
-		{
-			QWriteLocker locker(&requestMapLock);
-			requestMap.remove(requestId);
-		}
-
-		QMutexLocker locker(&requestByDCLock);
-		requestsByDC.remove(requestId);
+		removeRequest(requestId);
 	}
 
 	mtpRequestId storeRequest(mtpRequest &request, const RPCResponseHandler &parser) {
 		mtpRequestId res = reqid();
 		request->requestId = res;
+
+		RequestsShard &shard(requestsShard(res));
+		QWriteLocker locker(&shard.lock);
+		RequestInfo &info(shard.infos[res]);
+		info.request = request;
 		if (parser.onDone || parser.onFail) {
-			QMutexLocker locker(&parserMapLock);
-			parserMap.insert(res, parser);
-		}
-		{
-			QWriteLocker locker(&requestMapLock);
-			requestMap.insert(res, request);
+			info.parser = parser;
 		}
 		return res;
 	}
 
 	mtpRequest getRequest(mtpRequestId reqId) {
-		static mtpRequest zero;
-		mtpRequest req;
-		{
-			QReadLocker locker(&requestMapLock);
-			RequestMap::const_iterator i = requestMap.constFind(reqId);
-			req = (i == requestMap.cend()) ? zero : i.value();
-		}
-		return req;
+		return findRequest(reqId);
 	}
 
 	void wrapInvokeAfter(mtpRequest &to, const mtpRequest &from, const mtpRequestMap &haveSent, int32 skipBeforeRequest) {
@@ -425,17 +436,7 @@ namespace _mtp_internal {
 
 	void clearCallbacks(mtpRequestId requestId, int32 errorCode) {
 		RPCResponseHandler h;
-		bool found = false;
-		{
-			QMutexLocker locker(&parserMapLock);
-			ParserMap::iterator i = parserMap.find(requestId);
-			if (i != parserMap.end()) {
-				h = i.value();
-				found = true;
-
-				parserMap.erase(i);
-			}
-		}
+		bool found = takeRequestParser(requestId, h);
 		if (errorCode && found) {
 			rpcErrorOccured(requestId, h, rpcClientError("CLEAR_CALLBACK", QString("did not handle request %1, error code %2").arg(requestId).arg(errorCode)));
 		}
@@ -467,11 +468,8 @@ namespace _mtp_internal {
 		QMutexLocker lock(&toClearLock);
 		if (!toClear.isEmpty()) {
 			for (RPCCallbackClears::iterator i = toClear.begin(), e = toClear.end(); i != e; ++i) {
-				if (cDebug()) {
-					QMutexLocker locker(&parserMapLock);
-					if (parserMap.find(i->requestId) != parserMap.end()) {
-						DEBUG_LOG(("RPC Info: clearing delayed callback %1, error code %2").arg(i->requestId).arg(i->errorCode));
-					}
+				if (cDebug() && hasRequestParser(i->requestId)) {
+					DEBUG_LOG(("RPC Info: clearing delayed callback %1, error code %2").arg(i->requestId).arg(i->errorCode));
 				}
 				clearCallbacks(i->requestId, i->errorCode);
 				_mtp_internal::unregisterRequest(i->requestId);
@@ -482,15 +480,8 @@ namespace _mtp_internal {
 
 	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) {
 		RPCResponseHandler h;
-		{
-			QMutexLocker locker(&parserMapLock);
-			ParserMap::iterator i = parserMap.find(requestId);
-			if (i != parserMap.cend()) {
-				h = i.value();
-				parserMap.erase(i);
-
-				DEBUG_LOG(("RPC Info: found parser for request %1, trying to parse response..").arg(requestId));
-			}
+		if (takeRequestParser(requestId, h)) {
+			DEBUG_LOG(("RPC Info: found parser for request %1, trying to parse response..").arg(requestId));
 		}
 		if (h.onDone || h.onFail) {
 			try {
@@ -500,8 +491,7 @@ namespace _mtp_internal {
 					RPCError err(MTPRpcError(from, end));
 					DEBUG_LOG(("RPC Info: error received, code %1, type %2, description: %3").arg(err.code()).arg(err.type()).arg(err.description()));
 					if (!rpcErrorOccured(requestId, h, err)) {
-						QMutexLocker locker(&parserMapLock);
-						parserMap.insert(requestId, h);
+						setRequestParser(requestId, h);
 						return;
 					}
 				} else {
@@ -509,8 +499,7 @@ namespace _mtp_internal {
 				}
 			} catch (Exception &e) {
 				if (!rpcErrorOccured(requestId, h, rpcClientError("RESPONSE_PARSE_FAILED", QString("exception text: ") + e.what()))) {
-					QMutexLocker locker(&parserMapLock);
-					parserMap.insert(requestId, h);
+					setRequestParser(requestId, h);
 					return;
 				}
 			}
@@ -521,9 +510,7 @@ namespace _mtp_internal {
 	}
 
 	bool hasCallbacks(mtpRequestId requestId) {
-		QMutexLocker locker(&parserMapLock);
-		ParserMap::iterator i = parserMap.find(requestId);
-		return (i != parserMap.cend());
+		return hasRequestParser(requestId);
 	}
 
 	void globalCallback(const mtpPrime *from, const mtpPrime *end) {
@@ -561,27 +548,16 @@ namespace _mtp_internal {
 			mtpRequestId requestId = delayedRequests.front().first;
 			delayedRequests.pop_front();
 
-			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::const_iterator i = requestsByDC.constFind(requestId);
-				if (i != requestsByDC.cend()) {
-					dc = i.value();
-				} else {
-					LOG(("MTP Error: could not find request dc for delayed resend, requestId %1").arg(requestId));
-					continue;
-				}
+			int32 dc = findRequestDC(requestId);
+			if (!dc) {
+				LOG(("MTP Error: could not find request dc for delayed resend, requestId %1").arg(requestId));
+				continue;
 			}
 
-			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator j = requestMap.constFind(requestId);
-				if (j == requestMap.cend()) {
-					DEBUG_LOG(("MTP Error: could not find request %1").arg(requestId));
-					continue;
-				}
-				req = j.value();
+			mtpRequest req(findRequest(requestId));
+			if (!req) {
+				DEBUG_LOG(("MTP Error: could not find request %1").arg(requestId));
+				continue;
 			}
 			_mtp_internal::getSession(dc < 0 ? (-dc) : dc)->sendPrepared(req);
 		}
@@ -693,22 +669,11 @@ namespace MTP {
 
 	void cancel(mtpRequestId requestId) {
 		mtpMsgId msgId = 0;
+		int32 dc = 0;
 		requestsDelays.remove(requestId);
-		{
-			QWriteLocker locker(&requestMapLock);
-			RequestMap::iterator i = requestMap.find(requestId);
-			if (i != requestMap.end()) {
-				msgId = *(mtpMsgId*)(i.value()->constData() + 4);
-				requestMap.erase(i);
-			}
-		}
-		{
-			QMutexLocker locker(&requestByDCLock);
-			RequestsByDC::iterator i = requestsByDC.find(requestId);
-			if (i != requestsByDC.end()) {
-				_mtp_internal::getSession(abs(i.value()))->cancel(requestId, msgId);
-				requestsByDC.erase(i);
-			}
+		removeRequest(requestId, &msgId, &dc);
+		if (dc) {
+			_mtp_internal::getSession(abs(dc))->cancel(requestId, msgId);
 		}
 		_mtp_internal::clearCallbacks(requestId);
 	}
@@ -740,10 +705,9 @@ namespace MTP {
 
 	int32 state(mtpRequestId requestId) {
 		if (requestId > 0) {
-			QMutexLocker locker(&requestByDCLock);
-			RequestsByDC::iterator i = requestsByDC.find(requestId);
-			if (i != requestsByDC.end()) {
-				return _mtp_internal::getSession(abs(i.value()))->requestState(requestId);
+			int32 dc = findRequestDC(requestId);
+			if (dc) {
+				return _mtp_internal::getSession(abs(dc))->requestState(requestId);
 			}
 			return MTP::RequestSent;
 		}
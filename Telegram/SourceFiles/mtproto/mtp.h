@@ -91,15 +91,15 @@ namespace MTP {
 	QString dctransport(int32 dc = 0);
 	void initdc(int32 dc);
 	template <typename TRequest>
-	inline mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0) {
+	inline mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0, MTPRequestPriority priority = MTPRequestNormal) {
 		MTProtoSessionPtr session = _mtp_internal::getSession(dc);
 		if (!session) return 0;
 		
-		return session->send(request, callbacks, msCanWait, true, !dc, after);
+		return session->send(request, callbacks, msCanWait, true, !dc, after, priority);
 	}
 	template <typename TRequest>
-	inline mtpRequestId send(const TRequest &request, RPCDoneHandlerPtr onDone, RPCFailHandlerPtr onFail = RPCFailHandlerPtr(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0) {
-		return send(request, RPCResponseHandler(onDone, onFail), dc, msCanWait, after);
+	inline mtpRequestId send(const TRequest &request, RPCDoneHandlerPtr onDone, RPCFailHandlerPtr onFail = RPCFailHandlerPtr(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0, MTPRequestPriority priority = MTPRequestNormal) {
+		return send(request, RPCResponseHandler(onDone, onFail), dc, msCanWait, after, priority);
 	}
 	void ping();
 	void cancel(mtpRequestId req);
@@ -65,13 +65,16 @@ namespace {
 	class _BigNumCounter {
 	public:
 		bool count(const void *power, const void *modul, uint32 g, void *gResult, const void *g_a, void *g_aResult) {
-			DEBUG_LOG(("BigNum Info: counting g_b = g ^ b % dh_prime and auth_key = g_a ^ b % dh_prime"));
+			return countPower(power, modul, g, gResult) && countAuthKey(power, modul, g_a, g_aResult);
+		}
+
+		bool countPower(const void *power, const void *modul, uint32 g, void *gResult) {
+			DEBUG_LOG(("BigNum Info: counting g_b = g ^ b % dh_prime"));
 			uint32 g_be = qToBigEndian(g);
 			if (
 				!BN_bin2bn((const uchar*)power, 64 * sizeof(uint32), &bnPower) ||
 				!BN_bin2bn((const uchar*)modul, 64 * sizeof(uint32), &bnModul) ||
-				!BN_bin2bn((const uchar*)&g_be, sizeof(uint32), &bn_g) ||
-				!BN_bin2bn((const uchar*)g_a, 64 * sizeof(uint32), &bn_g_a)
+				!BN_bin2bn((const uchar*)&g_be, sizeof(uint32), &bn_g)
 			) {
 				ERR_load_crypto_strings();
 				LOG(("BigNum Error: BN_bin2bn failed, error: %1").arg(ERR_error_string(ERR_get_error(), 0)));
@@ -103,14 +106,30 @@ namespace {
 				return false;
 			}
 
+			return true;
+		}
+
+		bool countAuthKey(const void *power, const void *modul, const void *g_a, void *g_aResult) {
+			DEBUG_LOG(("BigNum Info: counting auth_key = g_a ^ b % dh_prime"));
+			if (
+				!BN_bin2bn((const uchar*)power, 64 * sizeof(uint32), &bnPower) ||
+				!BN_bin2bn((const uchar*)modul, 64 * sizeof(uint32), &bnModul) ||
+				!BN_bin2bn((const uchar*)g_a, 64 * sizeof(uint32), &bn_g_a)
+			) {
+				ERR_load_crypto_strings();
+				LOG(("BigNum Error: BN_bin2bn failed, error: %1").arg(ERR_error_string(ERR_get_error(), 0)));
+				DEBUG_LOG(("BigNum Error: base %1, power %2, modul %3").arg(mb(g_a, 64 * sizeof(uint32)).str()).arg(mb(power, 64 * sizeof(uint32)).str()).arg(mb(modul, 64 * sizeof(uint32)).str()));
+				return false;
+			}
+
 			if (!BN_mod_exp(&bnResult, &bn_g_a, &bnPower, &bnModul, ctx)) {
 				ERR_load_crypto_strings();
 				LOG(("BigNum Error: BN_mod_exp failed, error: %1").arg(ERR_error_string(ERR_get_error(), 0)));
-				DEBUG_LOG(("BigNum Error: base %1, power %2, modul %3").arg(mb(&g_be, sizeof(uint32)).str()).arg(mb(power, 64 * sizeof(uint32)).str()).arg(mb(modul, 64 * sizeof(uint32)).str()));
+				DEBUG_LOG(("BigNum Error: base %1, power %2, modul %3").arg(mb(g_a, 64 * sizeof(uint32)).str()).arg(mb(power, 64 * sizeof(uint32)).str()).arg(mb(modul, 64 * sizeof(uint32)).str()));
 				return false;
 			}
 
-			resultLen = BN_num_bytes(&bnResult);
+			uint32 resultLen = BN_num_bytes(&bnResult);
 			if (resultLen != 64 * sizeof(uint32)) {
 				DEBUG_LOG(("BigNum Error: bad g_aResult len (%1)").arg(resultLen));
 				return false;
@@ -246,6 +265,73 @@ namespace {
 		BN_CTX *ctx;
 	};
 
+	// dh_prime + g pairs that passed isPrimeAndGood() and random 'b' with g_b counted for them,
+	// shared by all connection threads so that only the first auth key creation pays for them
+	struct DhExponent {
+		uint32 b[64];
+		uint32 g_b[64];
+	};
+	typedef QList<DhExponent> DhExponents;
+	typedef QMap<QByteArray, DhExponents> DhPrimes; // dh_prime + big endian g -> prepared exponents
+	DhPrimes gDhPrimes;
+	QMutex gDhPrimesMutex;
+
+	QByteArray dhPrimeKey(const QByteArray &dhPrime, int32 g) {
+		uint32 g_be = qToBigEndian(uint32(g));
+		return dhPrime + QByteArray((const char*)&g_be, sizeof(g_be));
+	}
+
+	bool dhPrimeValidated(const QByteArray &key) {
+		QMutexLocker lock(&gDhPrimesMutex);
+		return gDhPrimes.contains(key);
+	}
+
+	void dhPrimeValidatedAdd(const QByteArray &key) {
+		QMutexLocker lock(&gDhPrimesMutex);
+		if (!gDhPrimes.contains(key)) gDhPrimes.insert(key, DhExponents());
+	}
+
+	bool dhExponentTake(const QByteArray &key, DhExponent &result) {
+		QMutexLocker lock(&gDhPrimesMutex);
+		DhPrimes::iterator i = gDhPrimes.find(key);
+		if (i == gDhPrimes.end() || i.value().isEmpty()) return false;
+
+		DhExponent &exp(i.value().front());
+		result = exp; // each 'b' is used only once
+		memset(exp.b, 0, sizeof(exp.b)); // the list node is freed without clearing
+		i.value().pop_front();
+		return true;
+	}
+
+	void dhExponentsPrepare() {
+		QList<QByteArray> keys;
+		{
+			QMutexLocker lock(&gDhPrimesMutex);
+			for (DhPrimes::const_iterator i = gDhPrimes.cbegin(), e = gDhPrimes.cend(); i != e; ++i) {
+				for (int32 j = i.value().size(); j < MTPDhPreparedExponents; ++j) {
+					keys.push_back(i.key());
+				}
+			}
+		}
+		if (keys.isEmpty()) return;
+
+		_BigNumCounter bnCounter;
+		for (QList<QByteArray>::const_iterator i = keys.cbegin(), e = keys.cend(); i != e; ++i) {
+			const uint32 *key = (const uint32*)i->constData();
+			DhExponent exp;
+			memset_rand(exp.b, sizeof(exp.b));
+			if (bnCounter.countPower(exp.b, key, qFromBigEndian(key[64]), exp.g_b)) {
+				QMutexLocker lock(&gDhPrimesMutex);
+				DhPrimes::iterator j = gDhPrimes.find(*i);
+				if (j != gDhPrimes.end() && j.value().size() < MTPDhPreparedExponents) {
+					j.value().push_back(exp);
+				}
+			}
+			memset(exp.b, 0, sizeof(exp.b)); // only the prepared copy keeps 'b'
+		}
+		DEBUG_LOG(("AuthKey Info: prepared %1 dh exponents").arg(keys.size()));
+	}
+
 	typedef QMap<uint64, mtpPublicRSA> PublicRSAKeys;
 	PublicRSAKeys gPublicRSA;
 
@@ -606,7 +692,7 @@ void MTPabstractTcpConnection::socketRead() {
 }
 
 MTPautoConnection::MTPautoConnection(QThread *thread) : status(WaitingBoth),
-tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _tcpTimeout(MTPMinReceiveDelay) {
+tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _tcpTimeout(MTPMinReceiveDelay), _dc(0), _connectStarted(0) {
 	moveToThread(thread);
 
 	manager.moveToThread(thread);
@@ -618,6 +704,9 @@ tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _tcpTimeo
 	tcpTimeoutTimer.moveToThread(thread);
 	tcpTimeoutTimer.setSingleShot(true);
 	connect(&tcpTimeoutTimer, SIGNAL(timeout()), this, SLOT(onTcpTimeoutTimer()));
+	raceTimer.moveToThread(thread);
+	raceTimer.setSingleShot(true);
+	connect(&raceTimer, SIGNAL(timeout()), this, SLOT(onRaceTimer()));
 
 	sock.moveToThread(thread);
 	sock.setProxy(QNetworkProxy(QNetworkProxy::NoProxy));
@@ -637,6 +726,12 @@ void MTPautoConnection::onHttpStart() {
 
 void MTPautoConnection::onSocketConnected() {
 	if (status == HttpReady || status == WaitingBoth || status == WaitingTcp) {
+		if (_connectStarted) {
+			mtpDcAddressConnected(_dc, _addr, _port, int32(getms(true) - _connectStarted));
+			_connectStarted = 0;
+		}
+		stopRace();
+
 		mtpBuffer buffer(_preparePQFake(tcpNonce));
 
 		DEBUG_LOG(("Connection Info: sending fake req_pq through tcp transport"));
@@ -656,18 +751,114 @@ void MTPautoConnection::onTcpTimeoutTimer() {
 		_tcpTimeout = -_tcpTimeout;
 
 		QAbstractSocket::SocketState state = sock.state();
+		if (state == QAbstractSocket::ConnectingState || state == QAbstractSocket::HostLookupState) { // could not connect in time
+			mtpDcAddressFailed(_dc, _addr, _port);
+		}
 		if (state == QAbstractSocket::ConnectedState || state == QAbstractSocket::ConnectingState || state == QAbstractSocket::HostLookupState) {
 			sock.disconnectFromHost();
 		} else if (state != QAbstractSocket::ClosingState) {
+			_connectStarted = getms(true);
 			sock.connectToHost(QHostAddress(_addr), _port);
 		}
 	}
 }
 
+void MTPautoConnection::onRaceTimer() {
+	if ((status != HttpReady && status != WaitingBoth && status != WaitingTcp) || sock.state() == QAbstractSocket::ConnectedState) {
+		stopRace();
+		return;
+	}
+
+	if (_racers.size() + 1 < MTPTcpConnectionRaceCount) {
+		startRacer();
+	}
+	if (!_alternatives.isEmpty()) {
+		raceTimer.start(MTPTcpConnectionRaceDelay);
+	}
+}
+
+void MTPautoConnection::onRacerConnected() {
+	QTcpSocket *racer = qobject_cast<QTcpSocket*>(sender());
+	Racers::const_iterator i = _racers.constFind(racer);
+	if (i == _racers.cend()) return;
+
+	Racer winner(i.value());
+	mtpDcAddressConnected(_dc, winner.addr, winner.port, int32(getms(true) - winner.started));
+	stopRace();
+
+	if ((status != HttpReady && status != WaitingBoth && status != WaitingTcp) || sock.state() == QAbstractSocket::ConnectedState) {
+		return;
+	}
+
+	DEBUG_LOG(("Connection Info: tcp connection to %1:%2 won the race, dropping %3:%4").arg(winner.addr).arg(winner.port).arg(_addr).arg(_port)); // only slower, failures are recorded on error or timeout
+
+	_addr = winner.addr;
+	_port = winner.port;
+	if (_tcpTimeout < 0) _tcpTimeout = -_tcpTimeout;
+
+	sock.abort(); // not connected, so no disconnected() is emitted
+	_connectStarted = getms(true);
+	sock.connectToHost(QHostAddress(_addr), _port);
+}
+
+void MTPautoConnection::onRacerError(QAbstractSocket::SocketError e) {
+	QTcpSocket *racer = qobject_cast<QTcpSocket*>(sender());
+	Racers::iterator i = _racers.find(racer);
+	if (i == _racers.end()) return;
+
+	DEBUG_LOG(("Connection Info: racing tcp connection to %1:%2 failed, error %3").arg(i.value().addr).arg(i.value().port).arg(e));
+	mtpDcAddressFailed(_dc, i.value().addr, i.value().port);
+
+	disconnect(racer, 0, this, 0);
+	racer->deleteLater();
+	_racers.erase(i);
+
+	if (status != HttpReady && status != WaitingBoth && status != WaitingTcp) return;
+
+	if (!_alternatives.isEmpty()) {
+		startRacer();
+	} else if (_racers.isEmpty() && sock.state() == QAbstractSocket::UnconnectedState) { // sock has failed before, nothing left to try
+		tcpFailed();
+	}
+}
+
+bool MTPautoConnection::racing() const {
+	return !_racers.isEmpty() || !_alternatives.isEmpty();
+}
+
+void MTPautoConnection::startRacer() {
+	if (_alternatives.isEmpty()) return;
+
+	Racer racer(QString::fromUtf8(_alternatives.front().ip.c_str()), _alternatives.front().port);
+	_alternatives.pop_front();
+
+	DEBUG_LOG(("Connection Info: racing tcp connection to %1:%2").arg(racer.addr).arg(racer.port));
+
+	QTcpSocket *socket = new QTcpSocket();
+	socket->setProxy(QNetworkProxy(QNetworkProxy::NoProxy));
+	connect(socket, SIGNAL(connected()), this, SLOT(onRacerConnected()));
+	connect(socket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(onRacerError(QAbstractSocket::SocketError)));
+	_racers.insert(socket, racer);
+
+	socket->connectToHost(QHostAddress(racer.addr), racer.port);
+}
+
+void MTPautoConnection::stopRace() {
+	raceTimer.stop();
+	_alternatives.clear();
+	for (Racers::const_iterator i = _racers.cbegin(), e = _racers.cend(); i != e; ++i) {
+		disconnect(i.key(), 0, this, 0);
+		i.key()->abort();
+		i.key()->deleteLater();
+	}
+	_racers.clear();
+}
+
 void MTPautoConnection::onSocketDisconnected() {
 	if (_tcpTimeout < 0) {
 		_tcpTimeout = -_tcpTimeout;
 		if (status == HttpReady || status == WaitingBoth || status == WaitingTcp) {
+			_connectStarted = getms(true);
 			sock.connectToHost(QHostAddress(_addr), _port);
 			return;
 		}
@@ -738,6 +929,7 @@ void MTPautoConnection::disconnectFromServer() {
 
 	disconnect(&sock, SIGNAL(readyRead()), 0, 0);
 	sock.close();
+	stopRace();
 
 	httpStartTimer.stop();
 	status = FinishedWork;
@@ -750,8 +942,21 @@ void MTPautoConnection::connectToServer(const QString &addr, int32 port) {
 	_addr = addr;
 	_port = port;
 
+	string addrStr(addr.toUtf8().constData());
+	for (mtpDcAddresses::iterator i = _alternatives.begin(); i != _alternatives.end();) {
+		if (i->ip == addrStr && i->port == port) {
+			i = _alternatives.erase(i);
+		} else {
+			++i;
+		}
+	}
+
 	connect(&sock, SIGNAL(readyRead()), this, SLOT(socketRead()));
+	_connectStarted = getms(true);
 	sock.connectToHost(QHostAddress(_addr), _port);
+	if (!_alternatives.isEmpty()) {
+		raceTimer.start(MTPTcpConnectionRaceDelay);
+	}
 
 	mtpBuffer buffer(_preparePQFake(httpNonce));
 
@@ -760,6 +965,11 @@ void MTPautoConnection::connectToServer(const QString &addr, int32 port) {
 	httpSend(buffer);
 }
 
+void MTPautoConnection::setDcAddresses(int32 dc, const mtpDcAddresses &addresses) {
+	_dc = dc;
+	_alternatives = addresses;
+}
+
 bool MTPautoConnection::isConnected() {
 	return status != FinishedWork && !address.isEmpty();
 }
@@ -884,6 +1094,10 @@ int32 MTPautoConnection::debugState() const {
 	return (status == UsingHttp) ? -1 : (UsingTcp ? sock.state() : -777);
 }
 
+MTPautoConnection::~MTPautoConnection() {
+	stopRace();
+}
+
 QString MTPautoConnection::transport() const {
 	if (status == UsingTcp) {
 		return qsl("TCP");
@@ -898,6 +1112,19 @@ void MTPautoConnection::socketError(QAbstractSocket::SocketError e) {
 	if (status == FinishedWork) return;
 
 	_handleTcpError(e, sock);
+	if (status == HttpReady || status == WaitingBoth || status == WaitingTcp) {
+		mtpDcAddressFailed(_dc, _addr, _port);
+		if (racing()) { // don't wait for the timer, try the next address right now
+			if (!_alternatives.isEmpty()) {
+				startRacer();
+			}
+			return;
+		}
+	}
+	tcpFailed();
+}
+
+void MTPautoConnection::tcpFailed() {
 	if (status == WaitingBoth) {
 		status = WaitingHttp;
 	} else if (status == HttpReady) {
@@ -1102,6 +1329,11 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
     , keyId(0)
     , sessionData(data)
     , myKeyLock(false)
+	, _gzipInited(false)
+	, _gzipSkip(0)
+	, _gzipRawBytes(0)
+	, _gzipPackedBytes(0)
+	, _gzipTime(0)
 	, authKeyData(0)
 	, authKeyStrings(0) {
 
@@ -1123,6 +1355,7 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 		dc = options.cbegin().value().id;
 		DEBUG_LOG(("MTP Info: searching for any DC, %1 selected..").arg(dc));
 	}
+	_metrics.init(dc);
 
 	connect(thread, SIGNAL(started()), this, SLOT(socketStart()));
 	connect(thread, SIGNAL(finished()), this, SLOT(doFinish()));
@@ -1156,6 +1389,28 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 	connect(this, SIGNAL(resendAllAsync()), sessionData->owner(), SLOT(resendAll()));
 }
 
+MTProtoConnectionPrivate::Metrics::Metrics() : toSend(0), haveSent(0), acksPending(0), bytesIn(0), bytesOut(0), resends(0), rtt(0), response(0)
+, containerMessages(0), decrypt(0), dhPrimeCached(0), dhPrimeCheck(0), dhExponentPrepared(0), authKey(0) {
+}
+
+void MTProtoConnectionPrivate::Metrics::init(uint32 dc) {
+	toSend = metricGauge(qsl("mtp.dc%1.to_send").arg(dc));
+	haveSent = metricGauge(qsl("mtp.dc%1.have_sent").arg(dc));
+	acksPending = metricGauge(qsl("mtp.dc%1.acks_pending").arg(dc));
+	bytesIn = metricCounter(qsl("mtp.dc%1.bytes_in").arg(dc));
+	bytesOut = metricCounter(qsl("mtp.dc%1.bytes_out").arg(dc));
+	resends = metricCounter(qsl("mtp.dc%1.resends").arg(dc));
+	rtt = metricHistogram(qsl("mtp.dc%1.rtt_ms").arg(dc));
+	response = metricHistogram(qsl("mtp.dc%1.response_ms").arg(dc));
+
+	containerMessages = metricHistogram(qsl("mtp.container_messages"));
+	decrypt = metricHistogram(qsl("mtp.decrypt_us"));
+	dhPrimeCached = metricCounter(qsl("mtp.dh_prime_cached"));
+	dhPrimeCheck = metricHistogram(qsl("mtp.dh_prime_check_ms"));
+	dhExponentPrepared = metricCounter(qsl("mtp.dh_exponent_prepared"));
+	authKey = metricHistogram(qsl("mtp.auth_key_ms"));
+}
+
 void MTProtoConnectionPrivate::onConfigLoaded() {
 	socketStart(true);
 }
@@ -1285,6 +1540,7 @@ void MTProtoConnectionPrivate::resetSession() { // recreate all msg_id and msg_s
 				mtpRequest req = j.value();
 				haveSent.erase(j);
 				haveSent.insert(i.value(), req);
+				sessionData->haveSentCheckAt(i.value(), req);
 			}
 			mtpRequestIdsMap::iterator k = toResend.find(i.key());
 			if (k != toResend.cend()) {
@@ -1381,6 +1637,7 @@ mtpMsgId MTProtoConnectionPrivate::replaceMsgId(mtpRequest &request, mtpMsgId ne
 				mtpRequest req = k.value();
 				haveSent.erase(k);
 				haveSent.insert(newId, req);
+				sessionData->haveSentCheckAt(newId, req);
 			}
 
 			for (k = haveSent.begin(); k != haveSent.cend(); ++k) {
@@ -1528,7 +1785,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 		initSize = initSizeInInts * sizeof(mtpPrime);
 	}
 
-	bool needAnyResponse = false;
+	bool needAnyResponse = false, sendMore = false;
 	mtpRequest toSendRequest;
 	{
 		QWriteLocker locker1(sessionData->toSendMutex());
@@ -1536,7 +1793,14 @@ void MTProtoConnectionPrivate::tryToSend() {
 		mtpPreRequestMap toSendDummy, &toSend(prependOnly ? toSendDummy : sessionData->toSendMap());
 		if (prependOnly) locker1.unlock();
 
-		uint32 toSendCount = toSend.size();
+		QVector<mtpRequest> toSendNow;
+		if (!toSend.isEmpty()) {
+			takeToSend(toSend, toSendNow);
+			if (!toSend.isEmpty()) sendMore = true;
+			metricSet(_metrics.toSend, toSend.size());
+		}
+
+		uint32 toSendCount = toSendNow.size();
 		if (pingRequest) ++toSendCount;
 		if (ackRequest) ++toSendCount;
 		if (resendRequest) ++toSendCount;
@@ -1545,13 +1809,13 @@ void MTProtoConnectionPrivate::tryToSend() {
 
 		if (!toSendCount) return; // nothing to send
 
-		mtpRequest first = pingRequest ? pingRequest : (ackRequest ? ackRequest : (resendRequest ? resendRequest : (stateRequest ? stateRequest : (httpWaitRequest ? httpWaitRequest : toSend.cbegin().value()))));
+		mtpRequest first = pingRequest ? pingRequest : (ackRequest ? ackRequest : (resendRequest ? resendRequest : (stateRequest ? stateRequest : (httpWaitRequest ? httpWaitRequest : toSendNow.front()))));
 		if (toSendCount == 1 && first->msDate > 0) { // if can send without container
 			toSendRequest = first;
 			if (!prependOnly) {
-				toSend.clear();
 				locker1.unlock();
 			}
+			gzipRequest(toSendRequest);
 
 			mtpMsgId msgId = prepareToSend(toSendRequest, msgid());
 			if (pingRequest) {
@@ -1568,6 +1832,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 					QWriteLocker locker2(sessionData->haveSentMutex());
 					mtpRequestMap &haveSent(sessionData->haveSentMap());
 					haveSent.insert(msgId, toSendRequest);
+					sessionData->haveSentCheckAt(msgId, toSendRequest);
 
 					if (needsLayer && !toSendRequest->needsLayer) needsLayer = false;
 					if (toSendRequest->after) {
@@ -1597,6 +1862,8 @@ void MTProtoConnectionPrivate::tryToSend() {
 				}
 			}
 		} else { // send in container
+			metricSample(_metrics.containerMessages, toSendCount);
+
 			bool willNeedInit = false;
 			uint32 containerSize = 1 + 1, idsWrapSize = (toSendCount << 1); // cons + vector size, idsWrapSize - size of "request-like" wrap for msgId vector
 			if (pingRequest) containerSize += mtpRequestData::messageSize(pingRequest);
@@ -1604,9 +1871,10 @@ void MTProtoConnectionPrivate::tryToSend() {
 			if (resendRequest) containerSize += mtpRequestData::messageSize(resendRequest);
 			if (stateRequest) containerSize += mtpRequestData::messageSize(stateRequest);
 			if (httpWaitRequest) containerSize += mtpRequestData::messageSize(httpWaitRequest);
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
-				containerSize += mtpRequestData::messageSize(i.value());
-				if (needsLayer && i.value()->needsLayer) {
+			for (QVector<mtpRequest>::iterator i = toSendNow.begin(), e = toSendNow.end(); i != e; ++i) {
+				gzipRequest(*i);
+				containerSize += mtpRequestData::messageSize(*i);
+				if (needsLayer && (*i)->needsLayer) {
 					containerSize += initSizeInInts;
 					willNeedInit = true;
 				}
@@ -1618,7 +1886,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 				initSerialized.push_back(mtpCurrentLayer);
 				initWrapper->write(initSerialized);
 			}
-			toSendRequest = mtpRequestData::prepare(containerSize, containerSize + 3 * toSend.size()); // prepare container + each in invoke after
+			toSendRequest = mtpRequestData::prepare(containerSize, containerSize + 3 * toSendNow.size()); // prepare container + each in invoke after
 			toSendRequest->push_back(mtpc_msg_container);
 			toSendRequest->push_back(toSendCount);
 
@@ -1641,8 +1909,8 @@ void MTProtoConnectionPrivate::tryToSend() {
 			} else if (resendRequest || stateRequest) {
 				needAnyResponse = true;
 			}
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
-				mtpRequest &req(i.value());
+			for (QVector<mtpRequest>::iterator i = toSendNow.begin(), e = toSendNow.end(); i != e; ++i) {
+				mtpRequest &req(*i);
 				mtpMsgId msgId = prepareToSend(req, bigMsgId);
 				if (msgId > bigMsgId) msgId = replaceMsgId(req, bigMsgId);
 				if (msgId >= bigMsgId) bigMsgId = msgid();
@@ -1668,6 +1936,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 							added = true;
 						}
 						haveSent.insert(msgId, req);
+						sessionData->haveSentCheckAt(msgId, req);
 
 						needAnyResponse = true;
 					} else {
@@ -1684,6 +1953,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 				mtpMsgId msgId = placeToContainer(toSendRequest, bigMsgId, haveSentArr, stateRequest);
 				stateRequest->msDate = 0; // 0 for state request, do not request state of it
 				haveSent.insert(msgId, stateRequest);
+				sessionData->haveSentCheckAt(msgId, stateRequest);
 			}
 			if (resendRequest) placeToContainer(toSendRequest, bigMsgId, haveSentArr, resendRequest);
 			if (ackRequest) placeToContainer(toSendRequest, bigMsgId, haveSentArr, ackRequest);
@@ -1693,11 +1963,43 @@ void MTProtoConnectionPrivate::tryToSend() {
 			*(mtpMsgId*)(haveSentIdsWrap->data() + 4) = contMsgId;
 			(*haveSentIdsWrap)[6] = 0; // for container, msDate = 0, seqNo = 0
 			haveSent.insert(contMsgId, haveSentIdsWrap);
-			toSend.clear();
+			sessionData->haveSentCheckAt(contMsgId, haveSentIdsWrap);
 		}
 	}
 	mtpRequestData::padding(toSendRequest);
 	sendRequest(toSendRequest, needAnyResponse);
+
+	if (sendMore) { // some requests didn't fit in this container
+		emit needToSendAsync();
+	}
+}
+
+void MTProtoConnectionPrivate::takeToSend(mtpPreRequestMap &toSend, QVector<mtpRequest> &result) { // toSendMutex() must be locked
+	uint64 ms = getms(true);
+
+	QMap<mtpRequestId, int32> priorities;
+	QVector<mtpRequest> byPriority[MTPRequestPrioritiesCount];
+	for (mtpPreRequestMap::const_iterator i = toSend.cbegin(), e = toSend.cend(); i != e; ++i) { // by request id, so "after" requests come first
+		const mtpRequest &req(i.value());
+		int32 priority = req->priority, starved = int32((ms > req->toSendDate) ? ((ms - req->toSendDate) / MTPRequestStarvationTimeout) : 0);
+		priority = (starved < priority) ? (priority - starved) : MTPRequestInteractive;
+		if (req->after) { // dependent request can't be sent before the one it waits for
+			QMap<mtpRequestId, int32>::const_iterator j = priorities.constFind(req->after->requestId);
+			if (j != priorities.cend() && j.value() > priority) priority = j.value();
+		}
+		priorities.insert(i.key(), priority);
+		byPriority[priority].push_back(req);
+	}
+
+	result.reserve(qMin(toSend.size(), int(MTPContainerMaxRequests)));
+	for (int32 priority = 0; priority < MTPRequestPrioritiesCount; ++priority) {
+		for (QVector<mtpRequest>::const_iterator i = byPriority[priority].cbegin(), e = byPriority[priority].cend(); i != e; ++i) {
+			if (result.size() >= MTPContainerMaxRequests) return;
+
+			result.push_back(*i);
+			toSend.remove((*i)->requestId);
+		}
+	}
 }
 
 void MTProtoConnectionPrivate::retryByTimer() {
@@ -1738,11 +2040,9 @@ void MTProtoConnectionPrivate::socketStart(bool afterConfig) {
 	_pingId = _pingMsgId = _pingIdToSend = _pingSendAt = 0;
 	_pingSender.stop();
 
-	const mtpDcOption *dcOption = 0;
-	const mtpDcOptions &options(cDcOptions());
-	mtpDcOptions::const_iterator dcIndex = options.constFind(dc % _mtp_internal::dcShift);
+	mtpDcAddresses addresses(mtpDcAddressesFor(dc % _mtp_internal::dcShift));
 	DEBUG_LOG(("MTP Info: connecting to DC %1..").arg(dc));
-	if (dcIndex == options.cend()) {
+	if (addresses.isEmpty()) {
 		if (afterConfig) {
 			LOG(("MTP Error: DC %1 options not found right after config load!").arg(dc));
 			return restart();
@@ -1753,15 +2053,15 @@ void MTProtoConnectionPrivate::socketStart(bool afterConfig) {
 			return;
 		}
 	}
-	dcOption = &dcIndex.value();
 
-	const char *ip(dcOption->ip.c_str());
-	uint32 port(dcOption->port);
-	DEBUG_LOG(("MTP Info: socket connection to %1:%2..").arg(ip).arg(port));
+	const char *ip(addresses.front().ip.c_str());
+	uint32 port(addresses.front().port);
+	DEBUG_LOG(("MTP Info: socket connection to %1:%2, %3 addresses known..").arg(ip).arg(port).arg(addresses.size()));
 
 	connect(conn, SIGNAL(connected()), this, SLOT(onConnected()));
 	connect(conn, SIGNAL(disconnected()), this, SLOT(restart()));
 
+	conn->setDcAddresses(dc % _mtp_internal::dcShift, addresses);
 	conn->connectToServer(ip, port);
 }
 
@@ -1943,7 +2243,11 @@ void MTProtoConnectionPrivate::handleReceived() {
 		const mtpPrime *from(msg), *end;
 		MTPint128 msgKey(*(MTPint128*)(encrypted + 2));
 		
+		QElapsedTimer decryptTimer;
+		decryptTimer.start();
 		aesDecrypt(encrypted + 6, data, dataBuffer.size(), key, msgKey);
+		metricSample(_metrics.decrypt, decryptTimer.nsecsElapsed() / 1000);
+		metricAdd(_metrics.bytesIn, len * sizeof(mtpPrime));
 
 		uint64 serverSalt = *(uint64*)&data[0], session = *(uint64*)&data[2], msgId = *(uint64*)&data[4];
 		uint32 seqNo = *(uint32*)&data[6], msgLen = *(uint32*)&data[7];
@@ -2006,7 +2310,10 @@ void MTProtoConnectionPrivate::handleReceived() {
 			serverSalt = 0; // dont pass to handle method, so not to lock in setSalt()
 		}
 
-		if (needAck) ackRequestData.push_back(MTP_long(msgId));
+		if (needAck) {
+			ackRequestData.push_back(MTP_long(msgId));
+			metricSet(_metrics.acksPending, ackRequestData.size());
+		}
 
 		int32 res = 1; // if no need to handle, then succeed
 		end = data + 8 + (msgLen >> 2);
@@ -2550,6 +2857,9 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			return 0;
 		}
 		if (data.vping_id.v == _pingId) {
+			uint64 rtt = getms(true) - (_pingSendAt - MTPPingSendAfterAuto * 1000ULL);
+			sessionData->rttSample(rtt);
+			metricSample(_metrics.rtt, rtt);
 			_pingId = 0;
 		} else {
 			DEBUG_LOG(("Message Info: just pong.."));
@@ -2641,6 +2951,70 @@ mtpBuffer MTProtoConnectionPrivate::ungzip(const mtpPrime *from, const mtpPrime
 	return result;
 }
 
+void MTProtoConnectionPrivate::gzipRequest(mtpRequest &request) {
+	if (request->size() < 9 || !request->requestId || !mtpRequestData::needAck(request) || mtpRequestData::isStateRequest(request)) return;
+
+	uint32 len = request.innerLength();
+	if (len < MTPGzipMinSize) return;
+
+	mtpTypeId type = (*request)[8];
+	if (type == mtpc_gzip_packed || type == mtpc_upload_saveFilePart || type == mtpc_upload_saveBigFilePart) return; // already packed or file data
+	if (_gzipSkip > 0) {
+		--_gzipSkip;
+		return;
+	}
+
+	int res = Z_OK;
+	if (_gzipInited) {
+		res = deflateReset(&_gzipStream);
+	} else {
+		_gzipStream.zalloc = 0;
+		_gzipStream.zfree = 0;
+		_gzipStream.opaque = 0;
+		res = deflateInit2(&_gzipStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		_gzipInited = (res == Z_OK);
+	}
+	if (res != Z_OK) {
+		LOG(("RPC Error: could not init zlib stream for packing, code: %1").arg(res));
+		_gzipSkip = MTPGzipSkipAfterBad;
+		return;
+	}
+
+	uint64 ms = getms(true);
+	QByteArray packed;
+	packed.resize(deflateBound(&_gzipStream, len));
+	_gzipStream.avail_in = len;
+	_gzipStream.next_in = (Bytef*)(request->constData() + 8);
+	_gzipStream.avail_out = packed.size();
+	_gzipStream.next_out = (Bytef*)packed.data();
+	res = deflate(&_gzipStream, Z_FINISH);
+	if (res != Z_STREAM_END) {
+		LOG(("RPC Error: could not pack request, code: %1").arg(res));
+		_gzipSkip = MTPGzipSkipAfterBad;
+		return;
+	}
+	packed.resize(packed.size() - _gzipStream.avail_out);
+
+	MTPstring wrapped(MTP_string(packed));
+	uint32 packedLen = wrapped.innerLength() + sizeof(mtpPrime); // + gzip_packed cons
+	ms = getms(true) - ms;
+	if (packedLen * 100 > len * MTPGzipMaxPercent || ms > MTPGzipMaxTime) {
+		DEBUG_LOG(("MTP Info: gzip skipped, %1 bytes packed to %2 bytes in %3ms").arg(len).arg(packedLen).arg(ms));
+		_gzipSkip = MTPGzipSkipAfterBad;
+		return;
+	}
+
+	request->resize(8);
+	request->push_back(mtpc_gzip_packed);
+	wrapped.write(*request);
+	(*request)[7] = packedLen;
+
+	_gzipRawBytes += len;
+	_gzipPackedBytes += packedLen;
+	_gzipTime += ms;
+	DEBUG_LOG(("MTP Info: request %1 gzipped from %2 to %3 bytes in %4ms, total %5 bytes saved in %6ms").arg(request->requestId).arg(len).arg(packedLen).arg(ms).arg(_gzipRawBytes - _gzipPackedBytes).arg(_gzipTime));
+}
+
 bool MTProtoConnectionPrivate::requestsFixTimeSalt(const QVector<MTPlong> &ids, int32 serverTime, uint64 serverSalt) {
 	uint32 idsCount = ids.size();
 
@@ -2684,11 +3058,18 @@ void MTProtoConnectionPrivate::requestsAcked(const QVector<MTPlong> &ids, bool b
 						haveSent.erase(req);
 					} else {
 						mtpRequestId reqId = req.value()->requestId;
+						if (!byResponse && !req.value()->rttSkip) { // response time includes server processing, only acks of the first send measure rtt
+							sessionData->rttSample(getms(true) - req.value()->msDate);
+							req.value()->rttSkip = true;
+						}
 						bool moveToAcked = byResponse;
 						if (!moveToAcked) { // ignore ACK, if we need a response (if we have a handler)
 							moveToAcked = !_mtp_internal::hasCallbacks(reqId);
 						}
 						if (moveToAcked) {
+							if (byResponse) {
+								metricSample(_metrics.response, getms(true) - req.value()->msDate);
+							}
 							wereAcked.insert(msgId, reqId);
 							haveSent.erase(req);
 						} else {
@@ -2730,6 +3111,7 @@ void MTProtoConnectionPrivate::requestsAcked(const QVector<MTPlong> &ids, bool b
 					}
 				}
 			}
+			metricSet(_metrics.haveSent, haveSent.size());
 		}
 
 		uint32 ackedCount = wereAcked.size();
@@ -2799,6 +3181,7 @@ void MTProtoConnectionPrivate::handleMsgsStates(const QVector<MTPlong> &ids, con
 
 void MTProtoConnectionPrivate::resend(quint64 msgId, quint64 msCanWait, bool forceContainer, bool sendMsgStateInfo) {
 	if (msgId == _pingMsgId) return;
+	metricAdd(_metrics.resends);
 	emit resendAsync(msgId, msCanWait, forceContainer, sendMsgStateInfo);
 }
 
@@ -2809,6 +3192,7 @@ void MTProtoConnectionPrivate::resendMany(QVector<quint64> msgIds, quint64 msCan
 			--l;
 		}
 	}
+	metricAdd(_metrics.resends, msgIds.size());
 	emit resendManyAsync(msgIds, msCanWait, forceContainer, sendMsgStateInfo);
 }
 
@@ -2844,6 +3228,7 @@ void MTProtoConnectionPrivate::onConnected() {
 	authKeyStrings = new MTProtoConnectionPrivate::AuthKeyCreateStrings();
 	authKeyData->req_num = 0;
 	authKeyData->nonce = MTP::nonce<MTPint128>();
+	authKeyData->started = getms(true);
 
 	MTPReq_pq req_pq;
 	req_pq.vnonce = authKeyData->nonce;
@@ -3073,15 +3458,25 @@ void MTProtoConnectionPrivate::dhParamsAnswered() {
 			return restart();
 		}
 		
-		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods
-		_BigNumPrimeTest bnPrimeTest;
-		if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, dh_inner_data.vg.v)) {
-			LOG(("AuthKey Error: bad dh_prime primality!").arg(dhPrime.length()).arg(g_a.length()));
-			DEBUG_LOG(("AuthKey Error: dh_prime %1").arg(mb(&dhPrime[0], dhPrime.length()).str()));
-			return restart();
+		authKeyStrings->dh_prime = QByteArray(dhPrime.data(), dhPrime.size());
+
+		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods,
+		// the same dh_prime is usually sent by all dcs, so it is checked only once per launch
+		QByteArray primeKey(dhPrimeKey(authKeyStrings->dh_prime, dh_inner_data.vg.v));
+		if (dhPrimeValidated(primeKey)) {
+			metricAdd(_metrics.dhPrimeCached);
+		} else {
+			uint64 checkStart = getms(true);
+			_BigNumPrimeTest bnPrimeTest;
+			if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, dh_inner_data.vg.v)) {
+				LOG(("AuthKey Error: bad dh_prime primality!").arg(dhPrime.length()).arg(g_a.length()));
+				DEBUG_LOG(("AuthKey Error: dh_prime %1").arg(mb(&dhPrime[0], dhPrime.length()).str()));
+				return restart();
+			}
+			metricSample(_metrics.dhPrimeCheck, getms(true) - checkStart);
+			dhPrimeValidatedAdd(primeKey);
 		}
 
-		authKeyStrings->dh_prime = QByteArray(dhPrime.data(), dhPrime.size());
 		authKeyData->g = dh_inner_data.vg.v;
 		authKeyStrings->g_a = QByteArray(g_a.data(), g_a.size());
 		authKeyData->retry_id = MTP_long(0);
@@ -3127,13 +3522,30 @@ void MTProtoConnectionPrivate::dhClientParamsSend() {
 	client_dh_inner_data.vretry_id = authKeyData->retry_id;
 	client_dh_inner_data.vg_b._string().v.resize(256);
 
-	// gen rand 'b'
-	uint32 b[64], *g_b((uint32*)&client_dh_inner_data.vg_b._string().v[0]), g_b_len;
-	memset_rand(b, sizeof(b));
-
-	// count g_b and auth_key using openssl BIGNUM methods
+	// take prepared rand 'b' with g_b or gen a new one
+	uint32 *g_b((uint32*)&client_dh_inner_data.vg_b._string().v[0]);
+	DhExponent exp;
 	_BigNumCounter bnCounter;
-	if (!bnCounter.count(b, authKeyStrings->dh_prime.constData(), authKeyData->g, g_b, authKeyStrings->g_a.constData(), authKeyData->auth_key)) {
+	if (dhExponentTake(dhPrimeKey(authKeyStrings->dh_prime, authKeyData->g), exp)) {
+		memcpy(g_b, exp.g_b, sizeof(exp.g_b));
+		metricAdd(_metrics.dhExponentPrepared);
+	} else {
+		memset_rand(exp.b, sizeof(exp.b));
+
+		// count g_b using openssl BIGNUM methods
+		if (!bnCounter.countPower(exp.b, authKeyStrings->dh_prime.constData(), authKeyData->g, g_b)) {
+			return dhClientParamsSend();
+		}
+	}
+
+	// count auth_key using openssl BIGNUM methods
+	bool counted = bnCounter.countAuthKey(exp.b, authKeyStrings->dh_prime.constData(), authKeyStrings->g_a.constData(), authKeyData->auth_key);
+#ifdef Q_OS_WIN
+	SecureZeroMemory(exp.b, sizeof(exp.b));
+#else
+	memset(exp.b, 0, sizeof(exp.b));
+#endif
+	if (!counted) {
 		return dhClientParamsSend();
 	}
 
@@ -3216,10 +3628,14 @@ void MTProtoConnectionPrivate::dhClientParamsAnswered() {
 		authKey->setDC(dc % _mtp_internal::dcShift);
 
 		DEBUG_LOG(("AuthKey Info: auth key gen succeed, id: %1, server salt: %2, auth key: %3").arg(authKey->keyId()).arg(serverSalt).arg(mb(authKeyData->auth_key, 256).str()));
+		metricSample(_metrics.authKey, getms(true) - authKeyData->started);
 
 		sessionData->owner()->notifyKeyCreated(authKey); // slot will call authKeyCreated()
 		sessionData->clear();
 		unlockKey();
+
+		// other dcs are likely to create their keys soon, refill exponents after this handshake is done
+		QTimer::singleShot(0, this, SLOT(onPrepareDhExponents()));
 	} return;
 
 	case mtpc_dh_gen_retry: {
@@ -3271,6 +3687,10 @@ void MTProtoConnectionPrivate::dhClientParamsAnswered() {
 	return restart();
 }
 
+void MTProtoConnectionPrivate::onPrepareDhExponents() {
+	dhExponentsPrepare();
+}
+
 void MTProtoConnectionPrivate::authKeyCreated() {
 	clearAuthKeyData();
 
@@ -3428,6 +3848,7 @@ bool MTProtoConnectionPrivate::sendRequest(mtpRequest &request, bool needAnyResp
 
 	conn->setSentEncrypted();
 	conn->sendData(result);
+	metricAdd(_metrics.bytesOut, result.size() * sizeof(mtpPrime));
 
 	if (needAnyResponse) {
 		onSentSome(result.size() * sizeof(mtpPrime));
@@ -3477,6 +3898,9 @@ void MTProtoConnectionPrivate::unlockKey() {
 
 MTProtoConnectionPrivate::~MTProtoConnectionPrivate() {
 	doDisconnect();
+	if (_gzipInited) {
+		deflateEnd(&_gzipStream);
+	}
 }
 
 void MTProtoConnectionPrivate::stop() {
@@ -29,6 +29,7 @@ enum {
 
 #include "mtproto/mtpPublicRSA.h"
 #include "mtproto/mtpAuthKey.h"
+#include "mtproto/mtpDC.h"
 
 inline bool mtpRequestData::isSentContainer(const mtpRequest &request) { // "request-like" wrap for msgIds vector
 	if (request->size() < 9) return false;
@@ -125,6 +126,8 @@ public:
 	virtual void sendData(mtpBuffer &buffer) = 0; // has size + 3, buffer[0] = len, buffer[1] = packetnum, buffer[last] = crc32
 	virtual void disconnectFromServer() = 0;
 	virtual void connectToServer(const QString &addr, int32 port) = 0;
+	virtual void setDcAddresses(int32 dc, const mtpDcAddresses &addresses) { // other addresses to race with, before connectToServer()
+	}
 	virtual bool isConnected() = 0;
 	virtual bool usingHttpWait() {
 		return false;
@@ -193,6 +196,7 @@ public:
 	void sendData(mtpBuffer &buffer);
 	void disconnectFromServer();
 	void connectToServer(const QString &addr, int32 port);
+	void setDcAddresses(int32 dc, const mtpDcAddresses &addresses);
 	bool isConnected();
 	bool usingHttpWait();
 	bool needHttpWait();
@@ -201,6 +205,8 @@ public:
 
 	QString transport() const;
 
+	~MTPautoConnection();
+
 public slots:
 
 	void socketError(QAbstractSocket::SocketError e);
@@ -212,6 +218,10 @@ public slots:
 
 	void onTcpTimeoutTimer();
 
+	void onRaceTimer();
+	void onRacerConnected();
+	void onRacerError(QAbstractSocket::SocketError e);
+
 protected:
 
 	void socketPacket(mtpPrime *packet, uint32 packetSize);
@@ -220,6 +230,12 @@ private:
 
 	void tcpSend(mtpBuffer &buffer);
 	void httpSend(mtpBuffer &buffer);
+	void tcpFailed();
+
+	bool racing() const;
+	void startRacer();
+	void stopRace();
+
 	enum Status {
 		WaitingBoth = 0,
 		WaitingHttp,
@@ -243,6 +259,21 @@ private:
 	int32 _port, _tcpTimeout;
 	QTimer tcpTimeoutTimer;
 
+	struct Racer {
+		Racer(const QString &_addr = QString(), int32 _port = 0) : addr(_addr), port(_port), started(getms(true)) {
+		}
+		QString addr;
+		int32 port;
+		uint64 started;
+	};
+	typedef QMap<QTcpSocket*, Racer> Racers;
+	Racers _racers; // tcp connects to other dc addresses, started while sock is not connected
+
+	int32 _dc;
+	mtpDcAddresses _alternatives; // not tried yet
+	uint64 _connectStarted;
+	QTimer raceTimer;
+
 };
 
 class MTPtcpConnection : public MTPabstractTcpConnection {
@@ -358,6 +389,7 @@ public slots:
 	void pqAnswered();
 	void dhParamsAnswered();
 	void dhClientParamsAnswered();
+	void onPrepareDhExponents();
 
 	// General packet receive slot, connected to conn->receivedData signal
 	void handleReceived();
@@ -376,12 +408,14 @@ private:
 	mtpMsgId placeToContainer(mtpRequest &toSendRequest, mtpMsgId &bigMsgId, mtpMsgId *&haveSentArr, mtpRequest &req);
 	mtpMsgId prepareToSend(mtpRequest &request, mtpMsgId currentLastId);
 	mtpMsgId replaceMsgId(mtpRequest &request, mtpMsgId newId);
+	void takeToSend(mtpPreRequestMap &toSend, QVector<mtpRequest> &result);
 
 	bool sendRequest(mtpRequest &request, bool needAnyResponse);
 	mtpRequestId wasSent(mtpMsgId msgId) const;
 
 	int32 handleOneReceived(const mtpPrime *from, const mtpPrime *end, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime);
 	mtpBuffer ungzip(const mtpPrime *from, const mtpPrime *end) const;
+	void gzipRequest(mtpRequest &request);
 	void handleMsgsStates(const QVector<MTPlong> &ids, const string &states, QVector<MTPlong> &acked);
 
 	void clearMessages();
@@ -397,6 +431,15 @@ private:
 	MTProtoConnection *_owner;
 	MTPabstractConnection *conn;
 
+	struct Metrics { // registered once the dc is known, updated lock free from the connection thread
+		Metrics();
+		void init(uint32 dc);
+
+		MetricHandle toSend, haveSent, acksPending, bytesIn, bytesOut, resends, rtt, response;
+		MetricHandle containerMessages, decrypt, dhPrimeCached, dhPrimeCheck, dhExponentPrepared, authKey;
+	};
+	Metrics _metrics;
+
 	SingleTimer retryTimer; // exp retry timer
 	uint32 retryTimeout;
 	quint64 retryWillFinish;
@@ -410,6 +453,11 @@ private:
 
 	QVector<MTPlong> ackRequestData, resendRequestData;
 
+	z_stream _gzipStream; // reused for all outgoing requests
+	bool _gzipInited;
+	int32 _gzipSkip;
+	uint64 _gzipRawBytes, _gzipPackedBytes, _gzipTime;
+
 	// if badTime received - search for ids in sessionData->haveSent and sessionData->wereAcked and sync time/salt, return true if found
 	bool requestsFixTimeSalt(const QVector<MTPlong> &ids, int32 serverTime, uint64 serverSalt);
 	
@@ -447,7 +495,8 @@ private:
 		, retries(0)
 		, g(0)
 		, req_num(0)
-		, msgs_sent(0) {
+		, msgs_sent(0)
+		, started(0) {
 			memset(new_nonce_buf, 0, sizeof(new_nonce_buf));
 			memset(aesKey, 0, sizeof(aesKey));
 			memset(aesIV, 0, sizeof(aesIV));
@@ -469,6 +518,8 @@ private:
 
 		uint32 req_num; // sent not encrypted request number
 		uint32 msgs_sent;
+
+		uint64 started;
 	};
 	struct AuthKeyCreateStrings {
 		QByteArray dh_prime;
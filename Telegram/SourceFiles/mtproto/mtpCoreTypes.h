@@ -56,6 +56,14 @@ typedef uint64 mtpPingId;
 typedef QVector<mtpPrime> mtpBuffer;
 typedef uint32 mtpTypeId;
 
+enum MTPRequestPriority {
+	MTPRequestInteractive = 0, // user waits for the result, like sending a message
+	MTPRequestNormal = 1,
+	MTPRequestBackground = 2, // prefetch and preload requests
+
+	MTPRequestPrioritiesCount = 3,
+};
+
 class mtpRequestData;
 class mtpRequest : public QSharedPointer<mtpRequestData> {
 public:
@@ -82,7 +90,11 @@ public:
 	mtpRequest after;
 	bool needsLayer;
 
-	mtpRequestData(bool/* sure*/) : msDate(0), requestId(0), needsLayer(false) {
+	MTPRequestPriority priority;
+	uint64 toSendDate; // when was put to toSend, for starvation protection
+	bool rttSkip; // resent, state requested or already measured, its ack does not give an rtt sample
+
+	mtpRequestData(bool/* sure*/) : msDate(0), requestId(0), needsLayer(false), priority(MTPRequestNormal), toSendDate(0), rttSkip(false) {
 	}
 
 	static mtpRequest prepare(uint32 requestSize, uint32 maxSize = 0) {
@@ -158,6 +170,7 @@ public:
 typedef QMap<mtpRequestId, mtpRequest> mtpPreRequestMap;
 typedef QMap<mtpMsgId, mtpRequest> mtpRequestMap;
 typedef QMap<mtpMsgId, bool> mtpMsgIdsSet;
+typedef QMultiMap<uint64, mtpMsgId> mtpMsgIdsByTime;
 class mtpMsgIdsMap : public QMap<mtpMsgId, bool> {
 public:	
 	typedef QMap<mtpMsgId, bool> ParentType;
@@ -881,13 +894,14 @@ public:
 		if (from + 1 > end) throw mtpErrorInsufficient();
 		if (cons != mtpc_vector) throw mtpErrorUnexpected(cons, "MTPvector");
 		uint32 count = (uint32)*(from++);
+		if (count > uint32(end - from)) throw mtpErrorInsufficient(); // each element takes at least one prime, don't resize to a garbage count
 
 		if (!data) setData(new MTPDvector<T>());
 		MTPDvector<T> &v(_vector());
 		v.v.resize(0);
-		v.v.reserve(count);
-		for (uint32 i = 0; i < count; ++i) {
-			v.v.push_back(T(from, end));
+		v.v.resize(count); // elements are read in place, without a temporary copy for each of them
+		for (typename VType::iterator i = v.v.begin(), e = v.v.end(); i != e; ++i) {
+			i->read(from, end);
 		}
 	}
 	void write(mtpBuffer &to) const {
@@ -32,6 +32,27 @@ namespace {
 	typedef QMap<int32, mtpAuthKeyPtr> _KeysMapForWrite;
 	_KeysMapForWrite _keysMapForWrite;
 	QMutex _keysMapForWriteMutex;
+
+	typedef QMap<int32, mtpDcAddresses> DcAddressesMap; // all addresses from config, not saved
+	DcAddressesMap _dcAddresses;
+	QMutex _dcAddressesMutex;
+
+	mtpDcAddress *_dcAddressFind(int32 dc, const QString &ip, int32 port) {
+		DcAddressesMap::iterator i = _dcAddresses.find(dc);
+		if (i == _dcAddresses.end()) return 0;
+
+		string ipStr(ip.toUtf8().constData());
+		for (mtpDcAddresses::iterator j = i.value().begin(), e = i.value().end(); j != e; ++j) {
+			if (j->ip == ipStr && j->port == port) return &(*j);
+		}
+		return 0;
+	}
+
+	bool _dcAddressLess(const mtpDcAddress &a, const mtpDcAddress &b) {
+		if (a.failures != b.failures) return a.failures < b.failures;
+		if (!a.rtt || !b.rtt) return a.rtt && !b.rtt; // known to work first, config order for the others
+		return a.rtt < b.rtt;
+	}
 }
 
 int32 mtpAuthed() {
@@ -154,9 +175,22 @@ namespace {
 void mtpUpdateDcOptions(const QVector<MTPDcOption> &options) {
 	QSet<int32> already, restart;
 	{
+		DcAddressesMap addresses;
 		mtpDcOptions opts(cDcOptions());
 		for (QVector<MTPDcOption>::const_iterator i = options.cbegin(), e = options.cend(); i != e; ++i) {
 			const MTPDdcOption &optData(i->c_dcOption());
+
+			mtpDcAddresses &dcAddresses(addresses[optData.vid.v]);
+			mtpDcAddress address(optData.vip_address.c_string().v, optData.vport.v);
+			bool found = false;
+			for (mtpDcAddresses::const_iterator j = dcAddresses.cbegin(), end = dcAddresses.cend(); j != end; ++j) {
+				if (j->ip == address.ip && j->port == address.port) {
+					found = true;
+					break;
+				}
+			}
+			if (!found) dcAddresses.push_back(address);
+
 			if (already.constFind(optData.vid.v) == already.cend()) {
 				already.insert(optData.vid.v);
 				mtpDcOptions::const_iterator a = opts.constFind(optData.vid.v);
@@ -169,12 +203,55 @@ void mtpUpdateDcOptions(const QVector<MTPDcOption> &options) {
 			}
 		}
 		cSetDcOptions(opts);
+
+		QMutexLocker lock(&_dcAddressesMutex);
+		for (DcAddressesMap::iterator i = addresses.begin(), e = addresses.end(); i != e; ++i) { // keep stats of the known addresses
+			for (mtpDcAddresses::iterator j = i.value().begin(), end = i.value().end(); j != end; ++j) {
+				if (mtpDcAddress *was = _dcAddressFind(i.key(), QString::fromUtf8(j->ip.c_str()), j->port)) {
+					j->rtt = was->rtt;
+					j->failures = was->failures;
+				}
+			}
+		}
+		_dcAddresses = addresses;
 	}
 	for (QSet<int32>::const_iterator i = restart.cbegin(), e = restart.cend(); i != e; ++i) {
 		MTP::restart(*i);
 	}
 }
 
+mtpDcAddresses mtpDcAddressesFor(int32 dc) {
+	QMutexLocker lock(&_dcAddressesMutex);
+
+	DcAddressesMap::iterator i = _dcAddresses.find(dc);
+	if (i == _dcAddresses.end()) { // no config loaded in this launch yet, use saved option
+		const mtpDcOptions &options(cDcOptions());
+		mtpDcOptions::const_iterator j = options.constFind(dc);
+		if (j == options.cend()) return mtpDcAddresses();
+
+		i = _dcAddresses.insert(dc, mtpDcAddresses() << mtpDcAddress(j.value().ip, j.value().port));
+	}
+	mtpDcAddresses result(i.value());
+	qStableSort(result.begin(), result.end(), _dcAddressLess);
+	return result;
+}
+
+void mtpDcAddressConnected(int32 dc, const QString &ip, int32 port, int32 ms) {
+	QMutexLocker lock(&_dcAddressesMutex);
+	if (mtpDcAddress *address = _dcAddressFind(dc, ip, port)) {
+		if (ms < 1) ms = 1;
+		address->rtt = address->rtt ? ((address->rtt * 3 + ms) / 4) : ms;
+		address->failures = 0;
+	}
+}
+
+void mtpDcAddressFailed(int32 dc, const QString &ip, int32 port) {
+	QMutexLocker lock(&_dcAddressesMutex);
+	if (mtpDcAddress *address = _dcAddressFind(dc, ip, port)) {
+		++address->failures;
+	}
+}
+
 MTProtoConfigLoader::MTProtoConfigLoader() : _enumCurrent(0), _enumRequest(0) {
 	connect(&_enumDCTimer, SIGNAL(timeout()), this, SLOT(enumDC()));
 	connect(this, SIGNAL(killCurrentSession(qint32,qint32)), this, SLOT(onKillCurrentSession(qint32,qint32)), Qt::QueuedConnection);
@@ -104,3 +104,18 @@ mtpKeysMap mtpGetKeys();
 void mtpSetKey(int32 dc, mtpAuthKeyPtr key);
 
 void mtpUpdateDcOptions(const QVector<MTPDcOption> &options);
+
+struct mtpDcAddress {
+	mtpDcAddress(const string &_ip = string(), int _port = 0) : ip(_ip), port(_port), rtt(0), failures(0) {
+	}
+
+	string ip;
+	int port;
+	int32 rtt; // smoothed tcp connect time in ms, 0 if never connected
+	int32 failures; // failed or lost connect attempts in a row
+};
+typedef QList<mtpDcAddress> mtpDcAddresses;
+
+mtpDcAddresses mtpDcAddressesFor(int32 dc); // all known addresses of the dc, best first
+void mtpDcAddressConnected(int32 dc, const QString &ip, int32 port, int32 ms);
+void mtpDcAddressFailed(int32 dc, const QString &ip, int32 port);
@@ -47,7 +47,7 @@ namespace {
 mtpFileLoader::mtpFileLoader(int32 dc, const int64 &volume, int32 local, const int64 &secret, int32 size) : prev(0), next(0),
 priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(0), volume(volume), local(local), secret(secret),
-id(0), access(0), fileIsOpen(false), size(size), type(mtpc_storage_fileUnknown) {
+id(0), access(0), fileIsOpen(false), size(size), type(mtpc_storage_fileUnknown), firstRequestAt(0), firstRequestWarm(false) {
 	LoaderQueues::iterator i = queues.find(dc);
 	if (i == queues.cend()) {
 		i = queues.insert(dc, mtpFileLoaderQueue());
@@ -58,7 +58,7 @@ id(0), access(0), fileIsOpen(false), size(size), type(mtpc_storage_fileUnknown)
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size) : prev(0), next(0),
 priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(locType), volume(0), local(0), secret(0),
-id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(false), size(size), type(mtpc_storage_fileUnknown) {
+id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(false), size(size), type(mtpc_storage_fileUnknown), firstRequestAt(0), firstRequestWarm(false) {
 	LoaderQueues::iterator i = queues.find(MTP::dld[0] + dc);
 	if (i == queues.cend()) {
 		i = queues.insert(MTP::dld[0] + dc, mtpFileLoaderQueue());
@@ -69,7 +69,7 @@ id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size, bool todata) : prev(0), next(0),
 priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(locType), volume(0), local(0), secret(0),
-id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(todata), size(size), type(mtpc_storage_fileUnknown) {
+id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(todata), size(size), type(mtpc_storage_fileUnknown), firstRequestAt(0), firstRequestWarm(false) {
 	LoaderQueues::iterator i = queues.find(MTP::dld[0] + dc);
 	if (i == queues.cend()) {
 		i = queues.insert(MTP::dld[0] + dc, mtpFileLoaderQueue());
@@ -163,8 +163,9 @@ bool mtpFileLoader::loadPart() {
 
 	int32 offset = nextRequestOffset, dcIndex = 0;
 	DataRequested &dr(_dataRequested[dc]);
-	if (size) {
+	if (size) { // first not filled session or the least loaded one, so that extra sessions are started only for big loads
 		for (int32 i = 1; i < MTPDownloadSessionsCount; ++i) {
+			if (dr.v[dcIndex] < MTPFileSessionFillSize) break;
 			if (dr.v[i] < dr.v[dcIndex]) {
 				dcIndex = i;
 			}
@@ -173,6 +174,11 @@ bool mtpFileLoader::loadPart() {
 
 	App::app()->killDownloadSessionsStop(dc);
 
+	if (!offset) {
+		firstRequestAt = getms(true);
+		firstRequestWarm = (MTP::dcstate(MTP::dld[dcIndex] + dc) == MTProtoConnection::Connected);
+	}
+
 	mtpRequestId reqId = MTP::send(MTPupload_GetFile(MTPupload_getFile(loc, MTP_int(offset), MTP_int(limit))), rpcDone(&mtpFileLoader::partLoaded, offset), rpcFail(&mtpFileLoader::partFailed), MTP::dld[dcIndex] + dc, 50);
 
 	++queue->queries;
@@ -197,6 +203,15 @@ void mtpFileLoader::partLoaded(int32 offset, const MTPupload_File &result, mtpRe
 
 	const MTPDupload_file &d(result.c_upload_file());
 	const string &bytes(d.vbytes.c_string().v);
+	static MetricHandle filesDownloadBytesMetric = metricCounter(qsl("files.download_bytes"));
+	metricAdd(filesDownloadBytesMetric, bytes.size());
+	if (!offset && firstRequestAt) {
+		static MetricHandle filesFirstByteWarmMsMetric = metricHistogram(qsl("files.first_byte_warm_ms")), filesFirstByteColdMsMetric = metricHistogram(qsl("files.first_byte_cold_ms"));
+		metricSample(firstRequestWarm ? filesFirstByteWarmMsMetric : filesFirstByteColdMsMetric, getms(true) - firstRequestAt);
+		firstRequestAt = 0;
+	}
+	static MetricHandle filesDownloadQueriesMetric = metricGauge(qsl("files.download_queries"));
+	metricSet(filesDownloadQueriesMetric, queue->queries);
 	if (bytes.size()) {
 		if (fileIsOpen) {
 			int64 fsize = file.size();
@@ -98,4 +98,7 @@ private:
 	int32 size;
 	mtpTypeId type;
 
+	uint64 firstRequestAt; // for time to first byte stats
+	bool firstRequestWarm;
+
 };
@@ -1267,6 +1267,8 @@ private:
 
 	friend MTPserver_DH_Params MTP_server_DH_params_fail(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPint128 &_new_nonce_hash);
 	friend MTPserver_DH_Params MTP_server_DH_params_ok(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPstring &_encrypted_answer);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPserver_DH_Params &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -1394,6 +1396,8 @@ private:
 	friend MTPset_client_DH_params_answer MTP_dh_gen_ok(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPint128 &_new_nonce_hash1);
 	friend MTPset_client_DH_params_answer MTP_dh_gen_retry(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPint128 &_new_nonce_hash2);
 	friend MTPset_client_DH_params_answer MTP_dh_gen_fail(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPint128 &_new_nonce_hash3);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPset_client_DH_params_answer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -1476,6 +1480,8 @@ private:
 
 	friend MTPbadMsgNotification MTP_bad_msg_notification(const MTPlong &_bad_msg_id, MTPint _bad_msg_seqno, MTPint _error_code);
 	friend MTPbadMsgNotification MTP_bad_server_salt(const MTPlong &_bad_msg_id, MTPint _bad_msg_seqno, MTPint _error_code, const MTPlong &_new_server_salt);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPbadMsgNotification &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -1620,6 +1626,8 @@ private:
 
 	friend MTPmsgDetailedInfo MTP_msg_detailed_info(const MTPlong &_msg_id, const MTPlong &_answer_msg_id, MTPint _bytes, MTPint _status);
 	friend MTPmsgDetailedInfo MTP_msg_new_detailed_info(const MTPlong &_answer_msg_id, MTPint _bytes, MTPint _status);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmsgDetailedInfo &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -1721,6 +1729,8 @@ private:
 	friend MTPrpcDropAnswer MTP_rpc_answer_unknown();
 	friend MTPrpcDropAnswer MTP_rpc_answer_dropped_running();
 	friend MTPrpcDropAnswer MTP_rpc_answer_dropped(const MTPlong &_msg_id, MTPint _seq_no, MTPint _bytes);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPrpcDropAnswer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -1865,6 +1875,8 @@ private:
 
 	friend MTPdestroySessionRes MTP_destroy_session_ok(const MTPlong &_session_id);
 	friend MTPdestroySessionRes MTP_destroy_session_none(const MTPlong &_session_id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPdestroySessionRes &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2046,6 +2058,8 @@ private:
 	friend MTPinputPeer MTP_inputPeerContact(MTPint _user_id);
 	friend MTPinputPeer MTP_inputPeerForeign(MTPint _user_id, const MTPlong &_access_hash);
 	friend MTPinputPeer MTP_inputPeerChat(MTPint _chat_id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputPeer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2099,6 +2113,8 @@ private:
 	friend MTPinputUser MTP_inputUserSelf();
 	friend MTPinputUser MTP_inputUserContact(MTPint _user_id);
 	friend MTPinputUser MTP_inputUserForeign(MTPint _user_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputUser &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2181,6 +2197,8 @@ private:
 
 	friend MTPinputFile MTP_inputFile(const MTPlong &_id, MTPint _parts, const MTPstring &_name, const MTPstring &_md5_checksum);
 	friend MTPinputFile MTP_inputFileBig(const MTPlong &_id, MTPint _parts, const MTPstring &_name);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputFile &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2373,6 +2391,8 @@ private:
 	friend MTPinputMedia MTP_inputMediaUploadedDocument(const MTPInputFile &_file, const MTPstring &_mime_type, const MTPVector<MTPDocumentAttribute> &_attributes);
 	friend MTPinputMedia MTP_inputMediaUploadedThumbDocument(const MTPInputFile &_file, const MTPInputFile &_thumb, const MTPstring &_mime_type, const MTPVector<MTPDocumentAttribute> &_attributes);
 	friend MTPinputMedia MTP_inputMediaDocument(const MTPInputDocument &_id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputMedia &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2425,6 +2445,8 @@ private:
 	friend MTPinputChatPhoto MTP_inputChatPhotoEmpty();
 	friend MTPinputChatPhoto MTP_inputChatUploadedPhoto(const MTPInputFile &_file, const MTPInputPhotoCrop &_crop);
 	friend MTPinputChatPhoto MTP_inputChatPhoto(const MTPInputPhoto &_id, const MTPInputPhotoCrop &_crop);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputChatPhoto &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2463,6 +2485,8 @@ private:
 
 	friend MTPinputGeoPoint MTP_inputGeoPointEmpty();
 	friend MTPinputGeoPoint MTP_inputGeoPoint(const MTPdouble &_lat, const MTPdouble &_long);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputGeoPoint &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2501,6 +2525,8 @@ private:
 
 	friend MTPinputPhoto MTP_inputPhotoEmpty();
 	friend MTPinputPhoto MTP_inputPhoto(const MTPlong &_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputPhoto &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2539,6 +2565,8 @@ private:
 
 	friend MTPinputVideo MTP_inputVideoEmpty();
 	friend MTPinputVideo MTP_inputVideo(const MTPlong &_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputVideo &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2632,6 +2660,8 @@ private:
 	friend MTPinputFileLocation MTP_inputEncryptedFileLocation(const MTPlong &_id, const MTPlong &_access_hash);
 	friend MTPinputFileLocation MTP_inputAudioFileLocation(const MTPlong &_id, const MTPlong &_access_hash);
 	friend MTPinputFileLocation MTP_inputDocumentFileLocation(const MTPlong &_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputFileLocation &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2670,6 +2700,8 @@ private:
 
 	friend MTPinputPhotoCrop MTP_inputPhotoCropAuto();
 	friend MTPinputPhotoCrop MTP_inputPhotoCrop(const MTPdouble &_crop_left, const MTPdouble &_crop_top, const MTPdouble &_crop_width);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputPhotoCrop &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2752,6 +2784,8 @@ private:
 
 	friend MTPpeer MTP_peerUser(MTPint _user_id);
 	friend MTPpeer MTP_peerChat(MTPint _chat_id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPpeer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2836,6 +2870,8 @@ private:
 
 	friend MTPfileLocation MTP_fileLocationUnavailable(const MTPlong &_volume_id, MTPint _local_id, const MTPlong &_secret);
 	friend MTPfileLocation MTP_fileLocation(MTPint _dc_id, const MTPlong &_volume_id, MTPint _local_id, const MTPlong &_secret);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPfileLocation &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2943,6 +2979,8 @@ private:
 	friend MTPuser MTP_userRequest(MTPint _id, const MTPstring &_first_name, const MTPstring &_last_name, const MTPstring &_username, const MTPlong &_access_hash, const MTPstring &_phone, const MTPUserProfilePhoto &_photo, const MTPUserStatus &_status);
 	friend MTPuser MTP_userForeign(MTPint _id, const MTPstring &_first_name, const MTPstring &_last_name, const MTPstring &_username, const MTPlong &_access_hash, const MTPUserProfilePhoto &_photo, const MTPUserStatus &_status);
 	friend MTPuser MTP_userDeleted(MTPint _id, const MTPstring &_first_name, const MTPstring &_last_name, const MTPstring &_username);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPuser &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -2981,6 +3019,8 @@ private:
 
 	friend MTPuserProfilePhoto MTP_userProfilePhotoEmpty();
 	friend MTPuserProfilePhoto MTP_userProfilePhoto(const MTPlong &_photo_id, const MTPFileLocation &_photo_small, const MTPFileLocation &_photo_big);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPuserProfilePhoto &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3036,6 +3076,8 @@ private:
 	friend MTPuserStatus MTP_userStatusRecently();
 	friend MTPuserStatus MTP_userStatusLastWeek();
 	friend MTPuserStatus MTP_userStatusLastMonth();
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPuserStatus &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3115,6 +3157,8 @@ private:
 	friend MTPchat MTP_chat(MTPint _id, const MTPstring &_title, const MTPChatPhoto &_photo, MTPint _participants_count, MTPint _date, MTPBool _left, MTPint _version);
 	friend MTPchat MTP_chatForbidden(MTPint _id, const MTPstring &_title, MTPint _date);
 	friend MTPchat MTP_geoChat(MTPint _id, const MTPlong &_access_hash, const MTPstring &_title, const MTPstring &_address, const MTPstring &_venue, const MTPGeoPoint &_geo, const MTPChatPhoto &_photo, MTPint _participants_count, MTPint _date, MTPBool _checked_in, MTPint _version);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPchat &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3228,6 +3272,8 @@ private:
 
 	friend MTPchatParticipants MTP_chatParticipantsForbidden(MTPint _chat_id);
 	friend MTPchatParticipants MTP_chatParticipants(MTPint _chat_id, MTPint _admin_id, const MTPVector<MTPChatParticipant> &_participants, MTPint _version);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPchatParticipants &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3266,6 +3312,8 @@ private:
 
 	friend MTPchatPhoto MTP_chatPhotoEmpty();
 	friend MTPchatPhoto MTP_chatPhoto(const MTPFileLocation &_photo_small, const MTPFileLocation &_photo_big);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPchatPhoto &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3331,6 +3379,8 @@ private:
 	friend MTPmessage MTP_messageEmpty(MTPint _id);
 	friend MTPmessage MTP_message(MTPint _flags, MTPint _id, MTPint _from_id, const MTPPeer &_to_id, MTPint _fwd_from_id, MTPint _fwd_date, MTPint _reply_to_msg_id, MTPint _date, const MTPstring &_message, const MTPMessageMedia &_media);
 	friend MTPmessage MTP_messageService(MTPint _flags, MTPint _id, MTPint _from_id, const MTPPeer &_to_id, MTPint _date, const MTPMessageAction &_action);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3454,6 +3504,8 @@ private:
 	friend MTPmessageMedia MTP_messageMediaDocument(const MTPDocument &_document);
 	friend MTPmessageMedia MTP_messageMediaAudio(const MTPAudio &_audio);
 	friend MTPmessageMedia MTP_messageMediaWebPage(const MTPWebPage &_webpage);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessageMedia &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3564,6 +3616,8 @@ private:
 	friend MTPmessageAction MTP_messageActionChatDeleteUser(MTPint _user_id);
 	friend MTPmessageAction MTP_messageActionGeoChatCreate(const MTPstring &_title, const MTPstring &_address);
 	friend MTPmessageAction MTP_messageActionGeoChatCheckin();
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessageAction &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3646,6 +3700,8 @@ private:
 
 	friend MTPphoto MTP_photoEmpty(const MTPlong &_id);
 	friend MTPphoto MTP_photo(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, const MTPstring &_caption, const MTPGeoPoint &_geo, const MTPVector<MTPPhotoSize> &_sizes);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPphoto &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3711,6 +3767,8 @@ private:
 	friend MTPphotoSize MTP_photoSizeEmpty(const MTPstring &_type);
 	friend MTPphotoSize MTP_photoSize(const MTPstring &_type, const MTPFileLocation &_location, MTPint _w, MTPint _h, MTPint _size);
 	friend MTPphotoSize MTP_photoCachedSize(const MTPstring &_type, const MTPFileLocation &_location, MTPint _w, MTPint _h, const MTPbytes &_bytes);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPphotoSize &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3762,6 +3820,8 @@ private:
 
 	friend MTPvideo MTP_videoEmpty(const MTPlong &_id);
 	friend MTPvideo MTP_video(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, const MTPstring &_caption, MTPint _duration, const MTPstring &_mime_type, MTPint _size, const MTPPhotoSize &_thumb, MTPint _dc_id, MTPint _w, MTPint _h);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPvideo &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3800,6 +3860,8 @@ private:
 
 	friend MTPgeoPoint MTP_geoPointEmpty();
 	friend MTPgeoPoint MTP_geoPoint(const MTPdouble &_long, const MTPdouble &_lat);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPgeoPoint &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3882,6 +3944,8 @@ private:
 
 	friend MTPauth_sentCode MTP_auth_sentCode(MTPBool _phone_registered, const MTPstring &_phone_code_hash, MTPint _send_call_timeout, MTPBool _is_password);
 	friend MTPauth_sentCode MTP_auth_sentAppCode(MTPBool _phone_registered, const MTPstring &_phone_code_hash, MTPint _send_call_timeout, MTPBool _is_password);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPauth_sentCode &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -3998,6 +4062,8 @@ private:
 	friend MTPinputNotifyPeer MTP_inputNotifyChats();
 	friend MTPinputNotifyPeer MTP_inputNotifyAll();
 	friend MTPinputNotifyPeer MTP_inputNotifyGeoChatPeer(const MTPInputGeoChat &_peer);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputNotifyPeer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4117,6 +4183,8 @@ private:
 
 	friend MTPpeerNotifySettings MTP_peerNotifySettingsEmpty();
 	friend MTPpeerNotifySettings MTP_peerNotifySettings(MTPint _mute_until, const MTPstring &_sound, MTPBool _show_previews, MTPint _events_mask);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPpeerNotifySettings &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4168,6 +4236,8 @@ private:
 
 	friend MTPwallPaper MTP_wallPaper(MTPint _id, const MTPstring &_title, const MTPVector<MTPPhotoSize> &_sizes, MTPint _color);
 	friend MTPwallPaper MTP_wallPaperSolid(MTPint _id, const MTPstring &_title, MTPint _bg_color, MTPint _color);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPwallPaper &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4454,6 +4524,8 @@ private:
 
 	friend MTPcontacts_contacts MTP_contacts_contactsNotModified();
 	friend MTPcontacts_contacts MTP_contacts_contacts(const MTPVector<MTPContact> &_contacts, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPcontacts_contacts &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4536,6 +4608,8 @@ private:
 
 	friend MTPcontacts_blocked MTP_contacts_blocked(const MTPVector<MTPContactBlocked> &_blocked, const MTPVector<MTPUser> &_users);
 	friend MTPcontacts_blocked MTP_contacts_blockedSlice(MTPint _count, const MTPVector<MTPContactBlocked> &_blocked, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPcontacts_blocked &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4618,6 +4692,8 @@ private:
 
 	friend MTPmessages_dialogs MTP_messages_dialogs(const MTPVector<MTPDialog> &_dialogs, const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
 	friend MTPmessages_dialogs MTP_messages_dialogsSlice(MTPint _count, const MTPVector<MTPDialog> &_dialogs, const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_dialogs &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4669,6 +4745,8 @@ private:
 
 	friend MTPmessages_messages MTP_messages_messages(const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
 	friend MTPmessages_messages MTP_messages_messagesSlice(MTPint _count, const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_messages &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -4741,6 +4819,8 @@ private:
 
 	friend MTPmessages_sentMessage MTP_messages_sentMessage(MTPint _id, MTPint _date, const MTPMessageMedia &_media, MTPint _pts, MTPint _pts_count);
 	friend MTPmessages_sentMessage MTP_messages_sentMessageLink(MTPint _id, MTPint _date, const MTPMessageMedia &_media, MTPint _pts, MTPint _pts_count, const MTPVector<MTPcontacts_Link> &_links, MTPint _seq);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_sentMessage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5293,6 +5373,8 @@ private:
 	friend MTPupdate MTP_updateReadHistoryInbox(const MTPPeer &_peer, MTPint _max_id, MTPint _pts, MTPint _pts_count);
 	friend MTPupdate MTP_updateReadHistoryOutbox(const MTPPeer &_peer, MTPint _max_id, MTPint _pts, MTPint _pts_count);
 	friend MTPupdate MTP_updateWebPage(const MTPWebPage &_webpage);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPupdate &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5389,6 +5471,8 @@ private:
 	friend MTPupdates_difference MTP_updates_differenceEmpty(MTPint _date, MTPint _seq);
 	friend MTPupdates_difference MTP_updates_difference(const MTPVector<MTPMessage> &_new_messages, const MTPVector<MTPEncryptedMessage> &_new_encrypted_messages, const MTPVector<MTPUpdate> &_other_updates, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users, const MTPupdates_State &_state);
 	friend MTPupdates_difference MTP_updates_differenceSlice(const MTPVector<MTPMessage> &_new_messages, const MTPVector<MTPEncryptedMessage> &_new_encrypted_messages, const MTPVector<MTPUpdate> &_other_updates, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users, const MTPupdates_State &_intermediate_state);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPupdates_difference &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5483,6 +5567,8 @@ private:
 	friend MTPupdates MTP_updateShort(const MTPUpdate &_update, MTPint _date);
 	friend MTPupdates MTP_updatesCombined(const MTPVector<MTPUpdate> &_updates, const MTPVector<MTPUser> &_users, const MTPVector<MTPChat> &_chats, MTPint _date, MTPint _seq_start, MTPint _seq);
 	friend MTPupdates MTP_updates(const MTPVector<MTPUpdate> &_updates, const MTPVector<MTPUser> &_users, const MTPVector<MTPChat> &_chats, MTPint _date, MTPint _seq);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPupdates &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5534,6 +5620,8 @@ private:
 
 	friend MTPphotos_photos MTP_photos_photos(const MTPVector<MTPPhoto> &_photos, const MTPVector<MTPUser> &_users);
 	friend MTPphotos_photos MTP_photos_photosSlice(MTPint _count, const MTPVector<MTPPhoto> &_photos, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPphotos_photos &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5727,6 +5815,8 @@ private:
 
 	friend MTPhelp_appUpdate MTP_help_appUpdate(MTPint _id, MTPBool _critical, const MTPstring &_url, const MTPstring &_text);
 	friend MTPhelp_appUpdate MTP_help_noAppUpdate();
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPhelp_appUpdate &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5854,6 +5944,8 @@ private:
 	friend MTPgeoChatMessage MTP_geoChatMessageEmpty(MTPint _chat_id, MTPint _id);
 	friend MTPgeoChatMessage MTP_geoChatMessage(MTPint _chat_id, MTPint _id, MTPint _from_id, MTPint _date, const MTPstring &_message, const MTPMessageMedia &_media);
 	friend MTPgeoChatMessage MTP_geoChatMessageService(MTPint _chat_id, MTPint _id, MTPint _from_id, MTPint _date, const MTPMessageAction &_action);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPgeoChatMessage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -5967,6 +6059,8 @@ private:
 
 	friend MTPgeochats_messages MTP_geochats_messages(const MTPVector<MTPGeoChatMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
 	friend MTPgeochats_messages MTP_geochats_messagesSlice(MTPint _count, const MTPVector<MTPGeoChatMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPgeochats_messages &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6060,6 +6154,8 @@ private:
 	friend MTPencryptedChat MTP_encryptedChatRequested(MTPint _id, const MTPlong &_access_hash, MTPint _date, MTPint _admin_id, MTPint _participant_id, const MTPbytes &_g_a);
 	friend MTPencryptedChat MTP_encryptedChat(MTPint _id, const MTPlong &_access_hash, MTPint _date, MTPint _admin_id, MTPint _participant_id, const MTPbytes &_g_a_or_b, const MTPlong &_key_fingerprint);
 	friend MTPencryptedChat MTP_encryptedChatDiscarded(MTPint _id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPencryptedChat &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6129,6 +6225,8 @@ private:
 
 	friend MTPencryptedFile MTP_encryptedFileEmpty();
 	friend MTPencryptedFile MTP_encryptedFile(const MTPlong &_id, const MTPlong &_access_hash, MTPint _size, MTPint _dc_id, MTPint _key_fingerprint);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPencryptedFile &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6195,6 +6293,8 @@ private:
 	friend MTPinputEncryptedFile MTP_inputEncryptedFileUploaded(const MTPlong &_id, MTPint _parts, const MTPstring &_md5_checksum, MTPint _key_fingerprint);
 	friend MTPinputEncryptedFile MTP_inputEncryptedFile(const MTPlong &_id, const MTPlong &_access_hash);
 	friend MTPinputEncryptedFile MTP_inputEncryptedFileBigUploaded(const MTPlong &_id, MTPint _parts, MTPint _key_fingerprint);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputEncryptedFile &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6246,6 +6346,8 @@ private:
 
 	friend MTPencryptedMessage MTP_encryptedMessage(const MTPlong &_random_id, MTPint _chat_id, MTPint _date, const MTPbytes &_bytes, const MTPEncryptedFile &_file);
 	friend MTPencryptedMessage MTP_encryptedMessageService(const MTPlong &_random_id, MTPint _chat_id, MTPint _date, const MTPbytes &_bytes);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPencryptedMessage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6297,6 +6399,8 @@ private:
 
 	friend MTPmessages_dhConfig MTP_messages_dhConfigNotModified(const MTPbytes &_random);
 	friend MTPmessages_dhConfig MTP_messages_dhConfig(MTPint _g, const MTPbytes &_p, MTPint _version, const MTPbytes &_random);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_dhConfig &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6348,6 +6452,8 @@ private:
 
 	friend MTPmessages_sentEncryptedMessage MTP_messages_sentEncryptedMessage(MTPint _date);
 	friend MTPmessages_sentEncryptedMessage MTP_messages_sentEncryptedFile(MTPint _date, const MTPEncryptedFile &_file);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_sentEncryptedMessage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6386,6 +6492,8 @@ private:
 
 	friend MTPinputAudio MTP_inputAudioEmpty();
 	friend MTPinputAudio MTP_inputAudio(const MTPlong &_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputAudio &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6424,6 +6532,8 @@ private:
 
 	friend MTPinputDocument MTP_inputDocumentEmpty();
 	friend MTPinputDocument MTP_inputDocument(const MTPlong &_id, const MTPlong &_access_hash);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputDocument &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6475,6 +6585,8 @@ private:
 
 	friend MTPaudio MTP_audioEmpty(const MTPlong &_id);
 	friend MTPaudio MTP_audio(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, MTPint _duration, const MTPstring &_mime_type, MTPint _size, MTPint _dc_id);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPaudio &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6526,6 +6638,8 @@ private:
 
 	friend MTPdocument MTP_documentEmpty(const MTPlong &_id);
 	friend MTPdocument MTP_document(const MTPlong &_id, const MTPlong &_access_hash, MTPint _date, const MTPstring &_mime_type, MTPint _size, const MTPPhotoSize &_thumb, MTPint _dc_id, const MTPVector<MTPDocumentAttribute> &_attributes);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPdocument &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6597,6 +6711,8 @@ private:
 	friend MTPnotifyPeer MTP_notifyUsers();
 	friend MTPnotifyPeer MTP_notifyChats();
 	friend MTPnotifyPeer MTP_notifyAll();
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPnotifyPeer &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6789,6 +6905,8 @@ private:
 	friend MTPinputPrivacyRule MTP_inputPrivacyValueDisallowContacts();
 	friend MTPinputPrivacyRule MTP_inputPrivacyValueDisallowAll();
 	friend MTPinputPrivacyRule MTP_inputPrivacyValueDisallowUsers(const MTPVector<MTPInputUser> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPinputPrivacyRule &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -6844,6 +6962,8 @@ private:
 	friend MTPprivacyRule MTP_privacyValueDisallowContacts();
 	friend MTPprivacyRule MTP_privacyValueDisallowAll();
 	friend MTPprivacyRule MTP_privacyValueDisallowUsers(const MTPVector<MTPint> &_users);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPprivacyRule &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -7031,6 +7151,8 @@ private:
 	friend MTPdocumentAttribute MTP_documentAttributeVideo(MTPint _duration, MTPint _w, MTPint _h);
 	friend MTPdocumentAttribute MTP_documentAttributeAudio(MTPint _duration);
 	friend MTPdocumentAttribute MTP_documentAttributeFilename(const MTPstring &_file_name);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPdocumentAttribute &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -7069,6 +7191,8 @@ private:
 
 	friend MTPmessages_stickers MTP_messages_stickersNotModified();
 	friend MTPmessages_stickers MTP_messages_stickers(const MTPstring &_hash, const MTPVector<MTPDocument> &_stickers);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_stickers &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -7138,6 +7262,8 @@ private:
 
 	friend MTPmessages_allStickers MTP_messages_allStickersNotModified();
 	friend MTPmessages_allStickers MTP_messages_allStickers(const MTPstring &_hash, const MTPVector<MTPStickerPack> &_packs, const MTPVector<MTPDocument> &_documents);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPmessages_allStickers &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -7292,6 +7418,8 @@ private:
 	friend MTPwebPage MTP_webPageEmpty(const MTPlong &_id);
 	friend MTPwebPage MTP_webPagePending(const MTPlong &_id, MTPint _date);
 	friend MTPwebPage MTP_webPage(MTPint _flags, const MTPlong &_id, const MTPstring &_url, const MTPstring &_display_url, const MTPstring &_type, const MTPstring &_site_name, const MTPstring &_title, const MTPstring &_description, const MTPPhoto &_photo, const MTPstring &_embed_url, const MTPstring &_embed_type, MTPint _embed_width, MTPint _embed_height, MTPint _duration, const MTPstring &_author);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPwebPage &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -7405,6 +7533,8 @@ private:
 
 	friend MTPaccount_password MTP_account_noPassword(const MTPbytes &_new_salt, const MTPstring &_email_unconfirmed_pattern);
 	friend MTPaccount_password MTP_account_password(const MTPbytes &_current_salt, const MTPbytes &_new_salt, const MTPstring &_hint, MTPBool _has_recovery, const MTPstring &_email_unconfirmed_pattern);
+	template <typename Visitor>
+	friend bool mtpVisit(const MTPaccount_password &value, Visitor &visitor);
 
 	mtpTypeId _type;
 };
@@ -15982,11 +16112,11 @@ inline MTPp_Q_inner_data MTP_p_q_inner_data(const MTPstring &_pq, const MTPstrin
 inline uint32 MTPserver_DH_Params::innerLength() const {
 	switch (_type) {
 		case mtpc_server_DH_params_fail: {
-			const MTPDserver_DH_params_fail &v(c_server_DH_params_fail());
+			const MTPDserver_DH_params_fail &v(*(const MTPDserver_DH_params_fail*)data);
 			return v.vnonce.innerLength() + v.vserver_nonce.innerLength() + v.vnew_nonce_hash.innerLength();
 		}
 		case mtpc_server_DH_params_ok: {
-			const MTPDserver_DH_params_ok &v(c_server_DH_params_ok());
+			const MTPDserver_DH_params_ok &v(*(const MTPDserver_DH_params_ok*)data);
 			return v.vnonce.innerLength() + v.vserver_nonce.innerLength() + v.vencrypted_answer.innerLength();
 		}
 	}
@@ -16001,14 +16131,16 @@ inline void MTPserver_DH_Params::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_server_DH_params_fail: _type = cons; {
 			if (!data) setData(new MTPDserver_DH_params_fail());
-			MTPDserver_DH_params_fail &v(_server_DH_params_fail());
+			split();
+			MTPDserver_DH_params_fail &v(*(MTPDserver_DH_params_fail*)data);
 			v.vnonce.read(from, end);
 			v.vserver_nonce.read(from, end);
 			v.vnew_nonce_hash.read(from, end);
 		} break;
 		case mtpc_server_DH_params_ok: _type = cons; {
 			if (!data) setData(new MTPDserver_DH_params_ok());
-			MTPDserver_DH_params_ok &v(_server_DH_params_ok());
+			split();
+			MTPDserver_DH_params_ok &v(*(MTPDserver_DH_params_ok*)data);
 			v.vnonce.read(from, end);
 			v.vserver_nonce.read(from, end);
 			v.vencrypted_answer.read(from, end);
@@ -16019,13 +16151,13 @@ inline void MTPserver_DH_Params::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPserver_DH_Params::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_server_DH_params_fail: {
-			const MTPDserver_DH_params_fail &v(c_server_DH_params_fail());
+			const MTPDserver_DH_params_fail &v(*(const MTPDserver_DH_params_fail*)data);
 			v.vnonce.write(to);
 			v.vserver_nonce.write(to);
 			v.vnew_nonce_hash.write(to);
 		} break;
 		case mtpc_server_DH_params_ok: {
-			const MTPDserver_DH_params_ok &v(c_server_DH_params_ok());
+			const MTPDserver_DH_params_ok &v(*(const MTPDserver_DH_params_ok*)data);
 			v.vnonce.write(to);
 			v.vserver_nonce.write(to);
 			v.vencrypted_answer.write(to);
@@ -16049,6 +16181,14 @@ inline MTPserver_DH_Params MTP_server_DH_params_fail(const MTPint128 &_nonce, co
 inline MTPserver_DH_Params MTP_server_DH_params_ok(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPstring &_encrypted_answer) {
 	return MTPserver_DH_Params(new MTPDserver_DH_params_ok(_nonce, _server_nonce, _encrypted_answer));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPserver_DH_Params &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_server_DH_params_fail: visitor(*(const MTPDserver_DH_params_fail*)value.data); return true;
+	case mtpc_server_DH_params_ok: visitor(*(const MTPDserver_DH_params_ok*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPserver_DH_inner_data::MTPserver_DH_inner_data() : mtpDataOwner(new MTPDserver_DH_inner_data()) {
 }
@@ -16123,15 +16263,15 @@ inline MTPclient_DH_Inner_Data MTP_client_DH_inner_data(const MTPint128 &_nonce,
 inline uint32 MTPset_client_DH_params_answer::innerLength() const {
 	switch (_type) {
 		case mtpc_dh_gen_ok: {
-			const MTPDdh_gen_ok &v(c_dh_gen_ok());
+			const MTPDdh_gen_ok &v(*(const MTPDdh_gen_ok*)data);
 			return v.vnonce.innerLength() + v.vserver_nonce.innerLength() + v.vnew_nonce_hash1.innerLength();
 		}
 		case mtpc_dh_gen_retry: {
-			const MTPDdh_gen_retry &v(c_dh_gen_retry());
+			const MTPDdh_gen_retry &v(*(const MTPDdh_gen_retry*)data);
 			return v.vnonce.innerLength() + v.vserver_nonce.innerLength() + v.vnew_nonce_hash2.innerLength();
 		}
 		case mtpc_dh_gen_fail: {
-			const MTPDdh_gen_fail &v(c_dh_gen_fail());
+			const MTPDdh_gen_fail &v(*(const MTPDdh_gen_fail*)data);
 			return v.vnonce.innerLength() + v.vserver_nonce.innerLength() + v.vnew_nonce_hash3.innerLength();
 		}
 	}
@@ -16146,21 +16286,24 @@ inline void MTPset_client_DH_params_answer::read(const mtpPrime *&from, const mt
 	switch (cons) {
 		case mtpc_dh_gen_ok: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_ok());
-			MTPDdh_gen_ok &v(_dh_gen_ok());
+			split();
+			MTPDdh_gen_ok &v(*(MTPDdh_gen_ok*)data);
 			v.vnonce.read(from, end);
 			v.vserver_nonce.read(from, end);
 			v.vnew_nonce_hash1.read(from, end);
 		} break;
 		case mtpc_dh_gen_retry: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_retry());
-			MTPDdh_gen_retry &v(_dh_gen_retry());
+			split();
+			MTPDdh_gen_retry &v(*(MTPDdh_gen_retry*)data);
 			v.vnonce.read(from, end);
 			v.vserver_nonce.read(from, end);
 			v.vnew_nonce_hash2.read(from, end);
 		} break;
 		case mtpc_dh_gen_fail: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_fail());
-			MTPDdh_gen_fail &v(_dh_gen_fail());
+			split();
+			MTPDdh_gen_fail &v(*(MTPDdh_gen_fail*)data);
 			v.vnonce.read(from, end);
 			v.vserver_nonce.read(from, end);
 			v.vnew_nonce_hash3.read(from, end);
@@ -16171,19 +16314,19 @@ inline void MTPset_client_DH_params_answer::read(const mtpPrime *&from, const mt
 inline void MTPset_client_DH_params_answer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_dh_gen_ok: {
-			const MTPDdh_gen_ok &v(c_dh_gen_ok());
+			const MTPDdh_gen_ok &v(*(const MTPDdh_gen_ok*)data);
 			v.vnonce.write(to);
 			v.vserver_nonce.write(to);
 			v.vnew_nonce_hash1.write(to);
 		} break;
 		case mtpc_dh_gen_retry: {
-			const MTPDdh_gen_retry &v(c_dh_gen_retry());
+			const MTPDdh_gen_retry &v(*(const MTPDdh_gen_retry*)data);
 			v.vnonce.write(to);
 			v.vserver_nonce.write(to);
 			v.vnew_nonce_hash2.write(to);
 		} break;
 		case mtpc_dh_gen_fail: {
-			const MTPDdh_gen_fail &v(c_dh_gen_fail());
+			const MTPDdh_gen_fail &v(*(const MTPDdh_gen_fail*)data);
 			v.vnonce.write(to);
 			v.vserver_nonce.write(to);
 			v.vnew_nonce_hash3.write(to);
@@ -16213,6 +16356,15 @@ inline MTPset_client_DH_params_answer MTP_dh_gen_retry(const MTPint128 &_nonce,
 inline MTPset_client_DH_params_answer MTP_dh_gen_fail(const MTPint128 &_nonce, const MTPint128 &_server_nonce, const MTPint128 &_new_nonce_hash3) {
 	return MTPset_client_DH_params_answer(new MTPDdh_gen_fail(_nonce, _server_nonce, _new_nonce_hash3));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPset_client_DH_params_answer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_dh_gen_ok: visitor(*(const MTPDdh_gen_ok*)value.data); return true;
+	case mtpc_dh_gen_retry: visitor(*(const MTPDdh_gen_retry*)value.data); return true;
+	case mtpc_dh_gen_fail: visitor(*(const MTPDdh_gen_fail*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPmsgsAck::MTPmsgsAck() : mtpDataOwner(new MTPDmsgs_ack()) {
 }
@@ -16244,11 +16396,11 @@ inline MTPmsgsAck MTP_msgs_ack(const MTPVector<MTPlong> &_msg_ids) {
 inline uint32 MTPbadMsgNotification::innerLength() const {
 	switch (_type) {
 		case mtpc_bad_msg_notification: {
-			const MTPDbad_msg_notification &v(c_bad_msg_notification());
+			const MTPDbad_msg_notification &v(*(const MTPDbad_msg_notification*)data);
 			return v.vbad_msg_id.innerLength() + v.vbad_msg_seqno.innerLength() + v.verror_code.innerLength();
 		}
 		case mtpc_bad_server_salt: {
-			const MTPDbad_server_salt &v(c_bad_server_salt());
+			const MTPDbad_server_salt &v(*(const MTPDbad_server_salt*)data);
 			return v.vbad_msg_id.innerLength() + v.vbad_msg_seqno.innerLength() + v.verror_code.innerLength() + v.vnew_server_salt.innerLength();
 		}
 	}
@@ -16263,14 +16415,16 @@ inline void MTPbadMsgNotification::read(const mtpPrime *&from, const mtpPrime *e
 	switch (cons) {
 		case mtpc_bad_msg_notification: _type = cons; {
 			if (!data) setData(new MTPDbad_msg_notification());
-			MTPDbad_msg_notification &v(_bad_msg_notification());
+			split();
+			MTPDbad_msg_notification &v(*(MTPDbad_msg_notification*)data);
 			v.vbad_msg_id.read(from, end);
 			v.vbad_msg_seqno.read(from, end);
 			v.verror_code.read(from, end);
 		} break;
 		case mtpc_bad_server_salt: _type = cons; {
 			if (!data) setData(new MTPDbad_server_salt());
-			MTPDbad_server_salt &v(_bad_server_salt());
+			split();
+			MTPDbad_server_salt &v(*(MTPDbad_server_salt*)data);
 			v.vbad_msg_id.read(from, end);
 			v.vbad_msg_seqno.read(from, end);
 			v.verror_code.read(from, end);
@@ -16282,13 +16436,13 @@ inline void MTPbadMsgNotification::read(const mtpPrime *&from, const mtpPrime *e
 inline void MTPbadMsgNotification::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_bad_msg_notification: {
-			const MTPDbad_msg_notification &v(c_bad_msg_notification());
+			const MTPDbad_msg_notification &v(*(const MTPDbad_msg_notification*)data);
 			v.vbad_msg_id.write(to);
 			v.vbad_msg_seqno.write(to);
 			v.verror_code.write(to);
 		} break;
 		case mtpc_bad_server_salt: {
-			const MTPDbad_server_salt &v(c_bad_server_salt());
+			const MTPDbad_server_salt &v(*(const MTPDbad_server_salt*)data);
 			v.vbad_msg_id.write(to);
 			v.vbad_msg_seqno.write(to);
 			v.verror_code.write(to);
@@ -16313,6 +16467,14 @@ inline MTPbadMsgNotification MTP_bad_msg_notification(const MTPlong &_bad_msg_id
 inline MTPbadMsgNotification MTP_bad_server_salt(const MTPlong &_bad_msg_id, MTPint _bad_msg_seqno, MTPint _error_code, const MTPlong &_new_server_salt) {
 	return MTPbadMsgNotification(new MTPDbad_server_salt(_bad_msg_id, _bad_msg_seqno, _error_code, _new_server_salt));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPbadMsgNotification &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_bad_msg_notification: visitor(*(const MTPDbad_msg_notification*)value.data); return true;
+	case mtpc_bad_server_salt: visitor(*(const MTPDbad_server_salt*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPmsgsStateReq::MTPmsgsStateReq() : mtpDataOwner(new MTPDmsgs_state_req()) {
 }
@@ -16402,11 +16564,11 @@ inline MTPmsgsAllInfo MTP_msgs_all_info(const MTPVector<MTPlong> &_msg_ids, cons
 inline uint32 MTPmsgDetailedInfo::innerLength() const {
 	switch (_type) {
 		case mtpc_msg_detailed_info: {
-			const MTPDmsg_detailed_info &v(c_msg_detailed_info());
+			const MTPDmsg_detailed_info &v(*(const MTPDmsg_detailed_info*)data);
 			return v.vmsg_id.innerLength() + v.vanswer_msg_id.innerLength() + v.vbytes.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_msg_new_detailed_info: {
-			const MTPDmsg_new_detailed_info &v(c_msg_new_detailed_info());
+			const MTPDmsg_new_detailed_info &v(*(const MTPDmsg_new_detailed_info*)data);
 			return v.vanswer_msg_id.innerLength() + v.vbytes.innerLength() + v.vstatus.innerLength();
 		}
 	}
@@ -16421,7 +16583,8 @@ inline void MTPmsgDetailedInfo::read(const mtpPrime *&from, const mtpPrime *end,
 	switch (cons) {
 		case mtpc_msg_detailed_info: _type = cons; {
 			if (!data) setData(new MTPDmsg_detailed_info());
-			MTPDmsg_detailed_info &v(_msg_detailed_info());
+			split();
+			MTPDmsg_detailed_info &v(*(MTPDmsg_detailed_info*)data);
 			v.vmsg_id.read(from, end);
 			v.vanswer_msg_id.read(from, end);
 			v.vbytes.read(from, end);
@@ -16429,7 +16592,8 @@ inline void MTPmsgDetailedInfo::read(const mtpPrime *&from, const mtpPrime *end,
 		} break;
 		case mtpc_msg_new_detailed_info: _type = cons; {
 			if (!data) setData(new MTPDmsg_new_detailed_info());
-			MTPDmsg_new_detailed_info &v(_msg_new_detailed_info());
+			split();
+			MTPDmsg_new_detailed_info &v(*(MTPDmsg_new_detailed_info*)data);
 			v.vanswer_msg_id.read(from, end);
 			v.vbytes.read(from, end);
 			v.vstatus.read(from, end);
@@ -16440,14 +16604,14 @@ inline void MTPmsgDetailedInfo::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPmsgDetailedInfo::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_msg_detailed_info: {
-			const MTPDmsg_detailed_info &v(c_msg_detailed_info());
+			const MTPDmsg_detailed_info &v(*(const MTPDmsg_detailed_info*)data);
 			v.vmsg_id.write(to);
 			v.vanswer_msg_id.write(to);
 			v.vbytes.write(to);
 			v.vstatus.write(to);
 		} break;
 		case mtpc_msg_new_detailed_info: {
-			const MTPDmsg_new_detailed_info &v(c_msg_new_detailed_info());
+			const MTPDmsg_new_detailed_info &v(*(const MTPDmsg_new_detailed_info*)data);
 			v.vanswer_msg_id.write(to);
 			v.vbytes.write(to);
 			v.vstatus.write(to);
@@ -16471,6 +16635,14 @@ inline MTPmsgDetailedInfo MTP_msg_detailed_info(const MTPlong &_msg_id, const MT
 inline MTPmsgDetailedInfo MTP_msg_new_detailed_info(const MTPlong &_answer_msg_id, MTPint _bytes, MTPint _status) {
 	return MTPmsgDetailedInfo(new MTPDmsg_new_detailed_info(_answer_msg_id, _bytes, _status));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmsgDetailedInfo &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_msg_detailed_info: visitor(*(const MTPDmsg_detailed_info*)value.data); return true;
+	case mtpc_msg_new_detailed_info: visitor(*(const MTPDmsg_new_detailed_info*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPmsgResendReq::MTPmsgResendReq() : mtpDataOwner(new MTPDmsg_resend_req()) {
 }
@@ -16531,7 +16703,7 @@ inline MTPrpcError MTP_rpc_error(MTPint _error_code, const MTPstring &_error_mes
 inline uint32 MTPrpcDropAnswer::innerLength() const {
 	switch (_type) {
 		case mtpc_rpc_answer_dropped: {
-			const MTPDrpc_answer_dropped &v(c_rpc_answer_dropped());
+			const MTPDrpc_answer_dropped &v(*(const MTPDrpc_answer_dropped*)data);
 			return v.vmsg_id.innerLength() + v.vseq_no.innerLength() + v.vbytes.innerLength();
 		}
 	}
@@ -16548,7 +16720,8 @@ inline void MTPrpcDropAnswer::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_rpc_answer_dropped_running: _type = cons; break;
 		case mtpc_rpc_answer_dropped: _type = cons; {
 			if (!data) setData(new MTPDrpc_answer_dropped());
-			MTPDrpc_answer_dropped &v(_rpc_answer_dropped());
+			split();
+			MTPDrpc_answer_dropped &v(*(MTPDrpc_answer_dropped*)data);
 			v.vmsg_id.read(from, end);
 			v.vseq_no.read(from, end);
 			v.vbytes.read(from, end);
@@ -16559,7 +16732,7 @@ inline void MTPrpcDropAnswer::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPrpcDropAnswer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_rpc_answer_dropped: {
-			const MTPDrpc_answer_dropped &v(c_rpc_answer_dropped());
+			const MTPDrpc_answer_dropped &v(*(const MTPDrpc_answer_dropped*)data);
 			v.vmsg_id.write(to);
 			v.vseq_no.write(to);
 			v.vbytes.write(to);
@@ -16585,6 +16758,13 @@ inline MTPrpcDropAnswer MTP_rpc_answer_dropped_running() {
 inline MTPrpcDropAnswer MTP_rpc_answer_dropped(const MTPlong &_msg_id, MTPint _seq_no, MTPint _bytes) {
 	return MTPrpcDropAnswer(new MTPDrpc_answer_dropped(_msg_id, _seq_no, _bytes));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPrpcDropAnswer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_rpc_answer_dropped: visitor(*(const MTPDrpc_answer_dropped*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPfutureSalt::MTPfutureSalt() : mtpDataOwner(new MTPDfuture_salt()) {
 }
@@ -16680,11 +16860,11 @@ inline MTPpong MTP_pong(const MTPlong &_msg_id, const MTPlong &_ping_id) {
 inline uint32 MTPdestroySessionRes::innerLength() const {
 	switch (_type) {
 		case mtpc_destroy_session_ok: {
-			const MTPDdestroy_session_ok &v(c_destroy_session_ok());
+			const MTPDdestroy_session_ok &v(*(const MTPDdestroy_session_ok*)data);
 			return v.vsession_id.innerLength();
 		}
 		case mtpc_destroy_session_none: {
-			const MTPDdestroy_session_none &v(c_destroy_session_none());
+			const MTPDdestroy_session_none &v(*(const MTPDdestroy_session_none*)data);
 			return v.vsession_id.innerLength();
 		}
 	}
@@ -16699,12 +16879,14 @@ inline void MTPdestroySessionRes::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_destroy_session_ok: _type = cons; {
 			if (!data) setData(new MTPDdestroy_session_ok());
-			MTPDdestroy_session_ok &v(_destroy_session_ok());
+			split();
+			MTPDdestroy_session_ok &v(*(MTPDdestroy_session_ok*)data);
 			v.vsession_id.read(from, end);
 		} break;
 		case mtpc_destroy_session_none: _type = cons; {
 			if (!data) setData(new MTPDdestroy_session_none());
-			MTPDdestroy_session_none &v(_destroy_session_none());
+			split();
+			MTPDdestroy_session_none &v(*(MTPDdestroy_session_none*)data);
 			v.vsession_id.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPdestroySessionRes");
@@ -16713,11 +16895,11 @@ inline void MTPdestroySessionRes::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPdestroySessionRes::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_destroy_session_ok: {
-			const MTPDdestroy_session_ok &v(c_destroy_session_ok());
+			const MTPDdestroy_session_ok &v(*(const MTPDdestroy_session_ok*)data);
 			v.vsession_id.write(to);
 		} break;
 		case mtpc_destroy_session_none: {
-			const MTPDdestroy_session_none &v(c_destroy_session_none());
+			const MTPDdestroy_session_none &v(*(const MTPDdestroy_session_none*)data);
 			v.vsession_id.write(to);
 		} break;
 	}
@@ -16739,6 +16921,14 @@ inline MTPdestroySessionRes MTP_destroy_session_ok(const MTPlong &_session_id) {
 inline MTPdestroySessionRes MTP_destroy_session_none(const MTPlong &_session_id) {
 	return MTPdestroySessionRes(new MTPDdestroy_session_none(_session_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPdestroySessionRes &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_destroy_session_ok: visitor(*(const MTPDdestroy_session_ok*)value.data); return true;
+	case mtpc_destroy_session_none: visitor(*(const MTPDdestroy_session_none*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPnewSession::MTPnewSession() : mtpDataOwner(new MTPDnew_session_created()) {
 }
@@ -16848,15 +17038,15 @@ inline MTPnull MTP_null() {
 inline uint32 MTPinputPeer::innerLength() const {
 	switch (_type) {
 		case mtpc_inputPeerContact: {
-			const MTPDinputPeerContact &v(c_inputPeerContact());
+			const MTPDinputPeerContact &v(*(const MTPDinputPeerContact*)data);
 			return v.vuser_id.innerLength();
 		}
 		case mtpc_inputPeerForeign: {
-			const MTPDinputPeerForeign &v(c_inputPeerForeign());
+			const MTPDinputPeerForeign &v(*(const MTPDinputPeerForeign*)data);
 			return v.vuser_id.innerLength() + v.vaccess_hash.innerLength();
 		}
 		case mtpc_inputPeerChat: {
-			const MTPDinputPeerChat &v(c_inputPeerChat());
+			const MTPDinputPeerChat &v(*(const MTPDinputPeerChat*)data);
 			return v.vchat_id.innerLength();
 		}
 	}
@@ -16873,18 +17063,21 @@ inline void MTPinputPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		case mtpc_inputPeerSelf: _type = cons; break;
 		case mtpc_inputPeerContact: _type = cons; {
 			if (!data) setData(new MTPDinputPeerContact());
-			MTPDinputPeerContact &v(_inputPeerContact());
+			split();
+			MTPDinputPeerContact &v(*(MTPDinputPeerContact*)data);
 			v.vuser_id.read(from, end);
 		} break;
 		case mtpc_inputPeerForeign: _type = cons; {
 			if (!data) setData(new MTPDinputPeerForeign());
-			MTPDinputPeerForeign &v(_inputPeerForeign());
+			split();
+			MTPDinputPeerForeign &v(*(MTPDinputPeerForeign*)data);
 			v.vuser_id.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
 		case mtpc_inputPeerChat: _type = cons; {
 			if (!data) setData(new MTPDinputPeerChat());
-			MTPDinputPeerChat &v(_inputPeerChat());
+			split();
+			MTPDinputPeerChat &v(*(MTPDinputPeerChat*)data);
 			v.vchat_id.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPinputPeer");
@@ -16893,16 +17086,16 @@ inline void MTPinputPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPinputPeer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputPeerContact: {
-			const MTPDinputPeerContact &v(c_inputPeerContact());
+			const MTPDinputPeerContact &v(*(const MTPDinputPeerContact*)data);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_inputPeerForeign: {
-			const MTPDinputPeerForeign &v(c_inputPeerForeign());
+			const MTPDinputPeerForeign &v(*(const MTPDinputPeerForeign*)data);
 			v.vuser_id.write(to);
 			v.vaccess_hash.write(to);
 		} break;
 		case mtpc_inputPeerChat: {
-			const MTPDinputPeerChat &v(c_inputPeerChat());
+			const MTPDinputPeerChat &v(*(const MTPDinputPeerChat*)data);
 			v.vchat_id.write(to);
 		} break;
 	}
@@ -16938,15 +17131,24 @@ inline MTPinputPeer MTP_inputPeerForeign(MTPint _user_id, const MTPlong &_access
 inline MTPinputPeer MTP_inputPeerChat(MTPint _chat_id) {
 	return MTPinputPeer(new MTPDinputPeerChat(_chat_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputPeer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputPeerContact: visitor(*(const MTPDinputPeerContact*)value.data); return true;
+	case mtpc_inputPeerForeign: visitor(*(const MTPDinputPeerForeign*)value.data); return true;
+	case mtpc_inputPeerChat: visitor(*(const MTPDinputPeerChat*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputUser::innerLength() const {
 	switch (_type) {
 		case mtpc_inputUserContact: {
-			const MTPDinputUserContact &v(c_inputUserContact());
+			const MTPDinputUserContact &v(*(const MTPDinputUserContact*)data);
 			return v.vuser_id.innerLength();
 		}
 		case mtpc_inputUserForeign: {
-			const MTPDinputUserForeign &v(c_inputUserForeign());
+			const MTPDinputUserForeign &v(*(const MTPDinputUserForeign*)data);
 			return v.vuser_id.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -16963,12 +17165,14 @@ inline void MTPinputUser::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		case mtpc_inputUserSelf: _type = cons; break;
 		case mtpc_inputUserContact: _type = cons; {
 			if (!data) setData(new MTPDinputUserContact());
-			MTPDinputUserContact &v(_inputUserContact());
+			split();
+			MTPDinputUserContact &v(*(MTPDinputUserContact*)data);
 			v.vuser_id.read(from, end);
 		} break;
 		case mtpc_inputUserForeign: _type = cons; {
 			if (!data) setData(new MTPDinputUserForeign());
-			MTPDinputUserForeign &v(_inputUserForeign());
+			split();
+			MTPDinputUserForeign &v(*(MTPDinputUserForeign*)data);
 			v.vuser_id.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -16978,11 +17182,11 @@ inline void MTPinputUser::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPinputUser::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputUserContact: {
-			const MTPDinputUserContact &v(c_inputUserContact());
+			const MTPDinputUserContact &v(*(const MTPDinputUserContact*)data);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_inputUserForeign: {
-			const MTPDinputUserForeign &v(c_inputUserForeign());
+			const MTPDinputUserForeign &v(*(const MTPDinputUserForeign*)data);
 			v.vuser_id.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -17013,6 +17217,14 @@ inline MTPinputUser MTP_inputUserContact(MTPint _user_id) {
 inline MTPinputUser MTP_inputUserForeign(MTPint _user_id, const MTPlong &_access_hash) {
 	return MTPinputUser(new MTPDinputUserForeign(_user_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputUser &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputUserContact: visitor(*(const MTPDinputUserContact*)value.data); return true;
+	case mtpc_inputUserForeign: visitor(*(const MTPDinputUserForeign*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPinputContact::MTPinputContact() : mtpDataOwner(new MTPDinputPhoneContact()) {
 }
@@ -17050,11 +17262,11 @@ inline MTPinputContact MTP_inputPhoneContact(const MTPlong &_client_id, const MT
 inline uint32 MTPinputFile::innerLength() const {
 	switch (_type) {
 		case mtpc_inputFile: {
-			const MTPDinputFile &v(c_inputFile());
+			const MTPDinputFile &v(*(const MTPDinputFile*)data);
 			return v.vid.innerLength() + v.vparts.innerLength() + v.vname.innerLength() + v.vmd5_checksum.innerLength();
 		}
 		case mtpc_inputFileBig: {
-			const MTPDinputFileBig &v(c_inputFileBig());
+			const MTPDinputFileBig &v(*(const MTPDinputFileBig*)data);
 			return v.vid.innerLength() + v.vparts.innerLength() + v.vname.innerLength();
 		}
 	}
@@ -17069,7 +17281,8 @@ inline void MTPinputFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 	switch (cons) {
 		case mtpc_inputFile: _type = cons; {
 			if (!data) setData(new MTPDinputFile());
-			MTPDinputFile &v(_inputFile());
+			split();
+			MTPDinputFile &v(*(MTPDinputFile*)data);
 			v.vid.read(from, end);
 			v.vparts.read(from, end);
 			v.vname.read(from, end);
@@ -17077,7 +17290,8 @@ inline void MTPinputFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		} break;
 		case mtpc_inputFileBig: _type = cons; {
 			if (!data) setData(new MTPDinputFileBig());
-			MTPDinputFileBig &v(_inputFileBig());
+			split();
+			MTPDinputFileBig &v(*(MTPDinputFileBig*)data);
 			v.vid.read(from, end);
 			v.vparts.read(from, end);
 			v.vname.read(from, end);
@@ -17088,14 +17302,14 @@ inline void MTPinputFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPinputFile::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputFile: {
-			const MTPDinputFile &v(c_inputFile());
+			const MTPDinputFile &v(*(const MTPDinputFile*)data);
 			v.vid.write(to);
 			v.vparts.write(to);
 			v.vname.write(to);
 			v.vmd5_checksum.write(to);
 		} break;
 		case mtpc_inputFileBig: {
-			const MTPDinputFileBig &v(c_inputFileBig());
+			const MTPDinputFileBig &v(*(const MTPDinputFileBig*)data);
 			v.vid.write(to);
 			v.vparts.write(to);
 			v.vname.write(to);
@@ -17119,55 +17333,63 @@ inline MTPinputFile MTP_inputFile(const MTPlong &_id, MTPint _parts, const MTPst
 inline MTPinputFile MTP_inputFileBig(const MTPlong &_id, MTPint _parts, const MTPstring &_name) {
 	return MTPinputFile(new MTPDinputFileBig(_id, _parts, _name));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputFile &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputFile: visitor(*(const MTPDinputFile*)value.data); return true;
+	case mtpc_inputFileBig: visitor(*(const MTPDinputFileBig*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputMedia::innerLength() const {
 	switch (_type) {
 		case mtpc_inputMediaUploadedPhoto: {
-			const MTPDinputMediaUploadedPhoto &v(c_inputMediaUploadedPhoto());
+			const MTPDinputMediaUploadedPhoto &v(*(const MTPDinputMediaUploadedPhoto*)data);
 			return v.vfile.innerLength();
 		}
 		case mtpc_inputMediaPhoto: {
-			const MTPDinputMediaPhoto &v(c_inputMediaPhoto());
+			const MTPDinputMediaPhoto &v(*(const MTPDinputMediaPhoto*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_inputMediaGeoPoint: {
-			const MTPDinputMediaGeoPoint &v(c_inputMediaGeoPoint());
+			const MTPDinputMediaGeoPoint &v(*(const MTPDinputMediaGeoPoint*)data);
 			return v.vgeo_point.innerLength();
 		}
 		case mtpc_inputMediaContact: {
-			const MTPDinputMediaContact &v(c_inputMediaContact());
+			const MTPDinputMediaContact &v(*(const MTPDinputMediaContact*)data);
 			return v.vphone_number.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength();
 		}
 		case mtpc_inputMediaUploadedVideo: {
-			const MTPDinputMediaUploadedVideo &v(c_inputMediaUploadedVideo());
+			const MTPDinputMediaUploadedVideo &v(*(const MTPDinputMediaUploadedVideo*)data);
 			return v.vfile.innerLength() + v.vduration.innerLength() + v.vw.innerLength() + v.vh.innerLength() + v.vmime_type.innerLength();
 		}
 		case mtpc_inputMediaUploadedThumbVideo: {
-			const MTPDinputMediaUploadedThumbVideo &v(c_inputMediaUploadedThumbVideo());
+			const MTPDinputMediaUploadedThumbVideo &v(*(const MTPDinputMediaUploadedThumbVideo*)data);
 			return v.vfile.innerLength() + v.vthumb.innerLength() + v.vduration.innerLength() + v.vw.innerLength() + v.vh.innerLength() + v.vmime_type.innerLength();
 		}
 		case mtpc_inputMediaVideo: {
-			const MTPDinputMediaVideo &v(c_inputMediaVideo());
+			const MTPDinputMediaVideo &v(*(const MTPDinputMediaVideo*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_inputMediaUploadedAudio: {
-			const MTPDinputMediaUploadedAudio &v(c_inputMediaUploadedAudio());
+			const MTPDinputMediaUploadedAudio &v(*(const MTPDinputMediaUploadedAudio*)data);
 			return v.vfile.innerLength() + v.vduration.innerLength() + v.vmime_type.innerLength();
 		}
 		case mtpc_inputMediaAudio: {
-			const MTPDinputMediaAudio &v(c_inputMediaAudio());
+			const MTPDinputMediaAudio &v(*(const MTPDinputMediaAudio*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_inputMediaUploadedDocument: {
-			const MTPDinputMediaUploadedDocument &v(c_inputMediaUploadedDocument());
+			const MTPDinputMediaUploadedDocument &v(*(const MTPDinputMediaUploadedDocument*)data);
 			return v.vfile.innerLength() + v.vmime_type.innerLength() + v.vattributes.innerLength();
 		}
 		case mtpc_inputMediaUploadedThumbDocument: {
-			const MTPDinputMediaUploadedThumbDocument &v(c_inputMediaUploadedThumbDocument());
+			const MTPDinputMediaUploadedThumbDocument &v(*(const MTPDinputMediaUploadedThumbDocument*)data);
 			return v.vfile.innerLength() + v.vthumb.innerLength() + v.vmime_type.innerLength() + v.vattributes.innerLength();
 		}
 		case mtpc_inputMediaDocument: {
-			const MTPDinputMediaDocument &v(c_inputMediaDocument());
+			const MTPDinputMediaDocument &v(*(const MTPDinputMediaDocument*)data);
 			return v.vid.innerLength();
 		}
 	}
@@ -17183,29 +17405,34 @@ inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		case mtpc_inputMediaEmpty: _type = cons; break;
 		case mtpc_inputMediaUploadedPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedPhoto());
-			MTPDinputMediaUploadedPhoto &v(_inputMediaUploadedPhoto());
+			split();
+			MTPDinputMediaUploadedPhoto &v(*(MTPDinputMediaUploadedPhoto*)data);
 			v.vfile.read(from, end);
 		} break;
 		case mtpc_inputMediaPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputMediaPhoto());
-			MTPDinputMediaPhoto &v(_inputMediaPhoto());
+			split();
+			MTPDinputMediaPhoto &v(*(MTPDinputMediaPhoto*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_inputMediaGeoPoint: _type = cons; {
 			if (!data) setData(new MTPDinputMediaGeoPoint());
-			MTPDinputMediaGeoPoint &v(_inputMediaGeoPoint());
+			split();
+			MTPDinputMediaGeoPoint &v(*(MTPDinputMediaGeoPoint*)data);
 			v.vgeo_point.read(from, end);
 		} break;
 		case mtpc_inputMediaContact: _type = cons; {
 			if (!data) setData(new MTPDinputMediaContact());
-			MTPDinputMediaContact &v(_inputMediaContact());
+			split();
+			MTPDinputMediaContact &v(*(MTPDinputMediaContact*)data);
 			v.vphone_number.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
 		} break;
 		case mtpc_inputMediaUploadedVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedVideo());
-			MTPDinputMediaUploadedVideo &v(_inputMediaUploadedVideo());
+			split();
+			MTPDinputMediaUploadedVideo &v(*(MTPDinputMediaUploadedVideo*)data);
 			v.vfile.read(from, end);
 			v.vduration.read(from, end);
 			v.vw.read(from, end);
@@ -17214,7 +17441,8 @@ inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		} break;
 		case mtpc_inputMediaUploadedThumbVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedThumbVideo());
-			MTPDinputMediaUploadedThumbVideo &v(_inputMediaUploadedThumbVideo());
+			split();
+			MTPDinputMediaUploadedThumbVideo &v(*(MTPDinputMediaUploadedThumbVideo*)data);
 			v.vfile.read(from, end);
 			v.vthumb.read(from, end);
 			v.vduration.read(from, end);
@@ -17224,31 +17452,36 @@ inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		} break;
 		case mtpc_inputMediaVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaVideo());
-			MTPDinputMediaVideo &v(_inputMediaVideo());
+			split();
+			MTPDinputMediaVideo &v(*(MTPDinputMediaVideo*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_inputMediaUploadedAudio: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedAudio());
-			MTPDinputMediaUploadedAudio &v(_inputMediaUploadedAudio());
+			split();
+			MTPDinputMediaUploadedAudio &v(*(MTPDinputMediaUploadedAudio*)data);
 			v.vfile.read(from, end);
 			v.vduration.read(from, end);
 			v.vmime_type.read(from, end);
 		} break;
 		case mtpc_inputMediaAudio: _type = cons; {
 			if (!data) setData(new MTPDinputMediaAudio());
-			MTPDinputMediaAudio &v(_inputMediaAudio());
+			split();
+			MTPDinputMediaAudio &v(*(MTPDinputMediaAudio*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_inputMediaUploadedDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedDocument());
-			MTPDinputMediaUploadedDocument &v(_inputMediaUploadedDocument());
+			split();
+			MTPDinputMediaUploadedDocument &v(*(MTPDinputMediaUploadedDocument*)data);
 			v.vfile.read(from, end);
 			v.vmime_type.read(from, end);
 			v.vattributes.read(from, end);
 		} break;
 		case mtpc_inputMediaUploadedThumbDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedThumbDocument());
-			MTPDinputMediaUploadedThumbDocument &v(_inputMediaUploadedThumbDocument());
+			split();
+			MTPDinputMediaUploadedThumbDocument &v(*(MTPDinputMediaUploadedThumbDocument*)data);
 			v.vfile.read(from, end);
 			v.vthumb.read(from, end);
 			v.vmime_type.read(from, end);
@@ -17256,7 +17489,8 @@ inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		} break;
 		case mtpc_inputMediaDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaDocument());
-			MTPDinputMediaDocument &v(_inputMediaDocument());
+			split();
+			MTPDinputMediaDocument &v(*(MTPDinputMediaDocument*)data);
 			v.vid.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPinputMedia");
@@ -17265,25 +17499,25 @@ inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPinputMedia::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputMediaUploadedPhoto: {
-			const MTPDinputMediaUploadedPhoto &v(c_inputMediaUploadedPhoto());
+			const MTPDinputMediaUploadedPhoto &v(*(const MTPDinputMediaUploadedPhoto*)data);
 			v.vfile.write(to);
 		} break;
 		case mtpc_inputMediaPhoto: {
-			const MTPDinputMediaPhoto &v(c_inputMediaPhoto());
+			const MTPDinputMediaPhoto &v(*(const MTPDinputMediaPhoto*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_inputMediaGeoPoint: {
-			const MTPDinputMediaGeoPoint &v(c_inputMediaGeoPoint());
+			const MTPDinputMediaGeoPoint &v(*(const MTPDinputMediaGeoPoint*)data);
 			v.vgeo_point.write(to);
 		} break;
 		case mtpc_inputMediaContact: {
-			const MTPDinputMediaContact &v(c_inputMediaContact());
+			const MTPDinputMediaContact &v(*(const MTPDinputMediaContact*)data);
 			v.vphone_number.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
 		} break;
 		case mtpc_inputMediaUploadedVideo: {
-			const MTPDinputMediaUploadedVideo &v(c_inputMediaUploadedVideo());
+			const MTPDinputMediaUploadedVideo &v(*(const MTPDinputMediaUploadedVideo*)data);
 			v.vfile.write(to);
 			v.vduration.write(to);
 			v.vw.write(to);
@@ -17291,7 +17525,7 @@ inline void MTPinputMedia::write(mtpBuffer &to) const {
 			v.vmime_type.write(to);
 		} break;
 		case mtpc_inputMediaUploadedThumbVideo: {
-			const MTPDinputMediaUploadedThumbVideo &v(c_inputMediaUploadedThumbVideo());
+			const MTPDinputMediaUploadedThumbVideo &v(*(const MTPDinputMediaUploadedThumbVideo*)data);
 			v.vfile.write(to);
 			v.vthumb.write(to);
 			v.vduration.write(to);
@@ -17300,34 +17534,34 @@ inline void MTPinputMedia::write(mtpBuffer &to) const {
 			v.vmime_type.write(to);
 		} break;
 		case mtpc_inputMediaVideo: {
-			const MTPDinputMediaVideo &v(c_inputMediaVideo());
+			const MTPDinputMediaVideo &v(*(const MTPDinputMediaVideo*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_inputMediaUploadedAudio: {
-			const MTPDinputMediaUploadedAudio &v(c_inputMediaUploadedAudio());
+			const MTPDinputMediaUploadedAudio &v(*(const MTPDinputMediaUploadedAudio*)data);
 			v.vfile.write(to);
 			v.vduration.write(to);
 			v.vmime_type.write(to);
 		} break;
 		case mtpc_inputMediaAudio: {
-			const MTPDinputMediaAudio &v(c_inputMediaAudio());
+			const MTPDinputMediaAudio &v(*(const MTPDinputMediaAudio*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_inputMediaUploadedDocument: {
-			const MTPDinputMediaUploadedDocument &v(c_inputMediaUploadedDocument());
+			const MTPDinputMediaUploadedDocument &v(*(const MTPDinputMediaUploadedDocument*)data);
 			v.vfile.write(to);
 			v.vmime_type.write(to);
 			v.vattributes.write(to);
 		} break;
 		case mtpc_inputMediaUploadedThumbDocument: {
-			const MTPDinputMediaUploadedThumbDocument &v(c_inputMediaUploadedThumbDocument());
+			const MTPDinputMediaUploadedThumbDocument &v(*(const MTPDinputMediaUploadedThumbDocument*)data);
 			v.vfile.write(to);
 			v.vthumb.write(to);
 			v.vmime_type.write(to);
 			v.vattributes.write(to);
 		} break;
 		case mtpc_inputMediaDocument: {
-			const MTPDinputMediaDocument &v(c_inputMediaDocument());
+			const MTPDinputMediaDocument &v(*(const MTPDinputMediaDocument*)data);
 			v.vid.write(to);
 		} break;
 	}
@@ -17413,15 +17647,33 @@ inline MTPinputMedia MTP_inputMediaUploadedThumbDocument(const MTPInputFile &_fi
 inline MTPinputMedia MTP_inputMediaDocument(const MTPInputDocument &_id) {
 	return MTPinputMedia(new MTPDinputMediaDocument(_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputMedia &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputMediaUploadedPhoto: visitor(*(const MTPDinputMediaUploadedPhoto*)value.data); return true;
+	case mtpc_inputMediaPhoto: visitor(*(const MTPDinputMediaPhoto*)value.data); return true;
+	case mtpc_inputMediaGeoPoint: visitor(*(const MTPDinputMediaGeoPoint*)value.data); return true;
+	case mtpc_inputMediaContact: visitor(*(const MTPDinputMediaContact*)value.data); return true;
+	case mtpc_inputMediaUploadedVideo: visitor(*(const MTPDinputMediaUploadedVideo*)value.data); return true;
+	case mtpc_inputMediaUploadedThumbVideo: visitor(*(const MTPDinputMediaUploadedThumbVideo*)value.data); return true;
+	case mtpc_inputMediaVideo: visitor(*(const MTPDinputMediaVideo*)value.data); return true;
+	case mtpc_inputMediaUploadedAudio: visitor(*(const MTPDinputMediaUploadedAudio*)value.data); return true;
+	case mtpc_inputMediaAudio: visitor(*(const MTPDinputMediaAudio*)value.data); return true;
+	case mtpc_inputMediaUploadedDocument: visitor(*(const MTPDinputMediaUploadedDocument*)value.data); return true;
+	case mtpc_inputMediaUploadedThumbDocument: visitor(*(const MTPDinputMediaUploadedThumbDocument*)value.data); return true;
+	case mtpc_inputMediaDocument: visitor(*(const MTPDinputMediaDocument*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputChatPhoto::innerLength() const {
 	switch (_type) {
 		case mtpc_inputChatUploadedPhoto: {
-			const MTPDinputChatUploadedPhoto &v(c_inputChatUploadedPhoto());
+			const MTPDinputChatUploadedPhoto &v(*(const MTPDinputChatUploadedPhoto*)data);
 			return v.vfile.innerLength() + v.vcrop.innerLength();
 		}
 		case mtpc_inputChatPhoto: {
-			const MTPDinputChatPhoto &v(c_inputChatPhoto());
+			const MTPDinputChatPhoto &v(*(const MTPDinputChatPhoto*)data);
 			return v.vid.innerLength() + v.vcrop.innerLength();
 		}
 	}
@@ -17437,13 +17689,15 @@ inline void MTPinputChatPhoto::read(const mtpPrime *&from, const mtpPrime *end,
 		case mtpc_inputChatPhotoEmpty: _type = cons; break;
 		case mtpc_inputChatUploadedPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputChatUploadedPhoto());
-			MTPDinputChatUploadedPhoto &v(_inputChatUploadedPhoto());
+			split();
+			MTPDinputChatUploadedPhoto &v(*(MTPDinputChatUploadedPhoto*)data);
 			v.vfile.read(from, end);
 			v.vcrop.read(from, end);
 		} break;
 		case mtpc_inputChatPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputChatPhoto());
-			MTPDinputChatPhoto &v(_inputChatPhoto());
+			split();
+			MTPDinputChatPhoto &v(*(MTPDinputChatPhoto*)data);
 			v.vid.read(from, end);
 			v.vcrop.read(from, end);
 		} break;
@@ -17453,12 +17707,12 @@ inline void MTPinputChatPhoto::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPinputChatPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputChatUploadedPhoto: {
-			const MTPDinputChatUploadedPhoto &v(c_inputChatUploadedPhoto());
+			const MTPDinputChatUploadedPhoto &v(*(const MTPDinputChatUploadedPhoto*)data);
 			v.vfile.write(to);
 			v.vcrop.write(to);
 		} break;
 		case mtpc_inputChatPhoto: {
-			const MTPDinputChatPhoto &v(c_inputChatPhoto());
+			const MTPDinputChatPhoto &v(*(const MTPDinputChatPhoto*)data);
 			v.vid.write(to);
 			v.vcrop.write(to);
 		} break;
@@ -17485,11 +17739,19 @@ inline MTPinputChatPhoto MTP_inputChatUploadedPhoto(const MTPInputFile &_file, c
 inline MTPinputChatPhoto MTP_inputChatPhoto(const MTPInputPhoto &_id, const MTPInputPhotoCrop &_crop) {
 	return MTPinputChatPhoto(new MTPDinputChatPhoto(_id, _crop));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputChatPhoto &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputChatUploadedPhoto: visitor(*(const MTPDinputChatUploadedPhoto*)value.data); return true;
+	case mtpc_inputChatPhoto: visitor(*(const MTPDinputChatPhoto*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputGeoPoint::innerLength() const {
 	switch (_type) {
 		case mtpc_inputGeoPoint: {
-			const MTPDinputGeoPoint &v(c_inputGeoPoint());
+			const MTPDinputGeoPoint &v(*(const MTPDinputGeoPoint*)data);
 			return v.vlat.innerLength() + v.vlong.innerLength();
 		}
 	}
@@ -17505,7 +17767,8 @@ inline void MTPinputGeoPoint::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_inputGeoPointEmpty: _type = cons; break;
 		case mtpc_inputGeoPoint: _type = cons; {
 			if (!data) setData(new MTPDinputGeoPoint());
-			MTPDinputGeoPoint &v(_inputGeoPoint());
+			split();
+			MTPDinputGeoPoint &v(*(MTPDinputGeoPoint*)data);
 			v.vlat.read(from, end);
 			v.vlong.read(from, end);
 		} break;
@@ -17515,7 +17778,7 @@ inline void MTPinputGeoPoint::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPinputGeoPoint::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputGeoPoint: {
-			const MTPDinputGeoPoint &v(c_inputGeoPoint());
+			const MTPDinputGeoPoint &v(*(const MTPDinputGeoPoint*)data);
 			v.vlat.write(to);
 			v.vlong.write(to);
 		} break;
@@ -17536,11 +17799,18 @@ inline MTPinputGeoPoint MTP_inputGeoPointEmpty() {
 inline MTPinputGeoPoint MTP_inputGeoPoint(const MTPdouble &_lat, const MTPdouble &_long) {
 	return MTPinputGeoPoint(new MTPDinputGeoPoint(_lat, _long));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputGeoPoint &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputGeoPoint: visitor(*(const MTPDinputGeoPoint*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputPhoto::innerLength() const {
 	switch (_type) {
 		case mtpc_inputPhoto: {
-			const MTPDinputPhoto &v(c_inputPhoto());
+			const MTPDinputPhoto &v(*(const MTPDinputPhoto*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -17556,7 +17826,8 @@ inline void MTPinputPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		case mtpc_inputPhotoEmpty: _type = cons; break;
 		case mtpc_inputPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputPhoto());
-			MTPDinputPhoto &v(_inputPhoto());
+			split();
+			MTPDinputPhoto &v(*(MTPDinputPhoto*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -17566,7 +17837,7 @@ inline void MTPinputPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPinputPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputPhoto: {
-			const MTPDinputPhoto &v(c_inputPhoto());
+			const MTPDinputPhoto &v(*(const MTPDinputPhoto*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -17587,11 +17858,18 @@ inline MTPinputPhoto MTP_inputPhotoEmpty() {
 inline MTPinputPhoto MTP_inputPhoto(const MTPlong &_id, const MTPlong &_access_hash) {
 	return MTPinputPhoto(new MTPDinputPhoto(_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputPhoto &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputPhoto: visitor(*(const MTPDinputPhoto*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputVideo::innerLength() const {
 	switch (_type) {
 		case mtpc_inputVideo: {
-			const MTPDinputVideo &v(c_inputVideo());
+			const MTPDinputVideo &v(*(const MTPDinputVideo*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -17607,7 +17885,8 @@ inline void MTPinputVideo::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		case mtpc_inputVideoEmpty: _type = cons; break;
 		case mtpc_inputVideo: _type = cons; {
 			if (!data) setData(new MTPDinputVideo());
-			MTPDinputVideo &v(_inputVideo());
+			split();
+			MTPDinputVideo &v(*(MTPDinputVideo*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -17617,7 +17896,7 @@ inline void MTPinputVideo::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPinputVideo::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputVideo: {
-			const MTPDinputVideo &v(c_inputVideo());
+			const MTPDinputVideo &v(*(const MTPDinputVideo*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -17638,27 +17917,34 @@ inline MTPinputVideo MTP_inputVideoEmpty() {
 inline MTPinputVideo MTP_inputVideo(const MTPlong &_id, const MTPlong &_access_hash) {
 	return MTPinputVideo(new MTPDinputVideo(_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputVideo &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputVideo: visitor(*(const MTPDinputVideo*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputFileLocation::innerLength() const {
 	switch (_type) {
 		case mtpc_inputFileLocation: {
-			const MTPDinputFileLocation &v(c_inputFileLocation());
+			const MTPDinputFileLocation &v(*(const MTPDinputFileLocation*)data);
 			return v.vvolume_id.innerLength() + v.vlocal_id.innerLength() + v.vsecret.innerLength();
 		}
 		case mtpc_inputVideoFileLocation: {
-			const MTPDinputVideoFileLocation &v(c_inputVideoFileLocation());
+			const MTPDinputVideoFileLocation &v(*(const MTPDinputVideoFileLocation*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 		case mtpc_inputEncryptedFileLocation: {
-			const MTPDinputEncryptedFileLocation &v(c_inputEncryptedFileLocation());
+			const MTPDinputEncryptedFileLocation &v(*(const MTPDinputEncryptedFileLocation*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 		case mtpc_inputAudioFileLocation: {
-			const MTPDinputAudioFileLocation &v(c_inputAudioFileLocation());
+			const MTPDinputAudioFileLocation &v(*(const MTPDinputAudioFileLocation*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 		case mtpc_inputDocumentFileLocation: {
-			const MTPDinputDocumentFileLocation &v(c_inputDocumentFileLocation());
+			const MTPDinputDocumentFileLocation &v(*(const MTPDinputDocumentFileLocation*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -17673,32 +17959,37 @@ inline void MTPinputFileLocation::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_inputFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputFileLocation());
-			MTPDinputFileLocation &v(_inputFileLocation());
+			split();
+			MTPDinputFileLocation &v(*(MTPDinputFileLocation*)data);
 			v.vvolume_id.read(from, end);
 			v.vlocal_id.read(from, end);
 			v.vsecret.read(from, end);
 		} break;
 		case mtpc_inputVideoFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputVideoFileLocation());
-			MTPDinputVideoFileLocation &v(_inputVideoFileLocation());
+			split();
+			MTPDinputVideoFileLocation &v(*(MTPDinputVideoFileLocation*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
 		case mtpc_inputEncryptedFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileLocation());
-			MTPDinputEncryptedFileLocation &v(_inputEncryptedFileLocation());
+			split();
+			MTPDinputEncryptedFileLocation &v(*(MTPDinputEncryptedFileLocation*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
 		case mtpc_inputAudioFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputAudioFileLocation());
-			MTPDinputAudioFileLocation &v(_inputAudioFileLocation());
+			split();
+			MTPDinputAudioFileLocation &v(*(MTPDinputAudioFileLocation*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
 		case mtpc_inputDocumentFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputDocumentFileLocation());
-			MTPDinputDocumentFileLocation &v(_inputDocumentFileLocation());
+			split();
+			MTPDinputDocumentFileLocation &v(*(MTPDinputDocumentFileLocation*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -17708,28 +17999,28 @@ inline void MTPinputFileLocation::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPinputFileLocation::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputFileLocation: {
-			const MTPDinputFileLocation &v(c_inputFileLocation());
+			const MTPDinputFileLocation &v(*(const MTPDinputFileLocation*)data);
 			v.vvolume_id.write(to);
 			v.vlocal_id.write(to);
 			v.vsecret.write(to);
 		} break;
 		case mtpc_inputVideoFileLocation: {
-			const MTPDinputVideoFileLocation &v(c_inputVideoFileLocation());
+			const MTPDinputVideoFileLocation &v(*(const MTPDinputVideoFileLocation*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
 		case mtpc_inputEncryptedFileLocation: {
-			const MTPDinputEncryptedFileLocation &v(c_inputEncryptedFileLocation());
+			const MTPDinputEncryptedFileLocation &v(*(const MTPDinputEncryptedFileLocation*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
 		case mtpc_inputAudioFileLocation: {
-			const MTPDinputAudioFileLocation &v(c_inputAudioFileLocation());
+			const MTPDinputAudioFileLocation &v(*(const MTPDinputAudioFileLocation*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
 		case mtpc_inputDocumentFileLocation: {
-			const MTPDinputDocumentFileLocation &v(c_inputDocumentFileLocation());
+			const MTPDinputDocumentFileLocation &v(*(const MTPDinputDocumentFileLocation*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -17770,11 +18061,22 @@ inline MTPinputFileLocation MTP_inputAudioFileLocation(const MTPlong &_id, const
 inline MTPinputFileLocation MTP_inputDocumentFileLocation(const MTPlong &_id, const MTPlong &_access_hash) {
 	return MTPinputFileLocation(new MTPDinputDocumentFileLocation(_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputFileLocation &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputFileLocation: visitor(*(const MTPDinputFileLocation*)value.data); return true;
+	case mtpc_inputVideoFileLocation: visitor(*(const MTPDinputVideoFileLocation*)value.data); return true;
+	case mtpc_inputEncryptedFileLocation: visitor(*(const MTPDinputEncryptedFileLocation*)value.data); return true;
+	case mtpc_inputAudioFileLocation: visitor(*(const MTPDinputAudioFileLocation*)value.data); return true;
+	case mtpc_inputDocumentFileLocation: visitor(*(const MTPDinputDocumentFileLocation*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputPhotoCrop::innerLength() const {
 	switch (_type) {
 		case mtpc_inputPhotoCrop: {
-			const MTPDinputPhotoCrop &v(c_inputPhotoCrop());
+			const MTPDinputPhotoCrop &v(*(const MTPDinputPhotoCrop*)data);
 			return v.vcrop_left.innerLength() + v.vcrop_top.innerLength() + v.vcrop_width.innerLength();
 		}
 	}
@@ -17790,7 +18092,8 @@ inline void MTPinputPhotoCrop::read(const mtpPrime *&from, const mtpPrime *end,
 		case mtpc_inputPhotoCropAuto: _type = cons; break;
 		case mtpc_inputPhotoCrop: _type = cons; {
 			if (!data) setData(new MTPDinputPhotoCrop());
-			MTPDinputPhotoCrop &v(_inputPhotoCrop());
+			split();
+			MTPDinputPhotoCrop &v(*(MTPDinputPhotoCrop*)data);
 			v.vcrop_left.read(from, end);
 			v.vcrop_top.read(from, end);
 			v.vcrop_width.read(from, end);
@@ -17801,7 +18104,7 @@ inline void MTPinputPhotoCrop::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPinputPhotoCrop::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputPhotoCrop: {
-			const MTPDinputPhotoCrop &v(c_inputPhotoCrop());
+			const MTPDinputPhotoCrop &v(*(const MTPDinputPhotoCrop*)data);
 			v.vcrop_left.write(to);
 			v.vcrop_top.write(to);
 			v.vcrop_width.write(to);
@@ -17823,6 +18126,13 @@ inline MTPinputPhotoCrop MTP_inputPhotoCropAuto() {
 inline MTPinputPhotoCrop MTP_inputPhotoCrop(const MTPdouble &_crop_left, const MTPdouble &_crop_top, const MTPdouble &_crop_width) {
 	return MTPinputPhotoCrop(new MTPDinputPhotoCrop(_crop_left, _crop_top, _crop_width));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputPhotoCrop &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputPhotoCrop: visitor(*(const MTPDinputPhotoCrop*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPinputAppEvent::MTPinputAppEvent() : mtpDataOwner(new MTPDinputAppEvent()) {
 }
@@ -17860,11 +18170,11 @@ inline MTPinputAppEvent MTP_inputAppEvent(const MTPdouble &_time, const MTPstrin
 inline uint32 MTPpeer::innerLength() const {
 	switch (_type) {
 		case mtpc_peerUser: {
-			const MTPDpeerUser &v(c_peerUser());
+			const MTPDpeerUser &v(*(const MTPDpeerUser*)data);
 			return v.vuser_id.innerLength();
 		}
 		case mtpc_peerChat: {
-			const MTPDpeerChat &v(c_peerChat());
+			const MTPDpeerChat &v(*(const MTPDpeerChat*)data);
 			return v.vchat_id.innerLength();
 		}
 	}
@@ -17879,12 +18189,14 @@ inline void MTPpeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_peerUser: _type = cons; {
 			if (!data) setData(new MTPDpeerUser());
-			MTPDpeerUser &v(_peerUser());
+			split();
+			MTPDpeerUser &v(*(MTPDpeerUser*)data);
 			v.vuser_id.read(from, end);
 		} break;
 		case mtpc_peerChat: _type = cons; {
 			if (!data) setData(new MTPDpeerChat());
-			MTPDpeerChat &v(_peerChat());
+			split();
+			MTPDpeerChat &v(*(MTPDpeerChat*)data);
 			v.vchat_id.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPpeer");
@@ -17893,11 +18205,11 @@ inline void MTPpeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPpeer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_peerUser: {
-			const MTPDpeerUser &v(c_peerUser());
+			const MTPDpeerUser &v(*(const MTPDpeerUser*)data);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_peerChat: {
-			const MTPDpeerChat &v(c_peerChat());
+			const MTPDpeerChat &v(*(const MTPDpeerChat*)data);
 			v.vchat_id.write(to);
 		} break;
 	}
@@ -17919,6 +18231,14 @@ inline MTPpeer MTP_peerUser(MTPint _user_id) {
 inline MTPpeer MTP_peerChat(MTPint _chat_id) {
 	return MTPpeer(new MTPDpeerChat(_chat_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPpeer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_peerUser: visitor(*(const MTPDpeerUser*)value.data); return true;
+	case mtpc_peerChat: visitor(*(const MTPDpeerChat*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPstorage_fileType::innerLength() const {
 	return 0;
@@ -17995,11 +18315,11 @@ inline MTPstorage_fileType MTP_storage_fileWebp() {
 inline uint32 MTPfileLocation::innerLength() const {
 	switch (_type) {
 		case mtpc_fileLocationUnavailable: {
-			const MTPDfileLocationUnavailable &v(c_fileLocationUnavailable());
+			const MTPDfileLocationUnavailable &v(*(const MTPDfileLocationUnavailable*)data);
 			return v.vvolume_id.innerLength() + v.vlocal_id.innerLength() + v.vsecret.innerLength();
 		}
 		case mtpc_fileLocation: {
-			const MTPDfileLocation &v(c_fileLocation());
+			const MTPDfileLocation &v(*(const MTPDfileLocation*)data);
 			return v.vdc_id.innerLength() + v.vvolume_id.innerLength() + v.vlocal_id.innerLength() + v.vsecret.innerLength();
 		}
 	}
@@ -18014,14 +18334,16 @@ inline void MTPfileLocation::read(const mtpPrime *&from, const mtpPrime *end, mt
 	switch (cons) {
 		case mtpc_fileLocationUnavailable: _type = cons; {
 			if (!data) setData(new MTPDfileLocationUnavailable());
-			MTPDfileLocationUnavailable &v(_fileLocationUnavailable());
+			split();
+			MTPDfileLocationUnavailable &v(*(MTPDfileLocationUnavailable*)data);
 			v.vvolume_id.read(from, end);
 			v.vlocal_id.read(from, end);
 			v.vsecret.read(from, end);
 		} break;
 		case mtpc_fileLocation: _type = cons; {
 			if (!data) setData(new MTPDfileLocation());
-			MTPDfileLocation &v(_fileLocation());
+			split();
+			MTPDfileLocation &v(*(MTPDfileLocation*)data);
 			v.vdc_id.read(from, end);
 			v.vvolume_id.read(from, end);
 			v.vlocal_id.read(from, end);
@@ -18033,13 +18355,13 @@ inline void MTPfileLocation::read(const mtpPrime *&from, const mtpPrime *end, mt
 inline void MTPfileLocation::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_fileLocationUnavailable: {
-			const MTPDfileLocationUnavailable &v(c_fileLocationUnavailable());
+			const MTPDfileLocationUnavailable &v(*(const MTPDfileLocationUnavailable*)data);
 			v.vvolume_id.write(to);
 			v.vlocal_id.write(to);
 			v.vsecret.write(to);
 		} break;
 		case mtpc_fileLocation: {
-			const MTPDfileLocation &v(c_fileLocation());
+			const MTPDfileLocation &v(*(const MTPDfileLocation*)data);
 			v.vdc_id.write(to);
 			v.vvolume_id.write(to);
 			v.vlocal_id.write(to);
@@ -18064,31 +18386,39 @@ inline MTPfileLocation MTP_fileLocationUnavailable(const MTPlong &_volume_id, MT
 inline MTPfileLocation MTP_fileLocation(MTPint _dc_id, const MTPlong &_volume_id, MTPint _local_id, const MTPlong &_secret) {
 	return MTPfileLocation(new MTPDfileLocation(_dc_id, _volume_id, _local_id, _secret));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPfileLocation &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_fileLocationUnavailable: visitor(*(const MTPDfileLocationUnavailable*)value.data); return true;
+	case mtpc_fileLocation: visitor(*(const MTPDfileLocation*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPuser::innerLength() const {
 	switch (_type) {
 		case mtpc_userEmpty: {
-			const MTPDuserEmpty &v(c_userEmpty());
+			const MTPDuserEmpty &v(*(const MTPDuserEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_userSelf: {
-			const MTPDuserSelf &v(c_userSelf());
+			const MTPDuserSelf &v(*(const MTPDuserSelf*)data);
 			return v.vid.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength() + v.vphone.innerLength() + v.vphoto.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_userContact: {
-			const MTPDuserContact &v(c_userContact());
+			const MTPDuserContact &v(*(const MTPDuserContact*)data);
 			return v.vid.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength() + v.vaccess_hash.innerLength() + v.vphone.innerLength() + v.vphoto.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_userRequest: {
-			const MTPDuserRequest &v(c_userRequest());
+			const MTPDuserRequest &v(*(const MTPDuserRequest*)data);
 			return v.vid.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength() + v.vaccess_hash.innerLength() + v.vphone.innerLength() + v.vphoto.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_userForeign: {
-			const MTPDuserForeign &v(c_userForeign());
+			const MTPDuserForeign &v(*(const MTPDuserForeign*)data);
 			return v.vid.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength() + v.vaccess_hash.innerLength() + v.vphoto.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_userDeleted: {
-			const MTPDuserDeleted &v(c_userDeleted());
+			const MTPDuserDeleted &v(*(const MTPDuserDeleted*)data);
 			return v.vid.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength();
 		}
 	}
@@ -18103,12 +18433,14 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_userEmpty: _type = cons; {
 			if (!data) setData(new MTPDuserEmpty());
-			MTPDuserEmpty &v(_userEmpty());
+			split();
+			MTPDuserEmpty &v(*(MTPDuserEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_userSelf: _type = cons; {
 			if (!data) setData(new MTPDuserSelf());
-			MTPDuserSelf &v(_userSelf());
+			split();
+			MTPDuserSelf &v(*(MTPDuserSelf*)data);
 			v.vid.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18119,7 +18451,8 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 		} break;
 		case mtpc_userContact: _type = cons; {
 			if (!data) setData(new MTPDuserContact());
-			MTPDuserContact &v(_userContact());
+			split();
+			MTPDuserContact &v(*(MTPDuserContact*)data);
 			v.vid.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18131,7 +18464,8 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 		} break;
 		case mtpc_userRequest: _type = cons; {
 			if (!data) setData(new MTPDuserRequest());
-			MTPDuserRequest &v(_userRequest());
+			split();
+			MTPDuserRequest &v(*(MTPDuserRequest*)data);
 			v.vid.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18143,7 +18477,8 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 		} break;
 		case mtpc_userForeign: _type = cons; {
 			if (!data) setData(new MTPDuserForeign());
-			MTPDuserForeign &v(_userForeign());
+			split();
+			MTPDuserForeign &v(*(MTPDuserForeign*)data);
 			v.vid.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18154,7 +18489,8 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 		} break;
 		case mtpc_userDeleted: _type = cons; {
 			if (!data) setData(new MTPDuserDeleted());
-			MTPDuserDeleted &v(_userDeleted());
+			split();
+			MTPDuserDeleted &v(*(MTPDuserDeleted*)data);
 			v.vid.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18166,11 +18502,11 @@ inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPuser::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_userEmpty: {
-			const MTPDuserEmpty &v(c_userEmpty());
+			const MTPDuserEmpty &v(*(const MTPDuserEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_userSelf: {
-			const MTPDuserSelf &v(c_userSelf());
+			const MTPDuserSelf &v(*(const MTPDuserSelf*)data);
 			v.vid.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
@@ -18180,7 +18516,7 @@ inline void MTPuser::write(mtpBuffer &to) const {
 			v.vstatus.write(to);
 		} break;
 		case mtpc_userContact: {
-			const MTPDuserContact &v(c_userContact());
+			const MTPDuserContact &v(*(const MTPDuserContact*)data);
 			v.vid.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
@@ -18191,7 +18527,7 @@ inline void MTPuser::write(mtpBuffer &to) const {
 			v.vstatus.write(to);
 		} break;
 		case mtpc_userRequest: {
-			const MTPDuserRequest &v(c_userRequest());
+			const MTPDuserRequest &v(*(const MTPDuserRequest*)data);
 			v.vid.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
@@ -18202,7 +18538,7 @@ inline void MTPuser::write(mtpBuffer &to) const {
 			v.vstatus.write(to);
 		} break;
 		case mtpc_userForeign: {
-			const MTPDuserForeign &v(c_userForeign());
+			const MTPDuserForeign &v(*(const MTPDuserForeign*)data);
 			v.vid.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
@@ -18212,7 +18548,7 @@ inline void MTPuser::write(mtpBuffer &to) const {
 			v.vstatus.write(to);
 		} break;
 		case mtpc_userDeleted: {
-			const MTPDuserDeleted &v(c_userDeleted());
+			const MTPDuserDeleted &v(*(const MTPDuserDeleted*)data);
 			v.vid.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
@@ -18261,11 +18597,23 @@ inline MTPuser MTP_userForeign(MTPint _id, const MTPstring &_first_name, const M
 inline MTPuser MTP_userDeleted(MTPint _id, const MTPstring &_first_name, const MTPstring &_last_name, const MTPstring &_username) {
 	return MTPuser(new MTPDuserDeleted(_id, _first_name, _last_name, _username));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPuser &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_userEmpty: visitor(*(const MTPDuserEmpty*)value.data); return true;
+	case mtpc_userSelf: visitor(*(const MTPDuserSelf*)value.data); return true;
+	case mtpc_userContact: visitor(*(const MTPDuserContact*)value.data); return true;
+	case mtpc_userRequest: visitor(*(const MTPDuserRequest*)value.data); return true;
+	case mtpc_userForeign: visitor(*(const MTPDuserForeign*)value.data); return true;
+	case mtpc_userDeleted: visitor(*(const MTPDuserDeleted*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPuserProfilePhoto::innerLength() const {
 	switch (_type) {
 		case mtpc_userProfilePhoto: {
-			const MTPDuserProfilePhoto &v(c_userProfilePhoto());
+			const MTPDuserProfilePhoto &v(*(const MTPDuserProfilePhoto*)data);
 			return v.vphoto_id.innerLength() + v.vphoto_small.innerLength() + v.vphoto_big.innerLength();
 		}
 	}
@@ -18281,7 +18629,8 @@ inline void MTPuserProfilePhoto::read(const mtpPrime *&from, const mtpPrime *end
 		case mtpc_userProfilePhotoEmpty: _type = cons; break;
 		case mtpc_userProfilePhoto: _type = cons; {
 			if (!data) setData(new MTPDuserProfilePhoto());
-			MTPDuserProfilePhoto &v(_userProfilePhoto());
+			split();
+			MTPDuserProfilePhoto &v(*(MTPDuserProfilePhoto*)data);
 			v.vphoto_id.read(from, end);
 			v.vphoto_small.read(from, end);
 			v.vphoto_big.read(from, end);
@@ -18292,7 +18641,7 @@ inline void MTPuserProfilePhoto::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPuserProfilePhoto::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_userProfilePhoto: {
-			const MTPDuserProfilePhoto &v(c_userProfilePhoto());
+			const MTPDuserProfilePhoto &v(*(const MTPDuserProfilePhoto*)data);
 			v.vphoto_id.write(to);
 			v.vphoto_small.write(to);
 			v.vphoto_big.write(to);
@@ -18314,15 +18663,22 @@ inline MTPuserProfilePhoto MTP_userProfilePhotoEmpty() {
 inline MTPuserProfilePhoto MTP_userProfilePhoto(const MTPlong &_photo_id, const MTPFileLocation &_photo_small, const MTPFileLocation &_photo_big) {
 	return MTPuserProfilePhoto(new MTPDuserProfilePhoto(_photo_id, _photo_small, _photo_big));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPuserProfilePhoto &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_userProfilePhoto: visitor(*(const MTPDuserProfilePhoto*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPuserStatus::innerLength() const {
 	switch (_type) {
 		case mtpc_userStatusOnline: {
-			const MTPDuserStatusOnline &v(c_userStatusOnline());
+			const MTPDuserStatusOnline &v(*(const MTPDuserStatusOnline*)data);
 			return v.vexpires.innerLength();
 		}
 		case mtpc_userStatusOffline: {
-			const MTPDuserStatusOffline &v(c_userStatusOffline());
+			const MTPDuserStatusOffline &v(*(const MTPDuserStatusOffline*)data);
 			return v.vwas_online.innerLength();
 		}
 	}
@@ -18338,12 +18694,14 @@ inline void MTPuserStatus::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		case mtpc_userStatusEmpty: _type = cons; break;
 		case mtpc_userStatusOnline: _type = cons; {
 			if (!data) setData(new MTPDuserStatusOnline());
-			MTPDuserStatusOnline &v(_userStatusOnline());
+			split();
+			MTPDuserStatusOnline &v(*(MTPDuserStatusOnline*)data);
 			v.vexpires.read(from, end);
 		} break;
 		case mtpc_userStatusOffline: _type = cons; {
 			if (!data) setData(new MTPDuserStatusOffline());
-			MTPDuserStatusOffline &v(_userStatusOffline());
+			split();
+			MTPDuserStatusOffline &v(*(MTPDuserStatusOffline*)data);
 			v.vwas_online.read(from, end);
 		} break;
 		case mtpc_userStatusRecently: _type = cons; break;
@@ -18355,11 +18713,11 @@ inline void MTPuserStatus::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPuserStatus::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_userStatusOnline: {
-			const MTPDuserStatusOnline &v(c_userStatusOnline());
+			const MTPDuserStatusOnline &v(*(const MTPDuserStatusOnline*)data);
 			v.vexpires.write(to);
 		} break;
 		case mtpc_userStatusOffline: {
-			const MTPDuserStatusOffline &v(c_userStatusOffline());
+			const MTPDuserStatusOffline &v(*(const MTPDuserStatusOffline*)data);
 			v.vwas_online.write(to);
 		} break;
 	}
@@ -18397,23 +18755,31 @@ inline MTPuserStatus MTP_userStatusLastWeek() {
 inline MTPuserStatus MTP_userStatusLastMonth() {
 	return MTPuserStatus(mtpc_userStatusLastMonth);
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPuserStatus &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_userStatusOnline: visitor(*(const MTPDuserStatusOnline*)value.data); return true;
+	case mtpc_userStatusOffline: visitor(*(const MTPDuserStatusOffline*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPchat::innerLength() const {
 	switch (_type) {
 		case mtpc_chatEmpty: {
-			const MTPDchatEmpty &v(c_chatEmpty());
+			const MTPDchatEmpty &v(*(const MTPDchatEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_chat: {
-			const MTPDchat &v(c_chat());
+			const MTPDchat &v(*(const MTPDchat*)data);
 			return v.vid.innerLength() + v.vtitle.innerLength() + v.vphoto.innerLength() + v.vparticipants_count.innerLength() + v.vdate.innerLength() + v.vleft.innerLength() + v.vversion.innerLength();
 		}
 		case mtpc_chatForbidden: {
-			const MTPDchatForbidden &v(c_chatForbidden());
+			const MTPDchatForbidden &v(*(const MTPDchatForbidden*)data);
 			return v.vid.innerLength() + v.vtitle.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_geoChat: {
-			const MTPDgeoChat &v(c_geoChat());
+			const MTPDgeoChat &v(*(const MTPDgeoChat*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vtitle.innerLength() + v.vaddress.innerLength() + v.vvenue.innerLength() + v.vgeo.innerLength() + v.vphoto.innerLength() + v.vparticipants_count.innerLength() + v.vdate.innerLength() + v.vchecked_in.innerLength() + v.vversion.innerLength();
 		}
 	}
@@ -18428,12 +18794,14 @@ inline void MTPchat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_chatEmpty: _type = cons; {
 			if (!data) setData(new MTPDchatEmpty());
-			MTPDchatEmpty &v(_chatEmpty());
+			split();
+			MTPDchatEmpty &v(*(MTPDchatEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_chat: _type = cons; {
 			if (!data) setData(new MTPDchat());
-			MTPDchat &v(_chat());
+			split();
+			MTPDchat &v(*(MTPDchat*)data);
 			v.vid.read(from, end);
 			v.vtitle.read(from, end);
 			v.vphoto.read(from, end);
@@ -18444,14 +18812,16 @@ inline void MTPchat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 		} break;
 		case mtpc_chatForbidden: _type = cons; {
 			if (!data) setData(new MTPDchatForbidden());
-			MTPDchatForbidden &v(_chatForbidden());
+			split();
+			MTPDchatForbidden &v(*(MTPDchatForbidden*)data);
 			v.vid.read(from, end);
 			v.vtitle.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_geoChat: _type = cons; {
 			if (!data) setData(new MTPDgeoChat());
-			MTPDgeoChat &v(_geoChat());
+			split();
+			MTPDgeoChat &v(*(MTPDgeoChat*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vtitle.read(from, end);
@@ -18470,11 +18840,11 @@ inline void MTPchat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPchat::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_chatEmpty: {
-			const MTPDchatEmpty &v(c_chatEmpty());
+			const MTPDchatEmpty &v(*(const MTPDchatEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_chat: {
-			const MTPDchat &v(c_chat());
+			const MTPDchat &v(*(const MTPDchat*)data);
 			v.vid.write(to);
 			v.vtitle.write(to);
 			v.vphoto.write(to);
@@ -18484,13 +18854,13 @@ inline void MTPchat::write(mtpBuffer &to) const {
 			v.vversion.write(to);
 		} break;
 		case mtpc_chatForbidden: {
-			const MTPDchatForbidden &v(c_chatForbidden());
+			const MTPDchatForbidden &v(*(const MTPDchatForbidden*)data);
 			v.vid.write(to);
 			v.vtitle.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_geoChat: {
-			const MTPDgeoChat &v(c_geoChat());
+			const MTPDgeoChat &v(*(const MTPDgeoChat*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vtitle.write(to);
@@ -18534,6 +18904,16 @@ inline MTPchat MTP_chatForbidden(MTPint _id, const MTPstring &_title, MTPint _da
 inline MTPchat MTP_geoChat(MTPint _id, const MTPlong &_access_hash, const MTPstring &_title, const MTPstring &_address, const MTPstring &_venue, const MTPGeoPoint &_geo, const MTPChatPhoto &_photo, MTPint _participants_count, MTPint _date, MTPBool _checked_in, MTPint _version) {
 	return MTPchat(new MTPDgeoChat(_id, _access_hash, _title, _address, _venue, _geo, _photo, _participants_count, _date, _checked_in, _version));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPchat &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_chatEmpty: visitor(*(const MTPDchatEmpty*)value.data); return true;
+	case mtpc_chat: visitor(*(const MTPDchat*)value.data); return true;
+	case mtpc_chatForbidden: visitor(*(const MTPDchatForbidden*)value.data); return true;
+	case mtpc_geoChat: visitor(*(const MTPDgeoChat*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPchatFull::MTPchatFull() : mtpDataOwner(new MTPDchatFull()) {
 }
@@ -18602,11 +18982,11 @@ inline MTPchatParticipant MTP_chatParticipant(MTPint _user_id, MTPint _inviter_i
 inline uint32 MTPchatParticipants::innerLength() const {
 	switch (_type) {
 		case mtpc_chatParticipantsForbidden: {
-			const MTPDchatParticipantsForbidden &v(c_chatParticipantsForbidden());
+			const MTPDchatParticipantsForbidden &v(*(const MTPDchatParticipantsForbidden*)data);
 			return v.vchat_id.innerLength();
 		}
 		case mtpc_chatParticipants: {
-			const MTPDchatParticipants &v(c_chatParticipants());
+			const MTPDchatParticipants &v(*(const MTPDchatParticipants*)data);
 			return v.vchat_id.innerLength() + v.vadmin_id.innerLength() + v.vparticipants.innerLength() + v.vversion.innerLength();
 		}
 	}
@@ -18621,12 +19001,14 @@ inline void MTPchatParticipants::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_chatParticipantsForbidden: _type = cons; {
 			if (!data) setData(new MTPDchatParticipantsForbidden());
-			MTPDchatParticipantsForbidden &v(_chatParticipantsForbidden());
+			split();
+			MTPDchatParticipantsForbidden &v(*(MTPDchatParticipantsForbidden*)data);
 			v.vchat_id.read(from, end);
 		} break;
 		case mtpc_chatParticipants: _type = cons; {
 			if (!data) setData(new MTPDchatParticipants());
-			MTPDchatParticipants &v(_chatParticipants());
+			split();
+			MTPDchatParticipants &v(*(MTPDchatParticipants*)data);
 			v.vchat_id.read(from, end);
 			v.vadmin_id.read(from, end);
 			v.vparticipants.read(from, end);
@@ -18638,11 +19020,11 @@ inline void MTPchatParticipants::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPchatParticipants::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_chatParticipantsForbidden: {
-			const MTPDchatParticipantsForbidden &v(c_chatParticipantsForbidden());
+			const MTPDchatParticipantsForbidden &v(*(const MTPDchatParticipantsForbidden*)data);
 			v.vchat_id.write(to);
 		} break;
 		case mtpc_chatParticipants: {
-			const MTPDchatParticipants &v(c_chatParticipants());
+			const MTPDchatParticipants &v(*(const MTPDchatParticipants*)data);
 			v.vchat_id.write(to);
 			v.vadmin_id.write(to);
 			v.vparticipants.write(to);
@@ -18667,11 +19049,19 @@ inline MTPchatParticipants MTP_chatParticipantsForbidden(MTPint _chat_id) {
 inline MTPchatParticipants MTP_chatParticipants(MTPint _chat_id, MTPint _admin_id, const MTPVector<MTPChatParticipant> &_participants, MTPint _version) {
 	return MTPchatParticipants(new MTPDchatParticipants(_chat_id, _admin_id, _participants, _version));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPchatParticipants &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_chatParticipantsForbidden: visitor(*(const MTPDchatParticipantsForbidden*)value.data); return true;
+	case mtpc_chatParticipants: visitor(*(const MTPDchatParticipants*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPchatPhoto::innerLength() const {
 	switch (_type) {
 		case mtpc_chatPhoto: {
-			const MTPDchatPhoto &v(c_chatPhoto());
+			const MTPDchatPhoto &v(*(const MTPDchatPhoto*)data);
 			return v.vphoto_small.innerLength() + v.vphoto_big.innerLength();
 		}
 	}
@@ -18687,7 +19077,8 @@ inline void MTPchatPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		case mtpc_chatPhotoEmpty: _type = cons; break;
 		case mtpc_chatPhoto: _type = cons; {
 			if (!data) setData(new MTPDchatPhoto());
-			MTPDchatPhoto &v(_chatPhoto());
+			split();
+			MTPDchatPhoto &v(*(MTPDchatPhoto*)data);
 			v.vphoto_small.read(from, end);
 			v.vphoto_big.read(from, end);
 		} break;
@@ -18697,7 +19088,7 @@ inline void MTPchatPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPchatPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_chatPhoto: {
-			const MTPDchatPhoto &v(c_chatPhoto());
+			const MTPDchatPhoto &v(*(const MTPDchatPhoto*)data);
 			v.vphoto_small.write(to);
 			v.vphoto_big.write(to);
 		} break;
@@ -18718,19 +19109,26 @@ inline MTPchatPhoto MTP_chatPhotoEmpty() {
 inline MTPchatPhoto MTP_chatPhoto(const MTPFileLocation &_photo_small, const MTPFileLocation &_photo_big) {
 	return MTPchatPhoto(new MTPDchatPhoto(_photo_small, _photo_big));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPchatPhoto &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_chatPhoto: visitor(*(const MTPDchatPhoto*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessage::innerLength() const {
 	switch (_type) {
 		case mtpc_messageEmpty: {
-			const MTPDmessageEmpty &v(c_messageEmpty());
+			const MTPDmessageEmpty &v(*(const MTPDmessageEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_message: {
-			const MTPDmessage &v(c_message());
+			const MTPDmessage &v(*(const MTPDmessage*)data);
 			return v.vflags.innerLength() + v.vid.innerLength() + v.vfrom_id.innerLength() + v.vto_id.innerLength() + (v.has_fwd_from_id() ? v.vfwd_from_id.innerLength() : 0) + (v.has_fwd_date() ? v.vfwd_date.innerLength() : 0) + (v.has_reply_to_msg_id() ? v.vreply_to_msg_id.innerLength() : 0) + v.vdate.innerLength() + v.vmessage.innerLength() + v.vmedia.innerLength();
 		}
 		case mtpc_messageService: {
-			const MTPDmessageService &v(c_messageService());
+			const MTPDmessageService &v(*(const MTPDmessageService*)data);
 			return v.vflags.innerLength() + v.vid.innerLength() + v.vfrom_id.innerLength() + v.vto_id.innerLength() + v.vdate.innerLength() + v.vaction.innerLength();
 		}
 	}
@@ -18745,12 +19143,14 @@ inline void MTPmessage::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 	switch (cons) {
 		case mtpc_messageEmpty: _type = cons; {
 			if (!data) setData(new MTPDmessageEmpty());
-			MTPDmessageEmpty &v(_messageEmpty());
+			split();
+			MTPDmessageEmpty &v(*(MTPDmessageEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_message: _type = cons; {
 			if (!data) setData(new MTPDmessage());
-			MTPDmessage &v(_message());
+			split();
+			MTPDmessage &v(*(MTPDmessage*)data);
 			v.vflags.read(from, end);
 			v.vid.read(from, end);
 			v.vfrom_id.read(from, end);
@@ -18764,7 +19164,8 @@ inline void MTPmessage::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 		} break;
 		case mtpc_messageService: _type = cons; {
 			if (!data) setData(new MTPDmessageService());
-			MTPDmessageService &v(_messageService());
+			split();
+			MTPDmessageService &v(*(MTPDmessageService*)data);
 			v.vflags.read(from, end);
 			v.vid.read(from, end);
 			v.vfrom_id.read(from, end);
@@ -18778,11 +19179,11 @@ inline void MTPmessage::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 inline void MTPmessage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messageEmpty: {
-			const MTPDmessageEmpty &v(c_messageEmpty());
+			const MTPDmessageEmpty &v(*(const MTPDmessageEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_message: {
-			const MTPDmessage &v(c_message());
+			const MTPDmessage &v(*(const MTPDmessage*)data);
 			v.vflags.write(to);
 			v.vid.write(to);
 			v.vfrom_id.write(to);
@@ -18795,7 +19196,7 @@ inline void MTPmessage::write(mtpBuffer &to) const {
 			v.vmedia.write(to);
 		} break;
 		case mtpc_messageService: {
-			const MTPDmessageService &v(c_messageService());
+			const MTPDmessageService &v(*(const MTPDmessageService*)data);
 			v.vflags.write(to);
 			v.vid.write(to);
 			v.vfrom_id.write(to);
@@ -18828,35 +19229,44 @@ inline MTPmessage MTP_message(MTPint _flags, MTPint _id, MTPint _from_id, const
 inline MTPmessage MTP_messageService(MTPint _flags, MTPint _id, MTPint _from_id, const MTPPeer &_to_id, MTPint _date, const MTPMessageAction &_action) {
 	return MTPmessage(new MTPDmessageService(_flags, _id, _from_id, _to_id, _date, _action));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messageEmpty: visitor(*(const MTPDmessageEmpty*)value.data); return true;
+	case mtpc_message: visitor(*(const MTPDmessage*)value.data); return true;
+	case mtpc_messageService: visitor(*(const MTPDmessageService*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessageMedia::innerLength() const {
 	switch (_type) {
 		case mtpc_messageMediaPhoto: {
-			const MTPDmessageMediaPhoto &v(c_messageMediaPhoto());
+			const MTPDmessageMediaPhoto &v(*(const MTPDmessageMediaPhoto*)data);
 			return v.vphoto.innerLength();
 		}
 		case mtpc_messageMediaVideo: {
-			const MTPDmessageMediaVideo &v(c_messageMediaVideo());
+			const MTPDmessageMediaVideo &v(*(const MTPDmessageMediaVideo*)data);
 			return v.vvideo.innerLength();
 		}
 		case mtpc_messageMediaGeo: {
-			const MTPDmessageMediaGeo &v(c_messageMediaGeo());
+			const MTPDmessageMediaGeo &v(*(const MTPDmessageMediaGeo*)data);
 			return v.vgeo.innerLength();
 		}
 		case mtpc_messageMediaContact: {
-			const MTPDmessageMediaContact &v(c_messageMediaContact());
+			const MTPDmessageMediaContact &v(*(const MTPDmessageMediaContact*)data);
 			return v.vphone_number.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vuser_id.innerLength();
 		}
 		case mtpc_messageMediaDocument: {
-			const MTPDmessageMediaDocument &v(c_messageMediaDocument());
+			const MTPDmessageMediaDocument &v(*(const MTPDmessageMediaDocument*)data);
 			return v.vdocument.innerLength();
 		}
 		case mtpc_messageMediaAudio: {
-			const MTPDmessageMediaAudio &v(c_messageMediaAudio());
+			const MTPDmessageMediaAudio &v(*(const MTPDmessageMediaAudio*)data);
 			return v.vaudio.innerLength();
 		}
 		case mtpc_messageMediaWebPage: {
-			const MTPDmessageMediaWebPage &v(c_messageMediaWebPage());
+			const MTPDmessageMediaWebPage &v(*(const MTPDmessageMediaWebPage*)data);
 			return v.vwebpage.innerLength();
 		}
 	}
@@ -18872,22 +19282,26 @@ inline void MTPmessageMedia::read(const mtpPrime *&from, const mtpPrime *end, mt
 		case mtpc_messageMediaEmpty: _type = cons; break;
 		case mtpc_messageMediaPhoto: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaPhoto());
-			MTPDmessageMediaPhoto &v(_messageMediaPhoto());
+			split();
+			MTPDmessageMediaPhoto &v(*(MTPDmessageMediaPhoto*)data);
 			v.vphoto.read(from, end);
 		} break;
 		case mtpc_messageMediaVideo: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaVideo());
-			MTPDmessageMediaVideo &v(_messageMediaVideo());
+			split();
+			MTPDmessageMediaVideo &v(*(MTPDmessageMediaVideo*)data);
 			v.vvideo.read(from, end);
 		} break;
 		case mtpc_messageMediaGeo: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaGeo());
-			MTPDmessageMediaGeo &v(_messageMediaGeo());
+			split();
+			MTPDmessageMediaGeo &v(*(MTPDmessageMediaGeo*)data);
 			v.vgeo.read(from, end);
 		} break;
 		case mtpc_messageMediaContact: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaContact());
-			MTPDmessageMediaContact &v(_messageMediaContact());
+			split();
+			MTPDmessageMediaContact &v(*(MTPDmessageMediaContact*)data);
 			v.vphone_number.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -18896,17 +19310,20 @@ inline void MTPmessageMedia::read(const mtpPrime *&from, const mtpPrime *end, mt
 		case mtpc_messageMediaUnsupported: _type = cons; break;
 		case mtpc_messageMediaDocument: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaDocument());
-			MTPDmessageMediaDocument &v(_messageMediaDocument());
+			split();
+			MTPDmessageMediaDocument &v(*(MTPDmessageMediaDocument*)data);
 			v.vdocument.read(from, end);
 		} break;
 		case mtpc_messageMediaAudio: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaAudio());
-			MTPDmessageMediaAudio &v(_messageMediaAudio());
+			split();
+			MTPDmessageMediaAudio &v(*(MTPDmessageMediaAudio*)data);
 			v.vaudio.read(from, end);
 		} break;
 		case mtpc_messageMediaWebPage: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaWebPage());
-			MTPDmessageMediaWebPage &v(_messageMediaWebPage());
+			split();
+			MTPDmessageMediaWebPage &v(*(MTPDmessageMediaWebPage*)data);
 			v.vwebpage.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPmessageMedia");
@@ -18915,34 +19332,34 @@ inline void MTPmessageMedia::read(const mtpPrime *&from, const mtpPrime *end, mt
 inline void MTPmessageMedia::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messageMediaPhoto: {
-			const MTPDmessageMediaPhoto &v(c_messageMediaPhoto());
+			const MTPDmessageMediaPhoto &v(*(const MTPDmessageMediaPhoto*)data);
 			v.vphoto.write(to);
 		} break;
 		case mtpc_messageMediaVideo: {
-			const MTPDmessageMediaVideo &v(c_messageMediaVideo());
+			const MTPDmessageMediaVideo &v(*(const MTPDmessageMediaVideo*)data);
 			v.vvideo.write(to);
 		} break;
 		case mtpc_messageMediaGeo: {
-			const MTPDmessageMediaGeo &v(c_messageMediaGeo());
+			const MTPDmessageMediaGeo &v(*(const MTPDmessageMediaGeo*)data);
 			v.vgeo.write(to);
 		} break;
 		case mtpc_messageMediaContact: {
-			const MTPDmessageMediaContact &v(c_messageMediaContact());
+			const MTPDmessageMediaContact &v(*(const MTPDmessageMediaContact*)data);
 			v.vphone_number.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_messageMediaDocument: {
-			const MTPDmessageMediaDocument &v(c_messageMediaDocument());
+			const MTPDmessageMediaDocument &v(*(const MTPDmessageMediaDocument*)data);
 			v.vdocument.write(to);
 		} break;
 		case mtpc_messageMediaAudio: {
-			const MTPDmessageMediaAudio &v(c_messageMediaAudio());
+			const MTPDmessageMediaAudio &v(*(const MTPDmessageMediaAudio*)data);
 			v.vaudio.write(to);
 		} break;
 		case mtpc_messageMediaWebPage: {
-			const MTPDmessageMediaWebPage &v(c_messageMediaWebPage());
+			const MTPDmessageMediaWebPage &v(*(const MTPDmessageMediaWebPage*)data);
 			v.vwebpage.write(to);
 		} break;
 	}
@@ -19002,31 +19419,44 @@ inline MTPmessageMedia MTP_messageMediaAudio(const MTPAudio &_audio) {
 inline MTPmessageMedia MTP_messageMediaWebPage(const MTPWebPage &_webpage) {
 	return MTPmessageMedia(new MTPDmessageMediaWebPage(_webpage));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessageMedia &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messageMediaPhoto: visitor(*(const MTPDmessageMediaPhoto*)value.data); return true;
+	case mtpc_messageMediaVideo: visitor(*(const MTPDmessageMediaVideo*)value.data); return true;
+	case mtpc_messageMediaGeo: visitor(*(const MTPDmessageMediaGeo*)value.data); return true;
+	case mtpc_messageMediaContact: visitor(*(const MTPDmessageMediaContact*)value.data); return true;
+	case mtpc_messageMediaDocument: visitor(*(const MTPDmessageMediaDocument*)value.data); return true;
+	case mtpc_messageMediaAudio: visitor(*(const MTPDmessageMediaAudio*)value.data); return true;
+	case mtpc_messageMediaWebPage: visitor(*(const MTPDmessageMediaWebPage*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessageAction::innerLength() const {
 	switch (_type) {
 		case mtpc_messageActionChatCreate: {
-			const MTPDmessageActionChatCreate &v(c_messageActionChatCreate());
+			const MTPDmessageActionChatCreate &v(*(const MTPDmessageActionChatCreate*)data);
 			return v.vtitle.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_messageActionChatEditTitle: {
-			const MTPDmessageActionChatEditTitle &v(c_messageActionChatEditTitle());
+			const MTPDmessageActionChatEditTitle &v(*(const MTPDmessageActionChatEditTitle*)data);
 			return v.vtitle.innerLength();
 		}
 		case mtpc_messageActionChatEditPhoto: {
-			const MTPDmessageActionChatEditPhoto &v(c_messageActionChatEditPhoto());
+			const MTPDmessageActionChatEditPhoto &v(*(const MTPDmessageActionChatEditPhoto*)data);
 			return v.vphoto.innerLength();
 		}
 		case mtpc_messageActionChatAddUser: {
-			const MTPDmessageActionChatAddUser &v(c_messageActionChatAddUser());
+			const MTPDmessageActionChatAddUser &v(*(const MTPDmessageActionChatAddUser*)data);
 			return v.vuser_id.innerLength();
 		}
 		case mtpc_messageActionChatDeleteUser: {
-			const MTPDmessageActionChatDeleteUser &v(c_messageActionChatDeleteUser());
+			const MTPDmessageActionChatDeleteUser &v(*(const MTPDmessageActionChatDeleteUser*)data);
 			return v.vuser_id.innerLength();
 		}
 		case mtpc_messageActionGeoChatCreate: {
-			const MTPDmessageActionGeoChatCreate &v(c_messageActionGeoChatCreate());
+			const MTPDmessageActionGeoChatCreate &v(*(const MTPDmessageActionGeoChatCreate*)data);
 			return v.vtitle.innerLength() + v.vaddress.innerLength();
 		}
 	}
@@ -19042,34 +19472,40 @@ inline void MTPmessageAction::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_messageActionEmpty: _type = cons; break;
 		case mtpc_messageActionChatCreate: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatCreate());
-			MTPDmessageActionChatCreate &v(_messageActionChatCreate());
+			split();
+			MTPDmessageActionChatCreate &v(*(MTPDmessageActionChatCreate*)data);
 			v.vtitle.read(from, end);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_messageActionChatEditTitle: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatEditTitle());
-			MTPDmessageActionChatEditTitle &v(_messageActionChatEditTitle());
+			split();
+			MTPDmessageActionChatEditTitle &v(*(MTPDmessageActionChatEditTitle*)data);
 			v.vtitle.read(from, end);
 		} break;
 		case mtpc_messageActionChatEditPhoto: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatEditPhoto());
-			MTPDmessageActionChatEditPhoto &v(_messageActionChatEditPhoto());
+			split();
+			MTPDmessageActionChatEditPhoto &v(*(MTPDmessageActionChatEditPhoto*)data);
 			v.vphoto.read(from, end);
 		} break;
 		case mtpc_messageActionChatDeletePhoto: _type = cons; break;
 		case mtpc_messageActionChatAddUser: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatAddUser());
-			MTPDmessageActionChatAddUser &v(_messageActionChatAddUser());
+			split();
+			MTPDmessageActionChatAddUser &v(*(MTPDmessageActionChatAddUser*)data);
 			v.vuser_id.read(from, end);
 		} break;
 		case mtpc_messageActionChatDeleteUser: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatDeleteUser());
-			MTPDmessageActionChatDeleteUser &v(_messageActionChatDeleteUser());
+			split();
+			MTPDmessageActionChatDeleteUser &v(*(MTPDmessageActionChatDeleteUser*)data);
 			v.vuser_id.read(from, end);
 		} break;
 		case mtpc_messageActionGeoChatCreate: _type = cons; {
 			if (!data) setData(new MTPDmessageActionGeoChatCreate());
-			MTPDmessageActionGeoChatCreate &v(_messageActionGeoChatCreate());
+			split();
+			MTPDmessageActionGeoChatCreate &v(*(MTPDmessageActionGeoChatCreate*)data);
 			v.vtitle.read(from, end);
 			v.vaddress.read(from, end);
 		} break;
@@ -19080,28 +19516,28 @@ inline void MTPmessageAction::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPmessageAction::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messageActionChatCreate: {
-			const MTPDmessageActionChatCreate &v(c_messageActionChatCreate());
+			const MTPDmessageActionChatCreate &v(*(const MTPDmessageActionChatCreate*)data);
 			v.vtitle.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_messageActionChatEditTitle: {
-			const MTPDmessageActionChatEditTitle &v(c_messageActionChatEditTitle());
+			const MTPDmessageActionChatEditTitle &v(*(const MTPDmessageActionChatEditTitle*)data);
 			v.vtitle.write(to);
 		} break;
 		case mtpc_messageActionChatEditPhoto: {
-			const MTPDmessageActionChatEditPhoto &v(c_messageActionChatEditPhoto());
+			const MTPDmessageActionChatEditPhoto &v(*(const MTPDmessageActionChatEditPhoto*)data);
 			v.vphoto.write(to);
 		} break;
 		case mtpc_messageActionChatAddUser: {
-			const MTPDmessageActionChatAddUser &v(c_messageActionChatAddUser());
+			const MTPDmessageActionChatAddUser &v(*(const MTPDmessageActionChatAddUser*)data);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_messageActionChatDeleteUser: {
-			const MTPDmessageActionChatDeleteUser &v(c_messageActionChatDeleteUser());
+			const MTPDmessageActionChatDeleteUser &v(*(const MTPDmessageActionChatDeleteUser*)data);
 			v.vuser_id.write(to);
 		} break;
 		case mtpc_messageActionGeoChatCreate: {
-			const MTPDmessageActionGeoChatCreate &v(c_messageActionGeoChatCreate());
+			const MTPDmessageActionGeoChatCreate &v(*(const MTPDmessageActionGeoChatCreate*)data);
 			v.vtitle.write(to);
 			v.vaddress.write(to);
 		} break;
@@ -19160,6 +19596,18 @@ inline MTPmessageAction MTP_messageActionGeoChatCreate(const MTPstring &_title,
 inline MTPmessageAction MTP_messageActionGeoChatCheckin() {
 	return MTPmessageAction(mtpc_messageActionGeoChatCheckin);
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessageAction &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messageActionChatCreate: visitor(*(const MTPDmessageActionChatCreate*)value.data); return true;
+	case mtpc_messageActionChatEditTitle: visitor(*(const MTPDmessageActionChatEditTitle*)value.data); return true;
+	case mtpc_messageActionChatEditPhoto: visitor(*(const MTPDmessageActionChatEditPhoto*)value.data); return true;
+	case mtpc_messageActionChatAddUser: visitor(*(const MTPDmessageActionChatAddUser*)value.data); return true;
+	case mtpc_messageActionChatDeleteUser: visitor(*(const MTPDmessageActionChatDeleteUser*)value.data); return true;
+	case mtpc_messageActionGeoChatCreate: visitor(*(const MTPDmessageActionGeoChatCreate*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPdialog::MTPdialog() : mtpDataOwner(new MTPDdialog()) {
 }
@@ -19199,11 +19647,11 @@ inline MTPdialog MTP_dialog(const MTPPeer &_peer, MTPint _top_message, MTPint _r
 inline uint32 MTPphoto::innerLength() const {
 	switch (_type) {
 		case mtpc_photoEmpty: {
-			const MTPDphotoEmpty &v(c_photoEmpty());
+			const MTPDphotoEmpty &v(*(const MTPDphotoEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_photo: {
-			const MTPDphoto &v(c_photo());
+			const MTPDphoto &v(*(const MTPDphoto*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vuser_id.innerLength() + v.vdate.innerLength() + v.vcaption.innerLength() + v.vgeo.innerLength() + v.vsizes.innerLength();
 		}
 	}
@@ -19218,12 +19666,14 @@ inline void MTPphoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_photoEmpty: _type = cons; {
 			if (!data) setData(new MTPDphotoEmpty());
-			MTPDphotoEmpty &v(_photoEmpty());
+			split();
+			MTPDphotoEmpty &v(*(MTPDphotoEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_photo: _type = cons; {
 			if (!data) setData(new MTPDphoto());
-			MTPDphoto &v(_photo());
+			split();
+			MTPDphoto &v(*(MTPDphoto*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vuser_id.read(from, end);
@@ -19238,11 +19688,11 @@ inline void MTPphoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPphoto::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_photoEmpty: {
-			const MTPDphotoEmpty &v(c_photoEmpty());
+			const MTPDphotoEmpty &v(*(const MTPDphotoEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_photo: {
-			const MTPDphoto &v(c_photo());
+			const MTPDphoto &v(*(const MTPDphoto*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vuser_id.write(to);
@@ -19270,19 +19720,27 @@ inline MTPphoto MTP_photoEmpty(const MTPlong &_id) {
 inline MTPphoto MTP_photo(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, const MTPstring &_caption, const MTPGeoPoint &_geo, const MTPVector<MTPPhotoSize> &_sizes) {
 	return MTPphoto(new MTPDphoto(_id, _access_hash, _user_id, _date, _caption, _geo, _sizes));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPphoto &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_photoEmpty: visitor(*(const MTPDphotoEmpty*)value.data); return true;
+	case mtpc_photo: visitor(*(const MTPDphoto*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPphotoSize::innerLength() const {
 	switch (_type) {
 		case mtpc_photoSizeEmpty: {
-			const MTPDphotoSizeEmpty &v(c_photoSizeEmpty());
+			const MTPDphotoSizeEmpty &v(*(const MTPDphotoSizeEmpty*)data);
 			return v.vtype.innerLength();
 		}
 		case mtpc_photoSize: {
-			const MTPDphotoSize &v(c_photoSize());
+			const MTPDphotoSize &v(*(const MTPDphotoSize*)data);
 			return v.vtype.innerLength() + v.vlocation.innerLength() + v.vw.innerLength() + v.vh.innerLength() + v.vsize.innerLength();
 		}
 		case mtpc_photoCachedSize: {
-			const MTPDphotoCachedSize &v(c_photoCachedSize());
+			const MTPDphotoCachedSize &v(*(const MTPDphotoCachedSize*)data);
 			return v.vtype.innerLength() + v.vlocation.innerLength() + v.vw.innerLength() + v.vh.innerLength() + v.vbytes.innerLength();
 		}
 	}
@@ -19297,12 +19755,14 @@ inline void MTPphotoSize::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 	switch (cons) {
 		case mtpc_photoSizeEmpty: _type = cons; {
 			if (!data) setData(new MTPDphotoSizeEmpty());
-			MTPDphotoSizeEmpty &v(_photoSizeEmpty());
+			split();
+			MTPDphotoSizeEmpty &v(*(MTPDphotoSizeEmpty*)data);
 			v.vtype.read(from, end);
 		} break;
 		case mtpc_photoSize: _type = cons; {
 			if (!data) setData(new MTPDphotoSize());
-			MTPDphotoSize &v(_photoSize());
+			split();
+			MTPDphotoSize &v(*(MTPDphotoSize*)data);
 			v.vtype.read(from, end);
 			v.vlocation.read(from, end);
 			v.vw.read(from, end);
@@ -19311,7 +19771,8 @@ inline void MTPphotoSize::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		} break;
 		case mtpc_photoCachedSize: _type = cons; {
 			if (!data) setData(new MTPDphotoCachedSize());
-			MTPDphotoCachedSize &v(_photoCachedSize());
+			split();
+			MTPDphotoCachedSize &v(*(MTPDphotoCachedSize*)data);
 			v.vtype.read(from, end);
 			v.vlocation.read(from, end);
 			v.vw.read(from, end);
@@ -19324,11 +19785,11 @@ inline void MTPphotoSize::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPphotoSize::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_photoSizeEmpty: {
-			const MTPDphotoSizeEmpty &v(c_photoSizeEmpty());
+			const MTPDphotoSizeEmpty &v(*(const MTPDphotoSizeEmpty*)data);
 			v.vtype.write(to);
 		} break;
 		case mtpc_photoSize: {
-			const MTPDphotoSize &v(c_photoSize());
+			const MTPDphotoSize &v(*(const MTPDphotoSize*)data);
 			v.vtype.write(to);
 			v.vlocation.write(to);
 			v.vw.write(to);
@@ -19336,7 +19797,7 @@ inline void MTPphotoSize::write(mtpBuffer &to) const {
 			v.vsize.write(to);
 		} break;
 		case mtpc_photoCachedSize: {
-			const MTPDphotoCachedSize &v(c_photoCachedSize());
+			const MTPDphotoCachedSize &v(*(const MTPDphotoCachedSize*)data);
 			v.vtype.write(to);
 			v.vlocation.write(to);
 			v.vw.write(to);
@@ -19368,15 +19829,24 @@ inline MTPphotoSize MTP_photoSize(const MTPstring &_type, const MTPFileLocation
 inline MTPphotoSize MTP_photoCachedSize(const MTPstring &_type, const MTPFileLocation &_location, MTPint _w, MTPint _h, const MTPbytes &_bytes) {
 	return MTPphotoSize(new MTPDphotoCachedSize(_type, _location, _w, _h, _bytes));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPphotoSize &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_photoSizeEmpty: visitor(*(const MTPDphotoSizeEmpty*)value.data); return true;
+	case mtpc_photoSize: visitor(*(const MTPDphotoSize*)value.data); return true;
+	case mtpc_photoCachedSize: visitor(*(const MTPDphotoCachedSize*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPvideo::innerLength() const {
 	switch (_type) {
 		case mtpc_videoEmpty: {
-			const MTPDvideoEmpty &v(c_videoEmpty());
+			const MTPDvideoEmpty &v(*(const MTPDvideoEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_video: {
-			const MTPDvideo &v(c_video());
+			const MTPDvideo &v(*(const MTPDvideo*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vuser_id.innerLength() + v.vdate.innerLength() + v.vcaption.innerLength() + v.vduration.innerLength() + v.vmime_type.innerLength() + v.vsize.innerLength() + v.vthumb.innerLength() + v.vdc_id.innerLength() + v.vw.innerLength() + v.vh.innerLength();
 		}
 	}
@@ -19391,12 +19861,14 @@ inline void MTPvideo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_videoEmpty: _type = cons; {
 			if (!data) setData(new MTPDvideoEmpty());
-			MTPDvideoEmpty &v(_videoEmpty());
+			split();
+			MTPDvideoEmpty &v(*(MTPDvideoEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_video: _type = cons; {
 			if (!data) setData(new MTPDvideo());
-			MTPDvideo &v(_video());
+			split();
+			MTPDvideo &v(*(MTPDvideo*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vuser_id.read(from, end);
@@ -19416,11 +19888,11 @@ inline void MTPvideo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPvideo::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_videoEmpty: {
-			const MTPDvideoEmpty &v(c_videoEmpty());
+			const MTPDvideoEmpty &v(*(const MTPDvideoEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_video: {
-			const MTPDvideo &v(c_video());
+			const MTPDvideo &v(*(const MTPDvideo*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vuser_id.write(to);
@@ -19453,11 +19925,19 @@ inline MTPvideo MTP_videoEmpty(const MTPlong &_id) {
 inline MTPvideo MTP_video(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, const MTPstring &_caption, MTPint _duration, const MTPstring &_mime_type, MTPint _size, const MTPPhotoSize &_thumb, MTPint _dc_id, MTPint _w, MTPint _h) {
 	return MTPvideo(new MTPDvideo(_id, _access_hash, _user_id, _date, _caption, _duration, _mime_type, _size, _thumb, _dc_id, _w, _h));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPvideo &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_videoEmpty: visitor(*(const MTPDvideoEmpty*)value.data); return true;
+	case mtpc_video: visitor(*(const MTPDvideo*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPgeoPoint::innerLength() const {
 	switch (_type) {
 		case mtpc_geoPoint: {
-			const MTPDgeoPoint &v(c_geoPoint());
+			const MTPDgeoPoint &v(*(const MTPDgeoPoint*)data);
 			return v.vlong.innerLength() + v.vlat.innerLength();
 		}
 	}
@@ -19473,7 +19953,8 @@ inline void MTPgeoPoint::read(const mtpPrime *&from, const mtpPrime *end, mtpTyp
 		case mtpc_geoPointEmpty: _type = cons; break;
 		case mtpc_geoPoint: _type = cons; {
 			if (!data) setData(new MTPDgeoPoint());
-			MTPDgeoPoint &v(_geoPoint());
+			split();
+			MTPDgeoPoint &v(*(MTPDgeoPoint*)data);
 			v.vlong.read(from, end);
 			v.vlat.read(from, end);
 		} break;
@@ -19483,7 +19964,7 @@ inline void MTPgeoPoint::read(const mtpPrime *&from, const mtpPrime *end, mtpTyp
 inline void MTPgeoPoint::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_geoPoint: {
-			const MTPDgeoPoint &v(c_geoPoint());
+			const MTPDgeoPoint &v(*(const MTPDgeoPoint*)data);
 			v.vlong.write(to);
 			v.vlat.write(to);
 		} break;
@@ -19504,6 +19985,13 @@ inline MTPgeoPoint MTP_geoPointEmpty() {
 inline MTPgeoPoint MTP_geoPoint(const MTPdouble &_long, const MTPdouble &_lat) {
 	return MTPgeoPoint(new MTPDgeoPoint(_long, _lat));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPgeoPoint &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_geoPoint: visitor(*(const MTPDgeoPoint*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPauth_checkedPhone::MTPauth_checkedPhone() : mtpDataOwner(new MTPDauth_checkedPhone()) {
 }
@@ -19535,11 +20023,11 @@ inline MTPauth_checkedPhone MTP_auth_checkedPhone(MTPBool _phone_registered) {
 inline uint32 MTPauth_sentCode::innerLength() const {
 	switch (_type) {
 		case mtpc_auth_sentCode: {
-			const MTPDauth_sentCode &v(c_auth_sentCode());
+			const MTPDauth_sentCode &v(*(const MTPDauth_sentCode*)data);
 			return v.vphone_registered.innerLength() + v.vphone_code_hash.innerLength() + v.vsend_call_timeout.innerLength() + v.vis_password.innerLength();
 		}
 		case mtpc_auth_sentAppCode: {
-			const MTPDauth_sentAppCode &v(c_auth_sentAppCode());
+			const MTPDauth_sentAppCode &v(*(const MTPDauth_sentAppCode*)data);
 			return v.vphone_registered.innerLength() + v.vphone_code_hash.innerLength() + v.vsend_call_timeout.innerLength() + v.vis_password.innerLength();
 		}
 	}
@@ -19554,7 +20042,8 @@ inline void MTPauth_sentCode::read(const mtpPrime *&from, const mtpPrime *end, m
 	switch (cons) {
 		case mtpc_auth_sentCode: _type = cons; {
 			if (!data) setData(new MTPDauth_sentCode());
-			MTPDauth_sentCode &v(_auth_sentCode());
+			split();
+			MTPDauth_sentCode &v(*(MTPDauth_sentCode*)data);
 			v.vphone_registered.read(from, end);
 			v.vphone_code_hash.read(from, end);
 			v.vsend_call_timeout.read(from, end);
@@ -19562,7 +20051,8 @@ inline void MTPauth_sentCode::read(const mtpPrime *&from, const mtpPrime *end, m
 		} break;
 		case mtpc_auth_sentAppCode: _type = cons; {
 			if (!data) setData(new MTPDauth_sentAppCode());
-			MTPDauth_sentAppCode &v(_auth_sentAppCode());
+			split();
+			MTPDauth_sentAppCode &v(*(MTPDauth_sentAppCode*)data);
 			v.vphone_registered.read(from, end);
 			v.vphone_code_hash.read(from, end);
 			v.vsend_call_timeout.read(from, end);
@@ -19574,14 +20064,14 @@ inline void MTPauth_sentCode::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPauth_sentCode::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_auth_sentCode: {
-			const MTPDauth_sentCode &v(c_auth_sentCode());
+			const MTPDauth_sentCode &v(*(const MTPDauth_sentCode*)data);
 			v.vphone_registered.write(to);
 			v.vphone_code_hash.write(to);
 			v.vsend_call_timeout.write(to);
 			v.vis_password.write(to);
 		} break;
 		case mtpc_auth_sentAppCode: {
-			const MTPDauth_sentAppCode &v(c_auth_sentAppCode());
+			const MTPDauth_sentAppCode &v(*(const MTPDauth_sentAppCode*)data);
 			v.vphone_registered.write(to);
 			v.vphone_code_hash.write(to);
 			v.vsend_call_timeout.write(to);
@@ -19606,6 +20096,14 @@ inline MTPauth_sentCode MTP_auth_sentCode(MTPBool _phone_registered, const MTPst
 inline MTPauth_sentCode MTP_auth_sentAppCode(MTPBool _phone_registered, const MTPstring &_phone_code_hash, MTPint _send_call_timeout, MTPBool _is_password) {
 	return MTPauth_sentCode(new MTPDauth_sentAppCode(_phone_registered, _phone_code_hash, _send_call_timeout, _is_password));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPauth_sentCode &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_auth_sentCode: visitor(*(const MTPDauth_sentCode*)value.data); return true;
+	case mtpc_auth_sentAppCode: visitor(*(const MTPDauth_sentAppCode*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPauth_authorization::MTPauth_authorization() : mtpDataOwner(new MTPDauth_authorization()) {
 }
@@ -19668,11 +20166,11 @@ inline MTPauth_exportedAuthorization MTP_auth_exportedAuthorization(MTPint _id,
 inline uint32 MTPinputNotifyPeer::innerLength() const {
 	switch (_type) {
 		case mtpc_inputNotifyPeer: {
-			const MTPDinputNotifyPeer &v(c_inputNotifyPeer());
+			const MTPDinputNotifyPeer &v(*(const MTPDinputNotifyPeer*)data);
 			return v.vpeer.innerLength();
 		}
 		case mtpc_inputNotifyGeoChatPeer: {
-			const MTPDinputNotifyGeoChatPeer &v(c_inputNotifyGeoChatPeer());
+			const MTPDinputNotifyGeoChatPeer &v(*(const MTPDinputNotifyGeoChatPeer*)data);
 			return v.vpeer.innerLength();
 		}
 	}
@@ -19687,7 +20185,8 @@ inline void MTPinputNotifyPeer::read(const mtpPrime *&from, const mtpPrime *end,
 	switch (cons) {
 		case mtpc_inputNotifyPeer: _type = cons; {
 			if (!data) setData(new MTPDinputNotifyPeer());
-			MTPDinputNotifyPeer &v(_inputNotifyPeer());
+			split();
+			MTPDinputNotifyPeer &v(*(MTPDinputNotifyPeer*)data);
 			v.vpeer.read(from, end);
 		} break;
 		case mtpc_inputNotifyUsers: _type = cons; break;
@@ -19695,7 +20194,8 @@ inline void MTPinputNotifyPeer::read(const mtpPrime *&from, const mtpPrime *end,
 		case mtpc_inputNotifyAll: _type = cons; break;
 		case mtpc_inputNotifyGeoChatPeer: _type = cons; {
 			if (!data) setData(new MTPDinputNotifyGeoChatPeer());
-			MTPDinputNotifyGeoChatPeer &v(_inputNotifyGeoChatPeer());
+			split();
+			MTPDinputNotifyGeoChatPeer &v(*(MTPDinputNotifyGeoChatPeer*)data);
 			v.vpeer.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPinputNotifyPeer");
@@ -19704,11 +20204,11 @@ inline void MTPinputNotifyPeer::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPinputNotifyPeer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputNotifyPeer: {
-			const MTPDinputNotifyPeer &v(c_inputNotifyPeer());
+			const MTPDinputNotifyPeer &v(*(const MTPDinputNotifyPeer*)data);
 			v.vpeer.write(to);
 		} break;
 		case mtpc_inputNotifyGeoChatPeer: {
-			const MTPDinputNotifyGeoChatPeer &v(c_inputNotifyGeoChatPeer());
+			const MTPDinputNotifyGeoChatPeer &v(*(const MTPDinputNotifyGeoChatPeer*)data);
 			v.vpeer.write(to);
 		} break;
 	}
@@ -19742,6 +20242,14 @@ inline MTPinputNotifyPeer MTP_inputNotifyAll() {
 inline MTPinputNotifyPeer MTP_inputNotifyGeoChatPeer(const MTPInputGeoChat &_peer) {
 	return MTPinputNotifyPeer(new MTPDinputNotifyGeoChatPeer(_peer));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputNotifyPeer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputNotifyPeer: visitor(*(const MTPDinputNotifyPeer*)value.data); return true;
+	case mtpc_inputNotifyGeoChatPeer: visitor(*(const MTPDinputNotifyGeoChatPeer*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputPeerNotifyEvents::innerLength() const {
 	return 0;
@@ -19843,7 +20351,7 @@ inline MTPpeerNotifyEvents MTP_peerNotifyEventsAll() {
 inline uint32 MTPpeerNotifySettings::innerLength() const {
 	switch (_type) {
 		case mtpc_peerNotifySettings: {
-			const MTPDpeerNotifySettings &v(c_peerNotifySettings());
+			const MTPDpeerNotifySettings &v(*(const MTPDpeerNotifySettings*)data);
 			return v.vmute_until.innerLength() + v.vsound.innerLength() + v.vshow_previews.innerLength() + v.vevents_mask.innerLength();
 		}
 	}
@@ -19859,7 +20367,8 @@ inline void MTPpeerNotifySettings::read(const mtpPrime *&from, const mtpPrime *e
 		case mtpc_peerNotifySettingsEmpty: _type = cons; break;
 		case mtpc_peerNotifySettings: _type = cons; {
 			if (!data) setData(new MTPDpeerNotifySettings());
-			MTPDpeerNotifySettings &v(_peerNotifySettings());
+			split();
+			MTPDpeerNotifySettings &v(*(MTPDpeerNotifySettings*)data);
 			v.vmute_until.read(from, end);
 			v.vsound.read(from, end);
 			v.vshow_previews.read(from, end);
@@ -19871,7 +20380,7 @@ inline void MTPpeerNotifySettings::read(const mtpPrime *&from, const mtpPrime *e
 inline void MTPpeerNotifySettings::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_peerNotifySettings: {
-			const MTPDpeerNotifySettings &v(c_peerNotifySettings());
+			const MTPDpeerNotifySettings &v(*(const MTPDpeerNotifySettings*)data);
 			v.vmute_until.write(to);
 			v.vsound.write(to);
 			v.vshow_previews.write(to);
@@ -19894,15 +20403,22 @@ inline MTPpeerNotifySettings MTP_peerNotifySettingsEmpty() {
 inline MTPpeerNotifySettings MTP_peerNotifySettings(MTPint _mute_until, const MTPstring &_sound, MTPBool _show_previews, MTPint _events_mask) {
 	return MTPpeerNotifySettings(new MTPDpeerNotifySettings(_mute_until, _sound, _show_previews, _events_mask));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPpeerNotifySettings &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_peerNotifySettings: visitor(*(const MTPDpeerNotifySettings*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPwallPaper::innerLength() const {
 	switch (_type) {
 		case mtpc_wallPaper: {
-			const MTPDwallPaper &v(c_wallPaper());
+			const MTPDwallPaper &v(*(const MTPDwallPaper*)data);
 			return v.vid.innerLength() + v.vtitle.innerLength() + v.vsizes.innerLength() + v.vcolor.innerLength();
 		}
 		case mtpc_wallPaperSolid: {
-			const MTPDwallPaperSolid &v(c_wallPaperSolid());
+			const MTPDwallPaperSolid &v(*(const MTPDwallPaperSolid*)data);
 			return v.vid.innerLength() + v.vtitle.innerLength() + v.vbg_color.innerLength() + v.vcolor.innerLength();
 		}
 	}
@@ -19917,7 +20433,8 @@ inline void MTPwallPaper::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 	switch (cons) {
 		case mtpc_wallPaper: _type = cons; {
 			if (!data) setData(new MTPDwallPaper());
-			MTPDwallPaper &v(_wallPaper());
+			split();
+			MTPDwallPaper &v(*(MTPDwallPaper*)data);
 			v.vid.read(from, end);
 			v.vtitle.read(from, end);
 			v.vsizes.read(from, end);
@@ -19925,7 +20442,8 @@ inline void MTPwallPaper::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		} break;
 		case mtpc_wallPaperSolid: _type = cons; {
 			if (!data) setData(new MTPDwallPaperSolid());
-			MTPDwallPaperSolid &v(_wallPaperSolid());
+			split();
+			MTPDwallPaperSolid &v(*(MTPDwallPaperSolid*)data);
 			v.vid.read(from, end);
 			v.vtitle.read(from, end);
 			v.vbg_color.read(from, end);
@@ -19937,14 +20455,14 @@ inline void MTPwallPaper::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 inline void MTPwallPaper::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_wallPaper: {
-			const MTPDwallPaper &v(c_wallPaper());
+			const MTPDwallPaper &v(*(const MTPDwallPaper*)data);
 			v.vid.write(to);
 			v.vtitle.write(to);
 			v.vsizes.write(to);
 			v.vcolor.write(to);
 		} break;
 		case mtpc_wallPaperSolid: {
-			const MTPDwallPaperSolid &v(c_wallPaperSolid());
+			const MTPDwallPaperSolid &v(*(const MTPDwallPaperSolid*)data);
 			v.vid.write(to);
 			v.vtitle.write(to);
 			v.vbg_color.write(to);
@@ -19969,6 +20487,14 @@ inline MTPwallPaper MTP_wallPaper(MTPint _id, const MTPstring &_title, const MTP
 inline MTPwallPaper MTP_wallPaperSolid(MTPint _id, const MTPstring &_title, MTPint _bg_color, MTPint _color) {
 	return MTPwallPaper(new MTPDwallPaperSolid(_id, _title, _bg_color, _color));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPwallPaper &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_wallPaper: visitor(*(const MTPDwallPaper*)value.data); return true;
+	case mtpc_wallPaperSolid: visitor(*(const MTPDwallPaperSolid*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPuserFull::MTPuserFull() : mtpDataOwner(new MTPDuserFull()) {
 }
@@ -20217,7 +20743,7 @@ inline MTPcontacts_link MTP_contacts_link(const MTPContactLink &_my_link, const
 inline uint32 MTPcontacts_contacts::innerLength() const {
 	switch (_type) {
 		case mtpc_contacts_contacts: {
-			const MTPDcontacts_contacts &v(c_contacts_contacts());
+			const MTPDcontacts_contacts &v(*(const MTPDcontacts_contacts*)data);
 			return v.vcontacts.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -20233,7 +20759,8 @@ inline void MTPcontacts_contacts::read(const mtpPrime *&from, const mtpPrime *en
 		case mtpc_contacts_contactsNotModified: _type = cons; break;
 		case mtpc_contacts_contacts: _type = cons; {
 			if (!data) setData(new MTPDcontacts_contacts());
-			MTPDcontacts_contacts &v(_contacts_contacts());
+			split();
+			MTPDcontacts_contacts &v(*(MTPDcontacts_contacts*)data);
 			v.vcontacts.read(from, end);
 			v.vusers.read(from, end);
 		} break;
@@ -20243,7 +20770,7 @@ inline void MTPcontacts_contacts::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPcontacts_contacts::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_contacts_contacts: {
-			const MTPDcontacts_contacts &v(c_contacts_contacts());
+			const MTPDcontacts_contacts &v(*(const MTPDcontacts_contacts*)data);
 			v.vcontacts.write(to);
 			v.vusers.write(to);
 		} break;
@@ -20264,6 +20791,13 @@ inline MTPcontacts_contacts MTP_contacts_contactsNotModified() {
 inline MTPcontacts_contacts MTP_contacts_contacts(const MTPVector<MTPContact> &_contacts, const MTPVector<MTPUser> &_users) {
 	return MTPcontacts_contacts(new MTPDcontacts_contacts(_contacts, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPcontacts_contacts &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_contacts_contacts: visitor(*(const MTPDcontacts_contacts*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPcontacts_importedContacts::MTPcontacts_importedContacts() : mtpDataOwner(new MTPDcontacts_importedContacts()) {
 }
@@ -20299,11 +20833,11 @@ inline MTPcontacts_importedContacts MTP_contacts_importedContacts(const MTPVecto
 inline uint32 MTPcontacts_blocked::innerLength() const {
 	switch (_type) {
 		case mtpc_contacts_blocked: {
-			const MTPDcontacts_blocked &v(c_contacts_blocked());
+			const MTPDcontacts_blocked &v(*(const MTPDcontacts_blocked*)data);
 			return v.vblocked.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_contacts_blockedSlice: {
-			const MTPDcontacts_blockedSlice &v(c_contacts_blockedSlice());
+			const MTPDcontacts_blockedSlice &v(*(const MTPDcontacts_blockedSlice*)data);
 			return v.vcount.innerLength() + v.vblocked.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -20318,13 +20852,15 @@ inline void MTPcontacts_blocked::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_contacts_blocked: _type = cons; {
 			if (!data) setData(new MTPDcontacts_blocked());
-			MTPDcontacts_blocked &v(_contacts_blocked());
+			split();
+			MTPDcontacts_blocked &v(*(MTPDcontacts_blocked*)data);
 			v.vblocked.read(from, end);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_contacts_blockedSlice: _type = cons; {
 			if (!data) setData(new MTPDcontacts_blockedSlice());
-			MTPDcontacts_blockedSlice &v(_contacts_blockedSlice());
+			split();
+			MTPDcontacts_blockedSlice &v(*(MTPDcontacts_blockedSlice*)data);
 			v.vcount.read(from, end);
 			v.vblocked.read(from, end);
 			v.vusers.read(from, end);
@@ -20335,12 +20871,12 @@ inline void MTPcontacts_blocked::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPcontacts_blocked::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_contacts_blocked: {
-			const MTPDcontacts_blocked &v(c_contacts_blocked());
+			const MTPDcontacts_blocked &v(*(const MTPDcontacts_blocked*)data);
 			v.vblocked.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_contacts_blockedSlice: {
-			const MTPDcontacts_blockedSlice &v(c_contacts_blockedSlice());
+			const MTPDcontacts_blockedSlice &v(*(const MTPDcontacts_blockedSlice*)data);
 			v.vcount.write(to);
 			v.vblocked.write(to);
 			v.vusers.write(to);
@@ -20364,6 +20900,14 @@ inline MTPcontacts_blocked MTP_contacts_blocked(const MTPVector<MTPContactBlocke
 inline MTPcontacts_blocked MTP_contacts_blockedSlice(MTPint _count, const MTPVector<MTPContactBlocked> &_blocked, const MTPVector<MTPUser> &_users) {
 	return MTPcontacts_blocked(new MTPDcontacts_blockedSlice(_count, _blocked, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPcontacts_blocked &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_contacts_blocked: visitor(*(const MTPDcontacts_blocked*)value.data); return true;
+	case mtpc_contacts_blockedSlice: visitor(*(const MTPDcontacts_blockedSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPcontacts_suggested::MTPcontacts_suggested() : mtpDataOwner(new MTPDcontacts_suggested()) {
 }
@@ -20397,11 +20941,11 @@ inline MTPcontacts_suggested MTP_contacts_suggested(const MTPVector<MTPContactSu
 inline uint32 MTPmessages_dialogs::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_dialogs: {
-			const MTPDmessages_dialogs &v(c_messages_dialogs());
+			const MTPDmessages_dialogs &v(*(const MTPDmessages_dialogs*)data);
 			return v.vdialogs.innerLength() + v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_messages_dialogsSlice: {
-			const MTPDmessages_dialogsSlice &v(c_messages_dialogsSlice());
+			const MTPDmessages_dialogsSlice &v(*(const MTPDmessages_dialogsSlice*)data);
 			return v.vcount.innerLength() + v.vdialogs.innerLength() + v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -20416,7 +20960,8 @@ inline void MTPmessages_dialogs::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_messages_dialogs: _type = cons; {
 			if (!data) setData(new MTPDmessages_dialogs());
-			MTPDmessages_dialogs &v(_messages_dialogs());
+			split();
+			MTPDmessages_dialogs &v(*(MTPDmessages_dialogs*)data);
 			v.vdialogs.read(from, end);
 			v.vmessages.read(from, end);
 			v.vchats.read(from, end);
@@ -20424,7 +20969,8 @@ inline void MTPmessages_dialogs::read(const mtpPrime *&from, const mtpPrime *end
 		} break;
 		case mtpc_messages_dialogsSlice: _type = cons; {
 			if (!data) setData(new MTPDmessages_dialogsSlice());
-			MTPDmessages_dialogsSlice &v(_messages_dialogsSlice());
+			split();
+			MTPDmessages_dialogsSlice &v(*(MTPDmessages_dialogsSlice*)data);
 			v.vcount.read(from, end);
 			v.vdialogs.read(from, end);
 			v.vmessages.read(from, end);
@@ -20437,14 +20983,14 @@ inline void MTPmessages_dialogs::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPmessages_dialogs::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_dialogs: {
-			const MTPDmessages_dialogs &v(c_messages_dialogs());
+			const MTPDmessages_dialogs &v(*(const MTPDmessages_dialogs*)data);
 			v.vdialogs.write(to);
 			v.vmessages.write(to);
 			v.vchats.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_messages_dialogsSlice: {
-			const MTPDmessages_dialogsSlice &v(c_messages_dialogsSlice());
+			const MTPDmessages_dialogsSlice &v(*(const MTPDmessages_dialogsSlice*)data);
 			v.vcount.write(to);
 			v.vdialogs.write(to);
 			v.vmessages.write(to);
@@ -20470,15 +21016,23 @@ inline MTPmessages_dialogs MTP_messages_dialogs(const MTPVector<MTPDialog> &_dia
 inline MTPmessages_dialogs MTP_messages_dialogsSlice(MTPint _count, const MTPVector<MTPDialog> &_dialogs, const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users) {
 	return MTPmessages_dialogs(new MTPDmessages_dialogsSlice(_count, _dialogs, _messages, _chats, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_dialogs &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_dialogs: visitor(*(const MTPDmessages_dialogs*)value.data); return true;
+	case mtpc_messages_dialogsSlice: visitor(*(const MTPDmessages_dialogsSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessages_messages::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_messages: {
-			const MTPDmessages_messages &v(c_messages_messages());
+			const MTPDmessages_messages &v(*(const MTPDmessages_messages*)data);
 			return v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_messages_messagesSlice: {
-			const MTPDmessages_messagesSlice &v(c_messages_messagesSlice());
+			const MTPDmessages_messagesSlice &v(*(const MTPDmessages_messagesSlice*)data);
 			return v.vcount.innerLength() + v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -20493,14 +21047,16 @@ inline void MTPmessages_messages::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_messages_messages: _type = cons; {
 			if (!data) setData(new MTPDmessages_messages());
-			MTPDmessages_messages &v(_messages_messages());
+			split();
+			MTPDmessages_messages &v(*(MTPDmessages_messages*)data);
 			v.vmessages.read(from, end);
 			v.vchats.read(from, end);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_messages_messagesSlice: _type = cons; {
 			if (!data) setData(new MTPDmessages_messagesSlice());
-			MTPDmessages_messagesSlice &v(_messages_messagesSlice());
+			split();
+			MTPDmessages_messagesSlice &v(*(MTPDmessages_messagesSlice*)data);
 			v.vcount.read(from, end);
 			v.vmessages.read(from, end);
 			v.vchats.read(from, end);
@@ -20512,13 +21068,13 @@ inline void MTPmessages_messages::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPmessages_messages::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_messages: {
-			const MTPDmessages_messages &v(c_messages_messages());
+			const MTPDmessages_messages &v(*(const MTPDmessages_messages*)data);
 			v.vmessages.write(to);
 			v.vchats.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_messages_messagesSlice: {
-			const MTPDmessages_messagesSlice &v(c_messages_messagesSlice());
+			const MTPDmessages_messagesSlice &v(*(const MTPDmessages_messagesSlice*)data);
 			v.vcount.write(to);
 			v.vmessages.write(to);
 			v.vchats.write(to);
@@ -20543,6 +21099,14 @@ inline MTPmessages_messages MTP_messages_messages(const MTPVector<MTPMessage> &_
 inline MTPmessages_messages MTP_messages_messagesSlice(MTPint _count, const MTPVector<MTPMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users) {
 	return MTPmessages_messages(new MTPDmessages_messagesSlice(_count, _messages, _chats, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_messages &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_messages: visitor(*(const MTPDmessages_messages*)value.data); return true;
+	case mtpc_messages_messagesSlice: visitor(*(const MTPDmessages_messagesSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessages_message::innerLength() const {
 	return 0;
@@ -20561,11 +21125,11 @@ inline MTPmessages_message MTP_messages_messageEmpty() {
 inline uint32 MTPmessages_sentMessage::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_sentMessage: {
-			const MTPDmessages_sentMessage &v(c_messages_sentMessage());
+			const MTPDmessages_sentMessage &v(*(const MTPDmessages_sentMessage*)data);
 			return v.vid.innerLength() + v.vdate.innerLength() + v.vmedia.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_messages_sentMessageLink: {
-			const MTPDmessages_sentMessageLink &v(c_messages_sentMessageLink());
+			const MTPDmessages_sentMessageLink &v(*(const MTPDmessages_sentMessageLink*)data);
 			return v.vid.innerLength() + v.vdate.innerLength() + v.vmedia.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength() + v.vlinks.innerLength() + v.vseq.innerLength();
 		}
 	}
@@ -20580,7 +21144,8 @@ inline void MTPmessages_sentMessage::read(const mtpPrime *&from, const mtpPrime
 	switch (cons) {
 		case mtpc_messages_sentMessage: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentMessage());
-			MTPDmessages_sentMessage &v(_messages_sentMessage());
+			split();
+			MTPDmessages_sentMessage &v(*(MTPDmessages_sentMessage*)data);
 			v.vid.read(from, end);
 			v.vdate.read(from, end);
 			v.vmedia.read(from, end);
@@ -20589,7 +21154,8 @@ inline void MTPmessages_sentMessage::read(const mtpPrime *&from, const mtpPrime
 		} break;
 		case mtpc_messages_sentMessageLink: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentMessageLink());
-			MTPDmessages_sentMessageLink &v(_messages_sentMessageLink());
+			split();
+			MTPDmessages_sentMessageLink &v(*(MTPDmessages_sentMessageLink*)data);
 			v.vid.read(from, end);
 			v.vdate.read(from, end);
 			v.vmedia.read(from, end);
@@ -20604,7 +21170,7 @@ inline void MTPmessages_sentMessage::read(const mtpPrime *&from, const mtpPrime
 inline void MTPmessages_sentMessage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_sentMessage: {
-			const MTPDmessages_sentMessage &v(c_messages_sentMessage());
+			const MTPDmessages_sentMessage &v(*(const MTPDmessages_sentMessage*)data);
 			v.vid.write(to);
 			v.vdate.write(to);
 			v.vmedia.write(to);
@@ -20612,7 +21178,7 @@ inline void MTPmessages_sentMessage::write(mtpBuffer &to) const {
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_messages_sentMessageLink: {
-			const MTPDmessages_sentMessageLink &v(c_messages_sentMessageLink());
+			const MTPDmessages_sentMessageLink &v(*(const MTPDmessages_sentMessageLink*)data);
 			v.vid.write(to);
 			v.vdate.write(to);
 			v.vmedia.write(to);
@@ -20640,6 +21206,14 @@ inline MTPmessages_sentMessage MTP_messages_sentMessage(MTPint _id, MTPint _date
 inline MTPmessages_sentMessage MTP_messages_sentMessageLink(MTPint _id, MTPint _date, const MTPMessageMedia &_media, MTPint _pts, MTPint _pts_count, const MTPVector<MTPcontacts_Link> &_links, MTPint _seq) {
 	return MTPmessages_sentMessage(new MTPDmessages_sentMessageLink(_id, _date, _media, _pts, _pts_count, _links, _seq));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_sentMessage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_sentMessage: visitor(*(const MTPDmessages_sentMessage*)value.data); return true;
+	case mtpc_messages_sentMessageLink: visitor(*(const MTPDmessages_sentMessageLink*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPmessages_chats::MTPmessages_chats() : mtpDataOwner(new MTPDmessages_chats()) {
 }
@@ -20790,119 +21364,119 @@ inline MTPmessagesFilter MTP_inputMessagesFilterAudio() {
 inline uint32 MTPupdate::innerLength() const {
 	switch (_type) {
 		case mtpc_updateNewMessage: {
-			const MTPDupdateNewMessage &v(c_updateNewMessage());
+			const MTPDupdateNewMessage &v(*(const MTPDupdateNewMessage*)data);
 			return v.vmessage.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_updateMessageID: {
-			const MTPDupdateMessageID &v(c_updateMessageID());
+			const MTPDupdateMessageID &v(*(const MTPDupdateMessageID*)data);
 			return v.vid.innerLength() + v.vrandom_id.innerLength();
 		}
 		case mtpc_updateReadMessages: {
-			const MTPDupdateReadMessages &v(c_updateReadMessages());
+			const MTPDupdateReadMessages &v(*(const MTPDupdateReadMessages*)data);
 			return v.vmessages.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_updateDeleteMessages: {
-			const MTPDupdateDeleteMessages &v(c_updateDeleteMessages());
+			const MTPDupdateDeleteMessages &v(*(const MTPDupdateDeleteMessages*)data);
 			return v.vmessages.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_updateUserTyping: {
-			const MTPDupdateUserTyping &v(c_updateUserTyping());
+			const MTPDupdateUserTyping &v(*(const MTPDupdateUserTyping*)data);
 			return v.vuser_id.innerLength() + v.vaction.innerLength();
 		}
 		case mtpc_updateChatUserTyping: {
-			const MTPDupdateChatUserTyping &v(c_updateChatUserTyping());
+			const MTPDupdateChatUserTyping &v(*(const MTPDupdateChatUserTyping*)data);
 			return v.vchat_id.innerLength() + v.vuser_id.innerLength() + v.vaction.innerLength();
 		}
 		case mtpc_updateChatParticipants: {
-			const MTPDupdateChatParticipants &v(c_updateChatParticipants());
+			const MTPDupdateChatParticipants &v(*(const MTPDupdateChatParticipants*)data);
 			return v.vparticipants.innerLength();
 		}
 		case mtpc_updateUserStatus: {
-			const MTPDupdateUserStatus &v(c_updateUserStatus());
+			const MTPDupdateUserStatus &v(*(const MTPDupdateUserStatus*)data);
 			return v.vuser_id.innerLength() + v.vstatus.innerLength();
 		}
 		case mtpc_updateUserName: {
-			const MTPDupdateUserName &v(c_updateUserName());
+			const MTPDupdateUserName &v(*(const MTPDupdateUserName*)data);
 			return v.vuser_id.innerLength() + v.vfirst_name.innerLength() + v.vlast_name.innerLength() + v.vusername.innerLength();
 		}
 		case mtpc_updateUserPhoto: {
-			const MTPDupdateUserPhoto &v(c_updateUserPhoto());
+			const MTPDupdateUserPhoto &v(*(const MTPDupdateUserPhoto*)data);
 			return v.vuser_id.innerLength() + v.vdate.innerLength() + v.vphoto.innerLength() + v.vprevious.innerLength();
 		}
 		case mtpc_updateContactRegistered: {
-			const MTPDupdateContactRegistered &v(c_updateContactRegistered());
+			const MTPDupdateContactRegistered &v(*(const MTPDupdateContactRegistered*)data);
 			return v.vuser_id.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_updateContactLink: {
-			const MTPDupdateContactLink &v(c_updateContactLink());
+			const MTPDupdateContactLink &v(*(const MTPDupdateContactLink*)data);
 			return v.vuser_id.innerLength() + v.vmy_link.innerLength() + v.vforeign_link.innerLength();
 		}
 		case mtpc_updateNewAuthorization: {
-			const MTPDupdateNewAuthorization &v(c_updateNewAuthorization());
+			const MTPDupdateNewAuthorization &v(*(const MTPDupdateNewAuthorization*)data);
 			return v.vauth_key_id.innerLength() + v.vdate.innerLength() + v.vdevice.innerLength() + v.vlocation.innerLength();
 		}
 		case mtpc_updateNewGeoChatMessage: {
-			const MTPDupdateNewGeoChatMessage &v(c_updateNewGeoChatMessage());
+			const MTPDupdateNewGeoChatMessage &v(*(const MTPDupdateNewGeoChatMessage*)data);
 			return v.vmessage.innerLength();
 		}
 		case mtpc_updateNewEncryptedMessage: {
-			const MTPDupdateNewEncryptedMessage &v(c_updateNewEncryptedMessage());
+			const MTPDupdateNewEncryptedMessage &v(*(const MTPDupdateNewEncryptedMessage*)data);
 			return v.vmessage.innerLength() + v.vqts.innerLength();
 		}
 		case mtpc_updateEncryptedChatTyping: {
-			const MTPDupdateEncryptedChatTyping &v(c_updateEncryptedChatTyping());
+			const MTPDupdateEncryptedChatTyping &v(*(const MTPDupdateEncryptedChatTyping*)data);
 			return v.vchat_id.innerLength();
 		}
 		case mtpc_updateEncryption: {
-			const MTPDupdateEncryption &v(c_updateEncryption());
+			const MTPDupdateEncryption &v(*(const MTPDupdateEncryption*)data);
 			return v.vchat.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_updateEncryptedMessagesRead: {
-			const MTPDupdateEncryptedMessagesRead &v(c_updateEncryptedMessagesRead());
+			const MTPDupdateEncryptedMessagesRead &v(*(const MTPDupdateEncryptedMessagesRead*)data);
 			return v.vchat_id.innerLength() + v.vmax_date.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_updateChatParticipantAdd: {
-			const MTPDupdateChatParticipantAdd &v(c_updateChatParticipantAdd());
+			const MTPDupdateChatParticipantAdd &v(*(const MTPDupdateChatParticipantAdd*)data);
 			return v.vchat_id.innerLength() + v.vuser_id.innerLength() + v.vinviter_id.innerLength() + v.vversion.innerLength();
 		}
 		case mtpc_updateChatParticipantDelete: {
-			const MTPDupdateChatParticipantDelete &v(c_updateChatParticipantDelete());
+			const MTPDupdateChatParticipantDelete &v(*(const MTPDupdateChatParticipantDelete*)data);
 			return v.vchat_id.innerLength() + v.vuser_id.innerLength() + v.vversion.innerLength();
 		}
 		case mtpc_updateDcOptions: {
-			const MTPDupdateDcOptions &v(c_updateDcOptions());
+			const MTPDupdateDcOptions &v(*(const MTPDupdateDcOptions*)data);
 			return v.vdc_options.innerLength();
 		}
 		case mtpc_updateUserBlocked: {
-			const MTPDupdateUserBlocked &v(c_updateUserBlocked());
+			const MTPDupdateUserBlocked &v(*(const MTPDupdateUserBlocked*)data);
 			return v.vuser_id.innerLength() + v.vblocked.innerLength();
 		}
 		case mtpc_updateNotifySettings: {
-			const MTPDupdateNotifySettings &v(c_updateNotifySettings());
+			const MTPDupdateNotifySettings &v(*(const MTPDupdateNotifySettings*)data);
 			return v.vpeer.innerLength() + v.vnotify_settings.innerLength();
 		}
 		case mtpc_updateServiceNotification: {
-			const MTPDupdateServiceNotification &v(c_updateServiceNotification());
+			const MTPDupdateServiceNotification &v(*(const MTPDupdateServiceNotification*)data);
 			return v.vtype.innerLength() + v.vmessage.innerLength() + v.vmedia.innerLength() + v.vpopup.innerLength();
 		}
 		case mtpc_updatePrivacy: {
-			const MTPDupdatePrivacy &v(c_updatePrivacy());
+			const MTPDupdatePrivacy &v(*(const MTPDupdatePrivacy*)data);
 			return v.vkey.innerLength() + v.vrules.innerLength();
 		}
 		case mtpc_updateUserPhone: {
-			const MTPDupdateUserPhone &v(c_updateUserPhone());
+			const MTPDupdateUserPhone &v(*(const MTPDupdateUserPhone*)data);
 			return v.vuser_id.innerLength() + v.vphone.innerLength();
 		}
 		case mtpc_updateReadHistoryInbox: {
-			const MTPDupdateReadHistoryInbox &v(c_updateReadHistoryInbox());
+			const MTPDupdateReadHistoryInbox &v(*(const MTPDupdateReadHistoryInbox*)data);
 			return v.vpeer.innerLength() + v.vmax_id.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_updateReadHistoryOutbox: {
-			const MTPDupdateReadHistoryOutbox &v(c_updateReadHistoryOutbox());
+			const MTPDupdateReadHistoryOutbox &v(*(const MTPDupdateReadHistoryOutbox*)data);
 			return v.vpeer.innerLength() + v.vmax_id.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength();
 		}
 		case mtpc_updateWebPage: {
-			const MTPDupdateWebPage &v(c_updateWebPage());
+			const MTPDupdateWebPage &v(*(const MTPDupdateWebPage*)data);
 			return v.vwebpage.innerLength();
 		}
 	}
@@ -20917,58 +21491,67 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 	switch (cons) {
 		case mtpc_updateNewMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewMessage());
-			MTPDupdateNewMessage &v(_updateNewMessage());
+			split();
+			MTPDupdateNewMessage &v(*(MTPDupdateNewMessage*)data);
 			v.vmessage.read(from, end);
 			v.vpts.read(from, end);
 			v.vpts_count.read(from, end);
 		} break;
 		case mtpc_updateMessageID: _type = cons; {
 			if (!data) setData(new MTPDupdateMessageID());
-			MTPDupdateMessageID &v(_updateMessageID());
+			split();
+			MTPDupdateMessageID &v(*(MTPDupdateMessageID*)data);
 			v.vid.read(from, end);
 			v.vrandom_id.read(from, end);
 		} break;
 		case mtpc_updateReadMessages: _type = cons; {
 			if (!data) setData(new MTPDupdateReadMessages());
-			MTPDupdateReadMessages &v(_updateReadMessages());
+			split();
+			MTPDupdateReadMessages &v(*(MTPDupdateReadMessages*)data);
 			v.vmessages.read(from, end);
 			v.vpts.read(from, end);
 			v.vpts_count.read(from, end);
 		} break;
 		case mtpc_updateDeleteMessages: _type = cons; {
 			if (!data) setData(new MTPDupdateDeleteMessages());
-			MTPDupdateDeleteMessages &v(_updateDeleteMessages());
+			split();
+			MTPDupdateDeleteMessages &v(*(MTPDupdateDeleteMessages*)data);
 			v.vmessages.read(from, end);
 			v.vpts.read(from, end);
 			v.vpts_count.read(from, end);
 		} break;
 		case mtpc_updateUserTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateUserTyping());
-			MTPDupdateUserTyping &v(_updateUserTyping());
+			split();
+			MTPDupdateUserTyping &v(*(MTPDupdateUserTyping*)data);
 			v.vuser_id.read(from, end);
 			v.vaction.read(from, end);
 		} break;
 		case mtpc_updateChatUserTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateChatUserTyping());
-			MTPDupdateChatUserTyping &v(_updateChatUserTyping());
+			split();
+			MTPDupdateChatUserTyping &v(*(MTPDupdateChatUserTyping*)data);
 			v.vchat_id.read(from, end);
 			v.vuser_id.read(from, end);
 			v.vaction.read(from, end);
 		} break;
 		case mtpc_updateChatParticipants: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipants());
-			MTPDupdateChatParticipants &v(_updateChatParticipants());
+			split();
+			MTPDupdateChatParticipants &v(*(MTPDupdateChatParticipants*)data);
 			v.vparticipants.read(from, end);
 		} break;
 		case mtpc_updateUserStatus: _type = cons; {
 			if (!data) setData(new MTPDupdateUserStatus());
-			MTPDupdateUserStatus &v(_updateUserStatus());
+			split();
+			MTPDupdateUserStatus &v(*(MTPDupdateUserStatus*)data);
 			v.vuser_id.read(from, end);
 			v.vstatus.read(from, end);
 		} break;
 		case mtpc_updateUserName: _type = cons; {
 			if (!data) setData(new MTPDupdateUserName());
-			MTPDupdateUserName &v(_updateUserName());
+			split();
+			MTPDupdateUserName &v(*(MTPDupdateUserName*)data);
 			v.vuser_id.read(from, end);
 			v.vfirst_name.read(from, end);
 			v.vlast_name.read(from, end);
@@ -20976,7 +21559,8 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateUserPhoto: _type = cons; {
 			if (!data) setData(new MTPDupdateUserPhoto());
-			MTPDupdateUserPhoto &v(_updateUserPhoto());
+			split();
+			MTPDupdateUserPhoto &v(*(MTPDupdateUserPhoto*)data);
 			v.vuser_id.read(from, end);
 			v.vdate.read(from, end);
 			v.vphoto.read(from, end);
@@ -20984,20 +21568,23 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateContactRegistered: _type = cons; {
 			if (!data) setData(new MTPDupdateContactRegistered());
-			MTPDupdateContactRegistered &v(_updateContactRegistered());
+			split();
+			MTPDupdateContactRegistered &v(*(MTPDupdateContactRegistered*)data);
 			v.vuser_id.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_updateContactLink: _type = cons; {
 			if (!data) setData(new MTPDupdateContactLink());
-			MTPDupdateContactLink &v(_updateContactLink());
+			split();
+			MTPDupdateContactLink &v(*(MTPDupdateContactLink*)data);
 			v.vuser_id.read(from, end);
 			v.vmy_link.read(from, end);
 			v.vforeign_link.read(from, end);
 		} break;
 		case mtpc_updateNewAuthorization: _type = cons; {
 			if (!data) setData(new MTPDupdateNewAuthorization());
-			MTPDupdateNewAuthorization &v(_updateNewAuthorization());
+			split();
+			MTPDupdateNewAuthorization &v(*(MTPDupdateNewAuthorization*)data);
 			v.vauth_key_id.read(from, end);
 			v.vdate.read(from, end);
 			v.vdevice.read(from, end);
@@ -21005,36 +21592,42 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateNewGeoChatMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewGeoChatMessage());
-			MTPDupdateNewGeoChatMessage &v(_updateNewGeoChatMessage());
+			split();
+			MTPDupdateNewGeoChatMessage &v(*(MTPDupdateNewGeoChatMessage*)data);
 			v.vmessage.read(from, end);
 		} break;
 		case mtpc_updateNewEncryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewEncryptedMessage());
-			MTPDupdateNewEncryptedMessage &v(_updateNewEncryptedMessage());
+			split();
+			MTPDupdateNewEncryptedMessage &v(*(MTPDupdateNewEncryptedMessage*)data);
 			v.vmessage.read(from, end);
 			v.vqts.read(from, end);
 		} break;
 		case mtpc_updateEncryptedChatTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryptedChatTyping());
-			MTPDupdateEncryptedChatTyping &v(_updateEncryptedChatTyping());
+			split();
+			MTPDupdateEncryptedChatTyping &v(*(MTPDupdateEncryptedChatTyping*)data);
 			v.vchat_id.read(from, end);
 		} break;
 		case mtpc_updateEncryption: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryption());
-			MTPDupdateEncryption &v(_updateEncryption());
+			split();
+			MTPDupdateEncryption &v(*(MTPDupdateEncryption*)data);
 			v.vchat.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_updateEncryptedMessagesRead: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryptedMessagesRead());
-			MTPDupdateEncryptedMessagesRead &v(_updateEncryptedMessagesRead());
+			split();
+			MTPDupdateEncryptedMessagesRead &v(*(MTPDupdateEncryptedMessagesRead*)data);
 			v.vchat_id.read(from, end);
 			v.vmax_date.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_updateChatParticipantAdd: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipantAdd());
-			MTPDupdateChatParticipantAdd &v(_updateChatParticipantAdd());
+			split();
+			MTPDupdateChatParticipantAdd &v(*(MTPDupdateChatParticipantAdd*)data);
 			v.vchat_id.read(from, end);
 			v.vuser_id.read(from, end);
 			v.vinviter_id.read(from, end);
@@ -21042,31 +21635,36 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateChatParticipantDelete: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipantDelete());
-			MTPDupdateChatParticipantDelete &v(_updateChatParticipantDelete());
+			split();
+			MTPDupdateChatParticipantDelete &v(*(MTPDupdateChatParticipantDelete*)data);
 			v.vchat_id.read(from, end);
 			v.vuser_id.read(from, end);
 			v.vversion.read(from, end);
 		} break;
 		case mtpc_updateDcOptions: _type = cons; {
 			if (!data) setData(new MTPDupdateDcOptions());
-			MTPDupdateDcOptions &v(_updateDcOptions());
+			split();
+			MTPDupdateDcOptions &v(*(MTPDupdateDcOptions*)data);
 			v.vdc_options.read(from, end);
 		} break;
 		case mtpc_updateUserBlocked: _type = cons; {
 			if (!data) setData(new MTPDupdateUserBlocked());
-			MTPDupdateUserBlocked &v(_updateUserBlocked());
+			split();
+			MTPDupdateUserBlocked &v(*(MTPDupdateUserBlocked*)data);
 			v.vuser_id.read(from, end);
 			v.vblocked.read(from, end);
 		} break;
 		case mtpc_updateNotifySettings: _type = cons; {
 			if (!data) setData(new MTPDupdateNotifySettings());
-			MTPDupdateNotifySettings &v(_updateNotifySettings());
+			split();
+			MTPDupdateNotifySettings &v(*(MTPDupdateNotifySettings*)data);
 			v.vpeer.read(from, end);
 			v.vnotify_settings.read(from, end);
 		} break;
 		case mtpc_updateServiceNotification: _type = cons; {
 			if (!data) setData(new MTPDupdateServiceNotification());
-			MTPDupdateServiceNotification &v(_updateServiceNotification());
+			split();
+			MTPDupdateServiceNotification &v(*(MTPDupdateServiceNotification*)data);
 			v.vtype.read(from, end);
 			v.vmessage.read(from, end);
 			v.vmedia.read(from, end);
@@ -21074,19 +21672,22 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updatePrivacy: _type = cons; {
 			if (!data) setData(new MTPDupdatePrivacy());
-			MTPDupdatePrivacy &v(_updatePrivacy());
+			split();
+			MTPDupdatePrivacy &v(*(MTPDupdatePrivacy*)data);
 			v.vkey.read(from, end);
 			v.vrules.read(from, end);
 		} break;
 		case mtpc_updateUserPhone: _type = cons; {
 			if (!data) setData(new MTPDupdateUserPhone());
-			MTPDupdateUserPhone &v(_updateUserPhone());
+			split();
+			MTPDupdateUserPhone &v(*(MTPDupdateUserPhone*)data);
 			v.vuser_id.read(from, end);
 			v.vphone.read(from, end);
 		} break;
 		case mtpc_updateReadHistoryInbox: _type = cons; {
 			if (!data) setData(new MTPDupdateReadHistoryInbox());
-			MTPDupdateReadHistoryInbox &v(_updateReadHistoryInbox());
+			split();
+			MTPDupdateReadHistoryInbox &v(*(MTPDupdateReadHistoryInbox*)data);
 			v.vpeer.read(from, end);
 			v.vmax_id.read(from, end);
 			v.vpts.read(from, end);
@@ -21094,7 +21695,8 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateReadHistoryOutbox: _type = cons; {
 			if (!data) setData(new MTPDupdateReadHistoryOutbox());
-			MTPDupdateReadHistoryOutbox &v(_updateReadHistoryOutbox());
+			split();
+			MTPDupdateReadHistoryOutbox &v(*(MTPDupdateReadHistoryOutbox*)data);
 			v.vpeer.read(from, end);
 			v.vmax_id.read(from, end);
 			v.vpts.read(from, end);
@@ -21102,7 +21704,8 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 		} break;
 		case mtpc_updateWebPage: _type = cons; {
 			if (!data) setData(new MTPDupdateWebPage());
-			MTPDupdateWebPage &v(_updateWebPage());
+			split();
+			MTPDupdateWebPage &v(*(MTPDupdateWebPage*)data);
 			v.vwebpage.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPupdate");
@@ -21111,164 +21714,164 @@ inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeI
 inline void MTPupdate::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_updateNewMessage: {
-			const MTPDupdateNewMessage &v(c_updateNewMessage());
+			const MTPDupdateNewMessage &v(*(const MTPDupdateNewMessage*)data);
 			v.vmessage.write(to);
 			v.vpts.write(to);
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_updateMessageID: {
-			const MTPDupdateMessageID &v(c_updateMessageID());
+			const MTPDupdateMessageID &v(*(const MTPDupdateMessageID*)data);
 			v.vid.write(to);
 			v.vrandom_id.write(to);
 		} break;
 		case mtpc_updateReadMessages: {
-			const MTPDupdateReadMessages &v(c_updateReadMessages());
+			const MTPDupdateReadMessages &v(*(const MTPDupdateReadMessages*)data);
 			v.vmessages.write(to);
 			v.vpts.write(to);
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_updateDeleteMessages: {
-			const MTPDupdateDeleteMessages &v(c_updateDeleteMessages());
+			const MTPDupdateDeleteMessages &v(*(const MTPDupdateDeleteMessages*)data);
 			v.vmessages.write(to);
 			v.vpts.write(to);
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_updateUserTyping: {
-			const MTPDupdateUserTyping &v(c_updateUserTyping());
+			const MTPDupdateUserTyping &v(*(const MTPDupdateUserTyping*)data);
 			v.vuser_id.write(to);
 			v.vaction.write(to);
 		} break;
 		case mtpc_updateChatUserTyping: {
-			const MTPDupdateChatUserTyping &v(c_updateChatUserTyping());
+			const MTPDupdateChatUserTyping &v(*(const MTPDupdateChatUserTyping*)data);
 			v.vchat_id.write(to);
 			v.vuser_id.write(to);
 			v.vaction.write(to);
 		} break;
 		case mtpc_updateChatParticipants: {
-			const MTPDupdateChatParticipants &v(c_updateChatParticipants());
+			const MTPDupdateChatParticipants &v(*(const MTPDupdateChatParticipants*)data);
 			v.vparticipants.write(to);
 		} break;
 		case mtpc_updateUserStatus: {
-			const MTPDupdateUserStatus &v(c_updateUserStatus());
+			const MTPDupdateUserStatus &v(*(const MTPDupdateUserStatus*)data);
 			v.vuser_id.write(to);
 			v.vstatus.write(to);
 		} break;
 		case mtpc_updateUserName: {
-			const MTPDupdateUserName &v(c_updateUserName());
+			const MTPDupdateUserName &v(*(const MTPDupdateUserName*)data);
 			v.vuser_id.write(to);
 			v.vfirst_name.write(to);
 			v.vlast_name.write(to);
 			v.vusername.write(to);
 		} break;
 		case mtpc_updateUserPhoto: {
-			const MTPDupdateUserPhoto &v(c_updateUserPhoto());
+			const MTPDupdateUserPhoto &v(*(const MTPDupdateUserPhoto*)data);
 			v.vuser_id.write(to);
 			v.vdate.write(to);
 			v.vphoto.write(to);
 			v.vprevious.write(to);
 		} break;
 		case mtpc_updateContactRegistered: {
-			const MTPDupdateContactRegistered &v(c_updateContactRegistered());
+			const MTPDupdateContactRegistered &v(*(const MTPDupdateContactRegistered*)data);
 			v.vuser_id.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_updateContactLink: {
-			const MTPDupdateContactLink &v(c_updateContactLink());
+			const MTPDupdateContactLink &v(*(const MTPDupdateContactLink*)data);
 			v.vuser_id.write(to);
 			v.vmy_link.write(to);
 			v.vforeign_link.write(to);
 		} break;
 		case mtpc_updateNewAuthorization: {
-			const MTPDupdateNewAuthorization &v(c_updateNewAuthorization());
+			const MTPDupdateNewAuthorization &v(*(const MTPDupdateNewAuthorization*)data);
 			v.vauth_key_id.write(to);
 			v.vdate.write(to);
 			v.vdevice.write(to);
 			v.vlocation.write(to);
 		} break;
 		case mtpc_updateNewGeoChatMessage: {
-			const MTPDupdateNewGeoChatMessage &v(c_updateNewGeoChatMessage());
+			const MTPDupdateNewGeoChatMessage &v(*(const MTPDupdateNewGeoChatMessage*)data);
 			v.vmessage.write(to);
 		} break;
 		case mtpc_updateNewEncryptedMessage: {
-			const MTPDupdateNewEncryptedMessage &v(c_updateNewEncryptedMessage());
+			const MTPDupdateNewEncryptedMessage &v(*(const MTPDupdateNewEncryptedMessage*)data);
 			v.vmessage.write(to);
 			v.vqts.write(to);
 		} break;
 		case mtpc_updateEncryptedChatTyping: {
-			const MTPDupdateEncryptedChatTyping &v(c_updateEncryptedChatTyping());
+			const MTPDupdateEncryptedChatTyping &v(*(const MTPDupdateEncryptedChatTyping*)data);
 			v.vchat_id.write(to);
 		} break;
 		case mtpc_updateEncryption: {
-			const MTPDupdateEncryption &v(c_updateEncryption());
+			const MTPDupdateEncryption &v(*(const MTPDupdateEncryption*)data);
 			v.vchat.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_updateEncryptedMessagesRead: {
-			const MTPDupdateEncryptedMessagesRead &v(c_updateEncryptedMessagesRead());
+			const MTPDupdateEncryptedMessagesRead &v(*(const MTPDupdateEncryptedMessagesRead*)data);
 			v.vchat_id.write(to);
 			v.vmax_date.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_updateChatParticipantAdd: {
-			const MTPDupdateChatParticipantAdd &v(c_updateChatParticipantAdd());
+			const MTPDupdateChatParticipantAdd &v(*(const MTPDupdateChatParticipantAdd*)data);
 			v.vchat_id.write(to);
 			v.vuser_id.write(to);
 			v.vinviter_id.write(to);
 			v.vversion.write(to);
 		} break;
 		case mtpc_updateChatParticipantDelete: {
-			const MTPDupdateChatParticipantDelete &v(c_updateChatParticipantDelete());
+			const MTPDupdateChatParticipantDelete &v(*(const MTPDupdateChatParticipantDelete*)data);
 			v.vchat_id.write(to);
 			v.vuser_id.write(to);
 			v.vversion.write(to);
 		} break;
 		case mtpc_updateDcOptions: {
-			const MTPDupdateDcOptions &v(c_updateDcOptions());
+			const MTPDupdateDcOptions &v(*(const MTPDupdateDcOptions*)data);
 			v.vdc_options.write(to);
 		} break;
 		case mtpc_updateUserBlocked: {
-			const MTPDupdateUserBlocked &v(c_updateUserBlocked());
+			const MTPDupdateUserBlocked &v(*(const MTPDupdateUserBlocked*)data);
 			v.vuser_id.write(to);
 			v.vblocked.write(to);
 		} break;
 		case mtpc_updateNotifySettings: {
-			const MTPDupdateNotifySettings &v(c_updateNotifySettings());
+			const MTPDupdateNotifySettings &v(*(const MTPDupdateNotifySettings*)data);
 			v.vpeer.write(to);
 			v.vnotify_settings.write(to);
 		} break;
 		case mtpc_updateServiceNotification: {
-			const MTPDupdateServiceNotification &v(c_updateServiceNotification());
+			const MTPDupdateServiceNotification &v(*(const MTPDupdateServiceNotification*)data);
 			v.vtype.write(to);
 			v.vmessage.write(to);
 			v.vmedia.write(to);
 			v.vpopup.write(to);
 		} break;
 		case mtpc_updatePrivacy: {
-			const MTPDupdatePrivacy &v(c_updatePrivacy());
+			const MTPDupdatePrivacy &v(*(const MTPDupdatePrivacy*)data);
 			v.vkey.write(to);
 			v.vrules.write(to);
 		} break;
 		case mtpc_updateUserPhone: {
-			const MTPDupdateUserPhone &v(c_updateUserPhone());
+			const MTPDupdateUserPhone &v(*(const MTPDupdateUserPhone*)data);
 			v.vuser_id.write(to);
 			v.vphone.write(to);
 		} break;
 		case mtpc_updateReadHistoryInbox: {
-			const MTPDupdateReadHistoryInbox &v(c_updateReadHistoryInbox());
+			const MTPDupdateReadHistoryInbox &v(*(const MTPDupdateReadHistoryInbox*)data);
 			v.vpeer.write(to);
 			v.vmax_id.write(to);
 			v.vpts.write(to);
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_updateReadHistoryOutbox: {
-			const MTPDupdateReadHistoryOutbox &v(c_updateReadHistoryOutbox());
+			const MTPDupdateReadHistoryOutbox &v(*(const MTPDupdateReadHistoryOutbox*)data);
 			v.vpeer.write(to);
 			v.vmax_id.write(to);
 			v.vpts.write(to);
 			v.vpts_count.write(to);
 		} break;
 		case mtpc_updateWebPage: {
-			const MTPDupdateWebPage &v(c_updateWebPage());
+			const MTPDupdateWebPage &v(*(const MTPDupdateWebPage*)data);
 			v.vwebpage.write(to);
 		} break;
 	}
@@ -21452,6 +22055,41 @@ inline MTPupdate MTP_updateReadHistoryOutbox(const MTPPeer &_peer, MTPint _max_i
 inline MTPupdate MTP_updateWebPage(const MTPWebPage &_webpage) {
 	return MTPupdate(new MTPDupdateWebPage(_webpage));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPupdate &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_updateNewMessage: visitor(*(const MTPDupdateNewMessage*)value.data); return true;
+	case mtpc_updateMessageID: visitor(*(const MTPDupdateMessageID*)value.data); return true;
+	case mtpc_updateReadMessages: visitor(*(const MTPDupdateReadMessages*)value.data); return true;
+	case mtpc_updateDeleteMessages: visitor(*(const MTPDupdateDeleteMessages*)value.data); return true;
+	case mtpc_updateUserTyping: visitor(*(const MTPDupdateUserTyping*)value.data); return true;
+	case mtpc_updateChatUserTyping: visitor(*(const MTPDupdateChatUserTyping*)value.data); return true;
+	case mtpc_updateChatParticipants: visitor(*(const MTPDupdateChatParticipants*)value.data); return true;
+	case mtpc_updateUserStatus: visitor(*(const MTPDupdateUserStatus*)value.data); return true;
+	case mtpc_updateUserName: visitor(*(const MTPDupdateUserName*)value.data); return true;
+	case mtpc_updateUserPhoto: visitor(*(const MTPDupdateUserPhoto*)value.data); return true;
+	case mtpc_updateContactRegistered: visitor(*(const MTPDupdateContactRegistered*)value.data); return true;
+	case mtpc_updateContactLink: visitor(*(const MTPDupdateContactLink*)value.data); return true;
+	case mtpc_updateNewAuthorization: visitor(*(const MTPDupdateNewAuthorization*)value.data); return true;
+	case mtpc_updateNewGeoChatMessage: visitor(*(const MTPDupdateNewGeoChatMessage*)value.data); return true;
+	case mtpc_updateNewEncryptedMessage: visitor(*(const MTPDupdateNewEncryptedMessage*)value.data); return true;
+	case mtpc_updateEncryptedChatTyping: visitor(*(const MTPDupdateEncryptedChatTyping*)value.data); return true;
+	case mtpc_updateEncryption: visitor(*(const MTPDupdateEncryption*)value.data); return true;
+	case mtpc_updateEncryptedMessagesRead: visitor(*(const MTPDupdateEncryptedMessagesRead*)value.data); return true;
+	case mtpc_updateChatParticipantAdd: visitor(*(const MTPDupdateChatParticipantAdd*)value.data); return true;
+	case mtpc_updateChatParticipantDelete: visitor(*(const MTPDupdateChatParticipantDelete*)value.data); return true;
+	case mtpc_updateDcOptions: visitor(*(const MTPDupdateDcOptions*)value.data); return true;
+	case mtpc_updateUserBlocked: visitor(*(const MTPDupdateUserBlocked*)value.data); return true;
+	case mtpc_updateNotifySettings: visitor(*(const MTPDupdateNotifySettings*)value.data); return true;
+	case mtpc_updateServiceNotification: visitor(*(const MTPDupdateServiceNotification*)value.data); return true;
+	case mtpc_updatePrivacy: visitor(*(const MTPDupdatePrivacy*)value.data); return true;
+	case mtpc_updateUserPhone: visitor(*(const MTPDupdateUserPhone*)value.data); return true;
+	case mtpc_updateReadHistoryInbox: visitor(*(const MTPDupdateReadHistoryInbox*)value.data); return true;
+	case mtpc_updateReadHistoryOutbox: visitor(*(const MTPDupdateReadHistoryOutbox*)value.data); return true;
+	case mtpc_updateWebPage: visitor(*(const MTPDupdateWebPage*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPupdates_state::MTPupdates_state() : mtpDataOwner(new MTPDupdates_state()) {
 }
@@ -21491,15 +22129,15 @@ inline MTPupdates_state MTP_updates_state(MTPint _pts, MTPint _qts, MTPint _date
 inline uint32 MTPupdates_difference::innerLength() const {
 	switch (_type) {
 		case mtpc_updates_differenceEmpty: {
-			const MTPDupdates_differenceEmpty &v(c_updates_differenceEmpty());
+			const MTPDupdates_differenceEmpty &v(*(const MTPDupdates_differenceEmpty*)data);
 			return v.vdate.innerLength() + v.vseq.innerLength();
 		}
 		case mtpc_updates_difference: {
-			const MTPDupdates_difference &v(c_updates_difference());
+			const MTPDupdates_difference &v(*(const MTPDupdates_difference*)data);
 			return v.vnew_messages.innerLength() + v.vnew_encrypted_messages.innerLength() + v.vother_updates.innerLength() + v.vchats.innerLength() + v.vusers.innerLength() + v.vstate.innerLength();
 		}
 		case mtpc_updates_differenceSlice: {
-			const MTPDupdates_differenceSlice &v(c_updates_differenceSlice());
+			const MTPDupdates_differenceSlice &v(*(const MTPDupdates_differenceSlice*)data);
 			return v.vnew_messages.innerLength() + v.vnew_encrypted_messages.innerLength() + v.vother_updates.innerLength() + v.vchats.innerLength() + v.vusers.innerLength() + v.vintermediate_state.innerLength();
 		}
 	}
@@ -21514,13 +22152,15 @@ inline void MTPupdates_difference::read(const mtpPrime *&from, const mtpPrime *e
 	switch (cons) {
 		case mtpc_updates_differenceEmpty: _type = cons; {
 			if (!data) setData(new MTPDupdates_differenceEmpty());
-			MTPDupdates_differenceEmpty &v(_updates_differenceEmpty());
+			split();
+			MTPDupdates_differenceEmpty &v(*(MTPDupdates_differenceEmpty*)data);
 			v.vdate.read(from, end);
 			v.vseq.read(from, end);
 		} break;
 		case mtpc_updates_difference: _type = cons; {
 			if (!data) setData(new MTPDupdates_difference());
-			MTPDupdates_difference &v(_updates_difference());
+			split();
+			MTPDupdates_difference &v(*(MTPDupdates_difference*)data);
 			v.vnew_messages.read(from, end);
 			v.vnew_encrypted_messages.read(from, end);
 			v.vother_updates.read(from, end);
@@ -21530,7 +22170,8 @@ inline void MTPupdates_difference::read(const mtpPrime *&from, const mtpPrime *e
 		} break;
 		case mtpc_updates_differenceSlice: _type = cons; {
 			if (!data) setData(new MTPDupdates_differenceSlice());
-			MTPDupdates_differenceSlice &v(_updates_differenceSlice());
+			split();
+			MTPDupdates_differenceSlice &v(*(MTPDupdates_differenceSlice*)data);
 			v.vnew_messages.read(from, end);
 			v.vnew_encrypted_messages.read(from, end);
 			v.vother_updates.read(from, end);
@@ -21544,12 +22185,12 @@ inline void MTPupdates_difference::read(const mtpPrime *&from, const mtpPrime *e
 inline void MTPupdates_difference::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_updates_differenceEmpty: {
-			const MTPDupdates_differenceEmpty &v(c_updates_differenceEmpty());
+			const MTPDupdates_differenceEmpty &v(*(const MTPDupdates_differenceEmpty*)data);
 			v.vdate.write(to);
 			v.vseq.write(to);
 		} break;
 		case mtpc_updates_difference: {
-			const MTPDupdates_difference &v(c_updates_difference());
+			const MTPDupdates_difference &v(*(const MTPDupdates_difference*)data);
 			v.vnew_messages.write(to);
 			v.vnew_encrypted_messages.write(to);
 			v.vother_updates.write(to);
@@ -21558,7 +22199,7 @@ inline void MTPupdates_difference::write(mtpBuffer &to) const {
 			v.vstate.write(to);
 		} break;
 		case mtpc_updates_differenceSlice: {
-			const MTPDupdates_differenceSlice &v(c_updates_differenceSlice());
+			const MTPDupdates_differenceSlice &v(*(const MTPDupdates_differenceSlice*)data);
 			v.vnew_messages.write(to);
 			v.vnew_encrypted_messages.write(to);
 			v.vother_updates.write(to);
@@ -21591,27 +22232,36 @@ inline MTPupdates_difference MTP_updates_difference(const MTPVector<MTPMessage>
 inline MTPupdates_difference MTP_updates_differenceSlice(const MTPVector<MTPMessage> &_new_messages, const MTPVector<MTPEncryptedMessage> &_new_encrypted_messages, const MTPVector<MTPUpdate> &_other_updates, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users, const MTPupdates_State &_intermediate_state) {
 	return MTPupdates_difference(new MTPDupdates_differenceSlice(_new_messages, _new_encrypted_messages, _other_updates, _chats, _users, _intermediate_state));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPupdates_difference &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_updates_differenceEmpty: visitor(*(const MTPDupdates_differenceEmpty*)value.data); return true;
+	case mtpc_updates_difference: visitor(*(const MTPDupdates_difference*)value.data); return true;
+	case mtpc_updates_differenceSlice: visitor(*(const MTPDupdates_differenceSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPupdates::innerLength() const {
 	switch (_type) {
 		case mtpc_updateShortMessage: {
-			const MTPDupdateShortMessage &v(c_updateShortMessage());
+			const MTPDupdateShortMessage &v(*(const MTPDupdateShortMessage*)data);
 			return v.vflags.innerLength() + v.vid.innerLength() + v.vuser_id.innerLength() + v.vmessage.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength() + v.vdate.innerLength() + (v.has_fwd_from_id() ? v.vfwd_from_id.innerLength() : 0) + (v.has_fwd_date() ? v.vfwd_date.innerLength() : 0) + (v.has_reply_to_msg_id() ? v.vreply_to_msg_id.innerLength() : 0);
 		}
 		case mtpc_updateShortChatMessage: {
-			const MTPDupdateShortChatMessage &v(c_updateShortChatMessage());
+			const MTPDupdateShortChatMessage &v(*(const MTPDupdateShortChatMessage*)data);
 			return v.vflags.innerLength() + v.vid.innerLength() + v.vfrom_id.innerLength() + v.vchat_id.innerLength() + v.vmessage.innerLength() + v.vpts.innerLength() + v.vpts_count.innerLength() + v.vdate.innerLength() + (v.has_fwd_from_id() ? v.vfwd_from_id.innerLength() : 0) + (v.has_fwd_date() ? v.vfwd_date.innerLength() : 0) + (v.has_reply_to_msg_id() ? v.vreply_to_msg_id.innerLength() : 0);
 		}
 		case mtpc_updateShort: {
-			const MTPDupdateShort &v(c_updateShort());
+			const MTPDupdateShort &v(*(const MTPDupdateShort*)data);
 			return v.vupdate.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_updatesCombined: {
-			const MTPDupdatesCombined &v(c_updatesCombined());
+			const MTPDupdatesCombined &v(*(const MTPDupdatesCombined*)data);
 			return v.vupdates.innerLength() + v.vusers.innerLength() + v.vchats.innerLength() + v.vdate.innerLength() + v.vseq_start.innerLength() + v.vseq.innerLength();
 		}
 		case mtpc_updates: {
-			const MTPDupdates &v(c_updates());
+			const MTPDupdates &v(*(const MTPDupdates*)data);
 			return v.vupdates.innerLength() + v.vusers.innerLength() + v.vchats.innerLength() + v.vdate.innerLength() + v.vseq.innerLength();
 		}
 	}
@@ -21627,7 +22277,8 @@ inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 		case mtpc_updatesTooLong: _type = cons; break;
 		case mtpc_updateShortMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateShortMessage());
-			MTPDupdateShortMessage &v(_updateShortMessage());
+			split();
+			MTPDupdateShortMessage &v(*(MTPDupdateShortMessage*)data);
 			v.vflags.read(from, end);
 			v.vid.read(from, end);
 			v.vuser_id.read(from, end);
@@ -21641,7 +22292,8 @@ inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 		} break;
 		case mtpc_updateShortChatMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateShortChatMessage());
-			MTPDupdateShortChatMessage &v(_updateShortChatMessage());
+			split();
+			MTPDupdateShortChatMessage &v(*(MTPDupdateShortChatMessage*)data);
 			v.vflags.read(from, end);
 			v.vid.read(from, end);
 			v.vfrom_id.read(from, end);
@@ -21656,13 +22308,15 @@ inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 		} break;
 		case mtpc_updateShort: _type = cons; {
 			if (!data) setData(new MTPDupdateShort());
-			MTPDupdateShort &v(_updateShort());
+			split();
+			MTPDupdateShort &v(*(MTPDupdateShort*)data);
 			v.vupdate.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_updatesCombined: _type = cons; {
 			if (!data) setData(new MTPDupdatesCombined());
-			MTPDupdatesCombined &v(_updatesCombined());
+			split();
+			MTPDupdatesCombined &v(*(MTPDupdatesCombined*)data);
 			v.vupdates.read(from, end);
 			v.vusers.read(from, end);
 			v.vchats.read(from, end);
@@ -21672,7 +22326,8 @@ inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 		} break;
 		case mtpc_updates: _type = cons; {
 			if (!data) setData(new MTPDupdates());
-			MTPDupdates &v(_updates());
+			split();
+			MTPDupdates &v(*(MTPDupdates*)data);
 			v.vupdates.read(from, end);
 			v.vusers.read(from, end);
 			v.vchats.read(from, end);
@@ -21685,7 +22340,7 @@ inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 inline void MTPupdates::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_updateShortMessage: {
-			const MTPDupdateShortMessage &v(c_updateShortMessage());
+			const MTPDupdateShortMessage &v(*(const MTPDupdateShortMessage*)data);
 			v.vflags.write(to);
 			v.vid.write(to);
 			v.vuser_id.write(to);
@@ -21698,7 +22353,7 @@ inline void MTPupdates::write(mtpBuffer &to) const {
 			if (v.has_reply_to_msg_id()) v.vreply_to_msg_id.write(to);
 		} break;
 		case mtpc_updateShortChatMessage: {
-			const MTPDupdateShortChatMessage &v(c_updateShortChatMessage());
+			const MTPDupdateShortChatMessage &v(*(const MTPDupdateShortChatMessage*)data);
 			v.vflags.write(to);
 			v.vid.write(to);
 			v.vfrom_id.write(to);
@@ -21712,12 +22367,12 @@ inline void MTPupdates::write(mtpBuffer &to) const {
 			if (v.has_reply_to_msg_id()) v.vreply_to_msg_id.write(to);
 		} break;
 		case mtpc_updateShort: {
-			const MTPDupdateShort &v(c_updateShort());
+			const MTPDupdateShort &v(*(const MTPDupdateShort*)data);
 			v.vupdate.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_updatesCombined: {
-			const MTPDupdatesCombined &v(c_updatesCombined());
+			const MTPDupdatesCombined &v(*(const MTPDupdatesCombined*)data);
 			v.vupdates.write(to);
 			v.vusers.write(to);
 			v.vchats.write(to);
@@ -21726,7 +22381,7 @@ inline void MTPupdates::write(mtpBuffer &to) const {
 			v.vseq.write(to);
 		} break;
 		case mtpc_updates: {
-			const MTPDupdates &v(c_updates());
+			const MTPDupdates &v(*(const MTPDupdates*)data);
 			v.vupdates.write(to);
 			v.vusers.write(to);
 			v.vchats.write(to);
@@ -21774,15 +22429,26 @@ inline MTPupdates MTP_updatesCombined(const MTPVector<MTPUpdate> &_updates, cons
 inline MTPupdates MTP_updates(const MTPVector<MTPUpdate> &_updates, const MTPVector<MTPUser> &_users, const MTPVector<MTPChat> &_chats, MTPint _date, MTPint _seq) {
 	return MTPupdates(new MTPDupdates(_updates, _users, _chats, _date, _seq));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPupdates &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_updateShortMessage: visitor(*(const MTPDupdateShortMessage*)value.data); return true;
+	case mtpc_updateShortChatMessage: visitor(*(const MTPDupdateShortChatMessage*)value.data); return true;
+	case mtpc_updateShort: visitor(*(const MTPDupdateShort*)value.data); return true;
+	case mtpc_updatesCombined: visitor(*(const MTPDupdatesCombined*)value.data); return true;
+	case mtpc_updates: visitor(*(const MTPDupdates*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPphotos_photos::innerLength() const {
 	switch (_type) {
 		case mtpc_photos_photos: {
-			const MTPDphotos_photos &v(c_photos_photos());
+			const MTPDphotos_photos &v(*(const MTPDphotos_photos*)data);
 			return v.vphotos.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_photos_photosSlice: {
-			const MTPDphotos_photosSlice &v(c_photos_photosSlice());
+			const MTPDphotos_photosSlice &v(*(const MTPDphotos_photosSlice*)data);
 			return v.vcount.innerLength() + v.vphotos.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -21797,13 +22463,15 @@ inline void MTPphotos_photos::read(const mtpPrime *&from, const mtpPrime *end, m
 	switch (cons) {
 		case mtpc_photos_photos: _type = cons; {
 			if (!data) setData(new MTPDphotos_photos());
-			MTPDphotos_photos &v(_photos_photos());
+			split();
+			MTPDphotos_photos &v(*(MTPDphotos_photos*)data);
 			v.vphotos.read(from, end);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_photos_photosSlice: _type = cons; {
 			if (!data) setData(new MTPDphotos_photosSlice());
-			MTPDphotos_photosSlice &v(_photos_photosSlice());
+			split();
+			MTPDphotos_photosSlice &v(*(MTPDphotos_photosSlice*)data);
 			v.vcount.read(from, end);
 			v.vphotos.read(from, end);
 			v.vusers.read(from, end);
@@ -21814,12 +22482,12 @@ inline void MTPphotos_photos::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPphotos_photos::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_photos_photos: {
-			const MTPDphotos_photos &v(c_photos_photos());
+			const MTPDphotos_photos &v(*(const MTPDphotos_photos*)data);
 			v.vphotos.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_photos_photosSlice: {
-			const MTPDphotos_photosSlice &v(c_photos_photosSlice());
+			const MTPDphotos_photosSlice &v(*(const MTPDphotos_photosSlice*)data);
 			v.vcount.write(to);
 			v.vphotos.write(to);
 			v.vusers.write(to);
@@ -21843,6 +22511,14 @@ inline MTPphotos_photos MTP_photos_photos(const MTPVector<MTPPhoto> &_photos, co
 inline MTPphotos_photos MTP_photos_photosSlice(MTPint _count, const MTPVector<MTPPhoto> &_photos, const MTPVector<MTPUser> &_users) {
 	return MTPphotos_photos(new MTPDphotos_photosSlice(_count, _photos, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPphotos_photos &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_photos_photos: visitor(*(const MTPDphotos_photos*)value.data); return true;
+	case mtpc_photos_photosSlice: visitor(*(const MTPDphotos_photosSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPphotos_photo::MTPphotos_photo() : mtpDataOwner(new MTPDphotos_photo()) {
 }
@@ -22028,7 +22704,7 @@ inline MTPnearestDc MTP_nearestDc(const MTPstring &_country, MTPint _this_dc, MT
 inline uint32 MTPhelp_appUpdate::innerLength() const {
 	switch (_type) {
 		case mtpc_help_appUpdate: {
-			const MTPDhelp_appUpdate &v(c_help_appUpdate());
+			const MTPDhelp_appUpdate &v(*(const MTPDhelp_appUpdate*)data);
 			return v.vid.innerLength() + v.vcritical.innerLength() + v.vurl.innerLength() + v.vtext.innerLength();
 		}
 	}
@@ -22043,7 +22719,8 @@ inline void MTPhelp_appUpdate::read(const mtpPrime *&from, const mtpPrime *end,
 	switch (cons) {
 		case mtpc_help_appUpdate: _type = cons; {
 			if (!data) setData(new MTPDhelp_appUpdate());
-			MTPDhelp_appUpdate &v(_help_appUpdate());
+			split();
+			MTPDhelp_appUpdate &v(*(MTPDhelp_appUpdate*)data);
 			v.vid.read(from, end);
 			v.vcritical.read(from, end);
 			v.vurl.read(from, end);
@@ -22056,7 +22733,7 @@ inline void MTPhelp_appUpdate::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPhelp_appUpdate::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_help_appUpdate: {
-			const MTPDhelp_appUpdate &v(c_help_appUpdate());
+			const MTPDhelp_appUpdate &v(*(const MTPDhelp_appUpdate*)data);
 			v.vid.write(to);
 			v.vcritical.write(to);
 			v.vurl.write(to);
@@ -22079,6 +22756,13 @@ inline MTPhelp_appUpdate MTP_help_appUpdate(MTPint _id, MTPBool _critical, const
 inline MTPhelp_appUpdate MTP_help_noAppUpdate() {
 	return MTPhelp_appUpdate(mtpc_help_noAppUpdate);
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPhelp_appUpdate &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_help_appUpdate: visitor(*(const MTPDhelp_appUpdate*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPhelp_inviteText::MTPhelp_inviteText() : mtpDataOwner(new MTPDhelp_inviteText()) {
 }
@@ -22139,15 +22823,15 @@ inline MTPinputGeoChat MTP_inputGeoChat(MTPint _chat_id, const MTPlong &_access_
 inline uint32 MTPgeoChatMessage::innerLength() const {
 	switch (_type) {
 		case mtpc_geoChatMessageEmpty: {
-			const MTPDgeoChatMessageEmpty &v(c_geoChatMessageEmpty());
+			const MTPDgeoChatMessageEmpty &v(*(const MTPDgeoChatMessageEmpty*)data);
 			return v.vchat_id.innerLength() + v.vid.innerLength();
 		}
 		case mtpc_geoChatMessage: {
-			const MTPDgeoChatMessage &v(c_geoChatMessage());
+			const MTPDgeoChatMessage &v(*(const MTPDgeoChatMessage*)data);
 			return v.vchat_id.innerLength() + v.vid.innerLength() + v.vfrom_id.innerLength() + v.vdate.innerLength() + v.vmessage.innerLength() + v.vmedia.innerLength();
 		}
 		case mtpc_geoChatMessageService: {
-			const MTPDgeoChatMessageService &v(c_geoChatMessageService());
+			const MTPDgeoChatMessageService &v(*(const MTPDgeoChatMessageService*)data);
 			return v.vchat_id.innerLength() + v.vid.innerLength() + v.vfrom_id.innerLength() + v.vdate.innerLength() + v.vaction.innerLength();
 		}
 	}
@@ -22162,13 +22846,15 @@ inline void MTPgeoChatMessage::read(const mtpPrime *&from, const mtpPrime *end,
 	switch (cons) {
 		case mtpc_geoChatMessageEmpty: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessageEmpty());
-			MTPDgeoChatMessageEmpty &v(_geoChatMessageEmpty());
+			split();
+			MTPDgeoChatMessageEmpty &v(*(MTPDgeoChatMessageEmpty*)data);
 			v.vchat_id.read(from, end);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_geoChatMessage: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessage());
-			MTPDgeoChatMessage &v(_geoChatMessage());
+			split();
+			MTPDgeoChatMessage &v(*(MTPDgeoChatMessage*)data);
 			v.vchat_id.read(from, end);
 			v.vid.read(from, end);
 			v.vfrom_id.read(from, end);
@@ -22178,7 +22864,8 @@ inline void MTPgeoChatMessage::read(const mtpPrime *&from, const mtpPrime *end,
 		} break;
 		case mtpc_geoChatMessageService: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessageService());
-			MTPDgeoChatMessageService &v(_geoChatMessageService());
+			split();
+			MTPDgeoChatMessageService &v(*(MTPDgeoChatMessageService*)data);
 			v.vchat_id.read(from, end);
 			v.vid.read(from, end);
 			v.vfrom_id.read(from, end);
@@ -22191,12 +22878,12 @@ inline void MTPgeoChatMessage::read(const mtpPrime *&from, const mtpPrime *end,
 inline void MTPgeoChatMessage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_geoChatMessageEmpty: {
-			const MTPDgeoChatMessageEmpty &v(c_geoChatMessageEmpty());
+			const MTPDgeoChatMessageEmpty &v(*(const MTPDgeoChatMessageEmpty*)data);
 			v.vchat_id.write(to);
 			v.vid.write(to);
 		} break;
 		case mtpc_geoChatMessage: {
-			const MTPDgeoChatMessage &v(c_geoChatMessage());
+			const MTPDgeoChatMessage &v(*(const MTPDgeoChatMessage*)data);
 			v.vchat_id.write(to);
 			v.vid.write(to);
 			v.vfrom_id.write(to);
@@ -22205,7 +22892,7 @@ inline void MTPgeoChatMessage::write(mtpBuffer &to) const {
 			v.vmedia.write(to);
 		} break;
 		case mtpc_geoChatMessageService: {
-			const MTPDgeoChatMessageService &v(c_geoChatMessageService());
+			const MTPDgeoChatMessageService &v(*(const MTPDgeoChatMessageService*)data);
 			v.vchat_id.write(to);
 			v.vid.write(to);
 			v.vfrom_id.write(to);
@@ -22237,6 +22924,15 @@ inline MTPgeoChatMessage MTP_geoChatMessage(MTPint _chat_id, MTPint _id, MTPint
 inline MTPgeoChatMessage MTP_geoChatMessageService(MTPint _chat_id, MTPint _id, MTPint _from_id, MTPint _date, const MTPMessageAction &_action) {
 	return MTPgeoChatMessage(new MTPDgeoChatMessageService(_chat_id, _id, _from_id, _date, _action));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPgeoChatMessage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_geoChatMessageEmpty: visitor(*(const MTPDgeoChatMessageEmpty*)value.data); return true;
+	case mtpc_geoChatMessage: visitor(*(const MTPDgeoChatMessage*)value.data); return true;
+	case mtpc_geoChatMessageService: visitor(*(const MTPDgeoChatMessageService*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPgeochats_statedMessage::MTPgeochats_statedMessage() : mtpDataOwner(new MTPDgeochats_statedMessage()) {
 }
@@ -22307,11 +23003,11 @@ inline MTPgeochats_located MTP_geochats_located(const MTPVector<MTPChatLocated>
 inline uint32 MTPgeochats_messages::innerLength() const {
 	switch (_type) {
 		case mtpc_geochats_messages: {
-			const MTPDgeochats_messages &v(c_geochats_messages());
+			const MTPDgeochats_messages &v(*(const MTPDgeochats_messages*)data);
 			return v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 		case mtpc_geochats_messagesSlice: {
-			const MTPDgeochats_messagesSlice &v(c_geochats_messagesSlice());
+			const MTPDgeochats_messagesSlice &v(*(const MTPDgeochats_messagesSlice*)data);
 			return v.vcount.innerLength() + v.vmessages.innerLength() + v.vchats.innerLength() + v.vusers.innerLength();
 		}
 	}
@@ -22326,14 +23022,16 @@ inline void MTPgeochats_messages::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_geochats_messages: _type = cons; {
 			if (!data) setData(new MTPDgeochats_messages());
-			MTPDgeochats_messages &v(_geochats_messages());
+			split();
+			MTPDgeochats_messages &v(*(MTPDgeochats_messages*)data);
 			v.vmessages.read(from, end);
 			v.vchats.read(from, end);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_geochats_messagesSlice: _type = cons; {
 			if (!data) setData(new MTPDgeochats_messagesSlice());
-			MTPDgeochats_messagesSlice &v(_geochats_messagesSlice());
+			split();
+			MTPDgeochats_messagesSlice &v(*(MTPDgeochats_messagesSlice*)data);
 			v.vcount.read(from, end);
 			v.vmessages.read(from, end);
 			v.vchats.read(from, end);
@@ -22345,13 +23043,13 @@ inline void MTPgeochats_messages::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPgeochats_messages::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_geochats_messages: {
-			const MTPDgeochats_messages &v(c_geochats_messages());
+			const MTPDgeochats_messages &v(*(const MTPDgeochats_messages*)data);
 			v.vmessages.write(to);
 			v.vchats.write(to);
 			v.vusers.write(to);
 		} break;
 		case mtpc_geochats_messagesSlice: {
-			const MTPDgeochats_messagesSlice &v(c_geochats_messagesSlice());
+			const MTPDgeochats_messagesSlice &v(*(const MTPDgeochats_messagesSlice*)data);
 			v.vcount.write(to);
 			v.vmessages.write(to);
 			v.vchats.write(to);
@@ -22376,27 +23074,35 @@ inline MTPgeochats_messages MTP_geochats_messages(const MTPVector<MTPGeoChatMess
 inline MTPgeochats_messages MTP_geochats_messagesSlice(MTPint _count, const MTPVector<MTPGeoChatMessage> &_messages, const MTPVector<MTPChat> &_chats, const MTPVector<MTPUser> &_users) {
 	return MTPgeochats_messages(new MTPDgeochats_messagesSlice(_count, _messages, _chats, _users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPgeochats_messages &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_geochats_messages: visitor(*(const MTPDgeochats_messages*)value.data); return true;
+	case mtpc_geochats_messagesSlice: visitor(*(const MTPDgeochats_messagesSlice*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPencryptedChat::innerLength() const {
 	switch (_type) {
 		case mtpc_encryptedChatEmpty: {
-			const MTPDencryptedChatEmpty &v(c_encryptedChatEmpty());
+			const MTPDencryptedChatEmpty &v(*(const MTPDencryptedChatEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_encryptedChatWaiting: {
-			const MTPDencryptedChatWaiting &v(c_encryptedChatWaiting());
+			const MTPDencryptedChatWaiting &v(*(const MTPDencryptedChatWaiting*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vdate.innerLength() + v.vadmin_id.innerLength() + v.vparticipant_id.innerLength();
 		}
 		case mtpc_encryptedChatRequested: {
-			const MTPDencryptedChatRequested &v(c_encryptedChatRequested());
+			const MTPDencryptedChatRequested &v(*(const MTPDencryptedChatRequested*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vdate.innerLength() + v.vadmin_id.innerLength() + v.vparticipant_id.innerLength() + v.vg_a.innerLength();
 		}
 		case mtpc_encryptedChat: {
-			const MTPDencryptedChat &v(c_encryptedChat());
+			const MTPDencryptedChat &v(*(const MTPDencryptedChat*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vdate.innerLength() + v.vadmin_id.innerLength() + v.vparticipant_id.innerLength() + v.vg_a_or_b.innerLength() + v.vkey_fingerprint.innerLength();
 		}
 		case mtpc_encryptedChatDiscarded: {
-			const MTPDencryptedChatDiscarded &v(c_encryptedChatDiscarded());
+			const MTPDencryptedChatDiscarded &v(*(const MTPDencryptedChatDiscarded*)data);
 			return v.vid.innerLength();
 		}
 	}
@@ -22411,12 +23117,14 @@ inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, m
 	switch (cons) {
 		case mtpc_encryptedChatEmpty: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatEmpty());
-			MTPDencryptedChatEmpty &v(_encryptedChatEmpty());
+			split();
+			MTPDencryptedChatEmpty &v(*(MTPDencryptedChatEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_encryptedChatWaiting: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatWaiting());
-			MTPDencryptedChatWaiting &v(_encryptedChatWaiting());
+			split();
+			MTPDencryptedChatWaiting &v(*(MTPDencryptedChatWaiting*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vdate.read(from, end);
@@ -22425,7 +23133,8 @@ inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, m
 		} break;
 		case mtpc_encryptedChatRequested: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatRequested());
-			MTPDencryptedChatRequested &v(_encryptedChatRequested());
+			split();
+			MTPDencryptedChatRequested &v(*(MTPDencryptedChatRequested*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vdate.read(from, end);
@@ -22435,7 +23144,8 @@ inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, m
 		} break;
 		case mtpc_encryptedChat: _type = cons; {
 			if (!data) setData(new MTPDencryptedChat());
-			MTPDencryptedChat &v(_encryptedChat());
+			split();
+			MTPDencryptedChat &v(*(MTPDencryptedChat*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vdate.read(from, end);
@@ -22446,7 +23156,8 @@ inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, m
 		} break;
 		case mtpc_encryptedChatDiscarded: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatDiscarded());
-			MTPDencryptedChatDiscarded &v(_encryptedChatDiscarded());
+			split();
+			MTPDencryptedChatDiscarded &v(*(MTPDencryptedChatDiscarded*)data);
 			v.vid.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPencryptedChat");
@@ -22455,11 +23166,11 @@ inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPencryptedChat::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_encryptedChatEmpty: {
-			const MTPDencryptedChatEmpty &v(c_encryptedChatEmpty());
+			const MTPDencryptedChatEmpty &v(*(const MTPDencryptedChatEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_encryptedChatWaiting: {
-			const MTPDencryptedChatWaiting &v(c_encryptedChatWaiting());
+			const MTPDencryptedChatWaiting &v(*(const MTPDencryptedChatWaiting*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vdate.write(to);
@@ -22467,7 +23178,7 @@ inline void MTPencryptedChat::write(mtpBuffer &to) const {
 			v.vparticipant_id.write(to);
 		} break;
 		case mtpc_encryptedChatRequested: {
-			const MTPDencryptedChatRequested &v(c_encryptedChatRequested());
+			const MTPDencryptedChatRequested &v(*(const MTPDencryptedChatRequested*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vdate.write(to);
@@ -22476,7 +23187,7 @@ inline void MTPencryptedChat::write(mtpBuffer &to) const {
 			v.vg_a.write(to);
 		} break;
 		case mtpc_encryptedChat: {
-			const MTPDencryptedChat &v(c_encryptedChat());
+			const MTPDencryptedChat &v(*(const MTPDencryptedChat*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vdate.write(to);
@@ -22486,7 +23197,7 @@ inline void MTPencryptedChat::write(mtpBuffer &to) const {
 			v.vkey_fingerprint.write(to);
 		} break;
 		case mtpc_encryptedChatDiscarded: {
-			const MTPDencryptedChatDiscarded &v(c_encryptedChatDiscarded());
+			const MTPDencryptedChatDiscarded &v(*(const MTPDencryptedChatDiscarded*)data);
 			v.vid.write(to);
 		} break;
 	}
@@ -22526,6 +23237,17 @@ inline MTPencryptedChat MTP_encryptedChat(MTPint _id, const MTPlong &_access_has
 inline MTPencryptedChat MTP_encryptedChatDiscarded(MTPint _id) {
 	return MTPencryptedChat(new MTPDencryptedChatDiscarded(_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPencryptedChat &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_encryptedChatEmpty: visitor(*(const MTPDencryptedChatEmpty*)value.data); return true;
+	case mtpc_encryptedChatWaiting: visitor(*(const MTPDencryptedChatWaiting*)value.data); return true;
+	case mtpc_encryptedChatRequested: visitor(*(const MTPDencryptedChatRequested*)value.data); return true;
+	case mtpc_encryptedChat: visitor(*(const MTPDencryptedChat*)value.data); return true;
+	case mtpc_encryptedChatDiscarded: visitor(*(const MTPDencryptedChatDiscarded*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPinputEncryptedChat::MTPinputEncryptedChat() : mtpDataOwner(new MTPDinputEncryptedChat()) {
 }
@@ -22559,7 +23281,7 @@ inline MTPinputEncryptedChat MTP_inputEncryptedChat(MTPint _chat_id, const MTPlo
 inline uint32 MTPencryptedFile::innerLength() const {
 	switch (_type) {
 		case mtpc_encryptedFile: {
-			const MTPDencryptedFile &v(c_encryptedFile());
+			const MTPDencryptedFile &v(*(const MTPDencryptedFile*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vsize.innerLength() + v.vdc_id.innerLength() + v.vkey_fingerprint.innerLength();
 		}
 	}
@@ -22575,7 +23297,8 @@ inline void MTPencryptedFile::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_encryptedFileEmpty: _type = cons; break;
 		case mtpc_encryptedFile: _type = cons; {
 			if (!data) setData(new MTPDencryptedFile());
-			MTPDencryptedFile &v(_encryptedFile());
+			split();
+			MTPDencryptedFile &v(*(MTPDencryptedFile*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vsize.read(from, end);
@@ -22588,7 +23311,7 @@ inline void MTPencryptedFile::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPencryptedFile::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_encryptedFile: {
-			const MTPDencryptedFile &v(c_encryptedFile());
+			const MTPDencryptedFile &v(*(const MTPDencryptedFile*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vsize.write(to);
@@ -22612,19 +23335,26 @@ inline MTPencryptedFile MTP_encryptedFileEmpty() {
 inline MTPencryptedFile MTP_encryptedFile(const MTPlong &_id, const MTPlong &_access_hash, MTPint _size, MTPint _dc_id, MTPint _key_fingerprint) {
 	return MTPencryptedFile(new MTPDencryptedFile(_id, _access_hash, _size, _dc_id, _key_fingerprint));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPencryptedFile &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_encryptedFile: visitor(*(const MTPDencryptedFile*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputEncryptedFile::innerLength() const {
 	switch (_type) {
 		case mtpc_inputEncryptedFileUploaded: {
-			const MTPDinputEncryptedFileUploaded &v(c_inputEncryptedFileUploaded());
+			const MTPDinputEncryptedFileUploaded &v(*(const MTPDinputEncryptedFileUploaded*)data);
 			return v.vid.innerLength() + v.vparts.innerLength() + v.vmd5_checksum.innerLength() + v.vkey_fingerprint.innerLength();
 		}
 		case mtpc_inputEncryptedFile: {
-			const MTPDinputEncryptedFile &v(c_inputEncryptedFile());
+			const MTPDinputEncryptedFile &v(*(const MTPDinputEncryptedFile*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 		case mtpc_inputEncryptedFileBigUploaded: {
-			const MTPDinputEncryptedFileBigUploaded &v(c_inputEncryptedFileBigUploaded());
+			const MTPDinputEncryptedFileBigUploaded &v(*(const MTPDinputEncryptedFileBigUploaded*)data);
 			return v.vid.innerLength() + v.vparts.innerLength() + v.vkey_fingerprint.innerLength();
 		}
 	}
@@ -22640,7 +23370,8 @@ inline void MTPinputEncryptedFile::read(const mtpPrime *&from, const mtpPrime *e
 		case mtpc_inputEncryptedFileEmpty: _type = cons; break;
 		case mtpc_inputEncryptedFileUploaded: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileUploaded());
-			MTPDinputEncryptedFileUploaded &v(_inputEncryptedFileUploaded());
+			split();
+			MTPDinputEncryptedFileUploaded &v(*(MTPDinputEncryptedFileUploaded*)data);
 			v.vid.read(from, end);
 			v.vparts.read(from, end);
 			v.vmd5_checksum.read(from, end);
@@ -22648,13 +23379,15 @@ inline void MTPinputEncryptedFile::read(const mtpPrime *&from, const mtpPrime *e
 		} break;
 		case mtpc_inputEncryptedFile: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFile());
-			MTPDinputEncryptedFile &v(_inputEncryptedFile());
+			split();
+			MTPDinputEncryptedFile &v(*(MTPDinputEncryptedFile*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
 		case mtpc_inputEncryptedFileBigUploaded: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileBigUploaded());
-			MTPDinputEncryptedFileBigUploaded &v(_inputEncryptedFileBigUploaded());
+			split();
+			MTPDinputEncryptedFileBigUploaded &v(*(MTPDinputEncryptedFileBigUploaded*)data);
 			v.vid.read(from, end);
 			v.vparts.read(from, end);
 			v.vkey_fingerprint.read(from, end);
@@ -22665,19 +23398,19 @@ inline void MTPinputEncryptedFile::read(const mtpPrime *&from, const mtpPrime *e
 inline void MTPinputEncryptedFile::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputEncryptedFileUploaded: {
-			const MTPDinputEncryptedFileUploaded &v(c_inputEncryptedFileUploaded());
+			const MTPDinputEncryptedFileUploaded &v(*(const MTPDinputEncryptedFileUploaded*)data);
 			v.vid.write(to);
 			v.vparts.write(to);
 			v.vmd5_checksum.write(to);
 			v.vkey_fingerprint.write(to);
 		} break;
 		case mtpc_inputEncryptedFile: {
-			const MTPDinputEncryptedFile &v(c_inputEncryptedFile());
+			const MTPDinputEncryptedFile &v(*(const MTPDinputEncryptedFile*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
 		case mtpc_inputEncryptedFileBigUploaded: {
-			const MTPDinputEncryptedFileBigUploaded &v(c_inputEncryptedFileBigUploaded());
+			const MTPDinputEncryptedFileBigUploaded &v(*(const MTPDinputEncryptedFileBigUploaded*)data);
 			v.vid.write(to);
 			v.vparts.write(to);
 			v.vkey_fingerprint.write(to);
@@ -22711,15 +23444,24 @@ inline MTPinputEncryptedFile MTP_inputEncryptedFile(const MTPlong &_id, const MT
 inline MTPinputEncryptedFile MTP_inputEncryptedFileBigUploaded(const MTPlong &_id, MTPint _parts, MTPint _key_fingerprint) {
 	return MTPinputEncryptedFile(new MTPDinputEncryptedFileBigUploaded(_id, _parts, _key_fingerprint));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputEncryptedFile &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputEncryptedFileUploaded: visitor(*(const MTPDinputEncryptedFileUploaded*)value.data); return true;
+	case mtpc_inputEncryptedFile: visitor(*(const MTPDinputEncryptedFile*)value.data); return true;
+	case mtpc_inputEncryptedFileBigUploaded: visitor(*(const MTPDinputEncryptedFileBigUploaded*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPencryptedMessage::innerLength() const {
 	switch (_type) {
 		case mtpc_encryptedMessage: {
-			const MTPDencryptedMessage &v(c_encryptedMessage());
+			const MTPDencryptedMessage &v(*(const MTPDencryptedMessage*)data);
 			return v.vrandom_id.innerLength() + v.vchat_id.innerLength() + v.vdate.innerLength() + v.vbytes.innerLength() + v.vfile.innerLength();
 		}
 		case mtpc_encryptedMessageService: {
-			const MTPDencryptedMessageService &v(c_encryptedMessageService());
+			const MTPDencryptedMessageService &v(*(const MTPDencryptedMessageService*)data);
 			return v.vrandom_id.innerLength() + v.vchat_id.innerLength() + v.vdate.innerLength() + v.vbytes.innerLength();
 		}
 	}
@@ -22734,7 +23476,8 @@ inline void MTPencryptedMessage::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_encryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDencryptedMessage());
-			MTPDencryptedMessage &v(_encryptedMessage());
+			split();
+			MTPDencryptedMessage &v(*(MTPDencryptedMessage*)data);
 			v.vrandom_id.read(from, end);
 			v.vchat_id.read(from, end);
 			v.vdate.read(from, end);
@@ -22743,7 +23486,8 @@ inline void MTPencryptedMessage::read(const mtpPrime *&from, const mtpPrime *end
 		} break;
 		case mtpc_encryptedMessageService: _type = cons; {
 			if (!data) setData(new MTPDencryptedMessageService());
-			MTPDencryptedMessageService &v(_encryptedMessageService());
+			split();
+			MTPDencryptedMessageService &v(*(MTPDencryptedMessageService*)data);
 			v.vrandom_id.read(from, end);
 			v.vchat_id.read(from, end);
 			v.vdate.read(from, end);
@@ -22755,7 +23499,7 @@ inline void MTPencryptedMessage::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPencryptedMessage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_encryptedMessage: {
-			const MTPDencryptedMessage &v(c_encryptedMessage());
+			const MTPDencryptedMessage &v(*(const MTPDencryptedMessage*)data);
 			v.vrandom_id.write(to);
 			v.vchat_id.write(to);
 			v.vdate.write(to);
@@ -22763,7 +23507,7 @@ inline void MTPencryptedMessage::write(mtpBuffer &to) const {
 			v.vfile.write(to);
 		} break;
 		case mtpc_encryptedMessageService: {
-			const MTPDencryptedMessageService &v(c_encryptedMessageService());
+			const MTPDencryptedMessageService &v(*(const MTPDencryptedMessageService*)data);
 			v.vrandom_id.write(to);
 			v.vchat_id.write(to);
 			v.vdate.write(to);
@@ -22788,15 +23532,23 @@ inline MTPencryptedMessage MTP_encryptedMessage(const MTPlong &_random_id, MTPin
 inline MTPencryptedMessage MTP_encryptedMessageService(const MTPlong &_random_id, MTPint _chat_id, MTPint _date, const MTPbytes &_bytes) {
 	return MTPencryptedMessage(new MTPDencryptedMessageService(_random_id, _chat_id, _date, _bytes));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPencryptedMessage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_encryptedMessage: visitor(*(const MTPDencryptedMessage*)value.data); return true;
+	case mtpc_encryptedMessageService: visitor(*(const MTPDencryptedMessageService*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessages_dhConfig::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_dhConfigNotModified: {
-			const MTPDmessages_dhConfigNotModified &v(c_messages_dhConfigNotModified());
+			const MTPDmessages_dhConfigNotModified &v(*(const MTPDmessages_dhConfigNotModified*)data);
 			return v.vrandom.innerLength();
 		}
 		case mtpc_messages_dhConfig: {
-			const MTPDmessages_dhConfig &v(c_messages_dhConfig());
+			const MTPDmessages_dhConfig &v(*(const MTPDmessages_dhConfig*)data);
 			return v.vg.innerLength() + v.vp.innerLength() + v.vversion.innerLength() + v.vrandom.innerLength();
 		}
 	}
@@ -22811,12 +23563,14 @@ inline void MTPmessages_dhConfig::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_messages_dhConfigNotModified: _type = cons; {
 			if (!data) setData(new MTPDmessages_dhConfigNotModified());
-			MTPDmessages_dhConfigNotModified &v(_messages_dhConfigNotModified());
+			split();
+			MTPDmessages_dhConfigNotModified &v(*(MTPDmessages_dhConfigNotModified*)data);
 			v.vrandom.read(from, end);
 		} break;
 		case mtpc_messages_dhConfig: _type = cons; {
 			if (!data) setData(new MTPDmessages_dhConfig());
-			MTPDmessages_dhConfig &v(_messages_dhConfig());
+			split();
+			MTPDmessages_dhConfig &v(*(MTPDmessages_dhConfig*)data);
 			v.vg.read(from, end);
 			v.vp.read(from, end);
 			v.vversion.read(from, end);
@@ -22828,11 +23582,11 @@ inline void MTPmessages_dhConfig::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPmessages_dhConfig::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_dhConfigNotModified: {
-			const MTPDmessages_dhConfigNotModified &v(c_messages_dhConfigNotModified());
+			const MTPDmessages_dhConfigNotModified &v(*(const MTPDmessages_dhConfigNotModified*)data);
 			v.vrandom.write(to);
 		} break;
 		case mtpc_messages_dhConfig: {
-			const MTPDmessages_dhConfig &v(c_messages_dhConfig());
+			const MTPDmessages_dhConfig &v(*(const MTPDmessages_dhConfig*)data);
 			v.vg.write(to);
 			v.vp.write(to);
 			v.vversion.write(to);
@@ -22857,15 +23611,23 @@ inline MTPmessages_dhConfig MTP_messages_dhConfigNotModified(const MTPbytes &_ra
 inline MTPmessages_dhConfig MTP_messages_dhConfig(MTPint _g, const MTPbytes &_p, MTPint _version, const MTPbytes &_random) {
 	return MTPmessages_dhConfig(new MTPDmessages_dhConfig(_g, _p, _version, _random));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_dhConfig &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_dhConfigNotModified: visitor(*(const MTPDmessages_dhConfigNotModified*)value.data); return true;
+	case mtpc_messages_dhConfig: visitor(*(const MTPDmessages_dhConfig*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessages_sentEncryptedMessage::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_sentEncryptedMessage: {
-			const MTPDmessages_sentEncryptedMessage &v(c_messages_sentEncryptedMessage());
+			const MTPDmessages_sentEncryptedMessage &v(*(const MTPDmessages_sentEncryptedMessage*)data);
 			return v.vdate.innerLength();
 		}
 		case mtpc_messages_sentEncryptedFile: {
-			const MTPDmessages_sentEncryptedFile &v(c_messages_sentEncryptedFile());
+			const MTPDmessages_sentEncryptedFile &v(*(const MTPDmessages_sentEncryptedFile*)data);
 			return v.vdate.innerLength() + v.vfile.innerLength();
 		}
 	}
@@ -22880,12 +23642,14 @@ inline void MTPmessages_sentEncryptedMessage::read(const mtpPrime *&from, const
 	switch (cons) {
 		case mtpc_messages_sentEncryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentEncryptedMessage());
-			MTPDmessages_sentEncryptedMessage &v(_messages_sentEncryptedMessage());
+			split();
+			MTPDmessages_sentEncryptedMessage &v(*(MTPDmessages_sentEncryptedMessage*)data);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_messages_sentEncryptedFile: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentEncryptedFile());
-			MTPDmessages_sentEncryptedFile &v(_messages_sentEncryptedFile());
+			split();
+			MTPDmessages_sentEncryptedFile &v(*(MTPDmessages_sentEncryptedFile*)data);
 			v.vdate.read(from, end);
 			v.vfile.read(from, end);
 		} break;
@@ -22895,11 +23659,11 @@ inline void MTPmessages_sentEncryptedMessage::read(const mtpPrime *&from, const
 inline void MTPmessages_sentEncryptedMessage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_sentEncryptedMessage: {
-			const MTPDmessages_sentEncryptedMessage &v(c_messages_sentEncryptedMessage());
+			const MTPDmessages_sentEncryptedMessage &v(*(const MTPDmessages_sentEncryptedMessage*)data);
 			v.vdate.write(to);
 		} break;
 		case mtpc_messages_sentEncryptedFile: {
-			const MTPDmessages_sentEncryptedFile &v(c_messages_sentEncryptedFile());
+			const MTPDmessages_sentEncryptedFile &v(*(const MTPDmessages_sentEncryptedFile*)data);
 			v.vdate.write(to);
 			v.vfile.write(to);
 		} break;
@@ -22922,11 +23686,19 @@ inline MTPmessages_sentEncryptedMessage MTP_messages_sentEncryptedMessage(MTPint
 inline MTPmessages_sentEncryptedMessage MTP_messages_sentEncryptedFile(MTPint _date, const MTPEncryptedFile &_file) {
 	return MTPmessages_sentEncryptedMessage(new MTPDmessages_sentEncryptedFile(_date, _file));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_sentEncryptedMessage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_sentEncryptedMessage: visitor(*(const MTPDmessages_sentEncryptedMessage*)value.data); return true;
+	case mtpc_messages_sentEncryptedFile: visitor(*(const MTPDmessages_sentEncryptedFile*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputAudio::innerLength() const {
 	switch (_type) {
 		case mtpc_inputAudio: {
-			const MTPDinputAudio &v(c_inputAudio());
+			const MTPDinputAudio &v(*(const MTPDinputAudio*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -22942,7 +23714,8 @@ inline void MTPinputAudio::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 		case mtpc_inputAudioEmpty: _type = cons; break;
 		case mtpc_inputAudio: _type = cons; {
 			if (!data) setData(new MTPDinputAudio());
-			MTPDinputAudio &v(_inputAudio());
+			split();
+			MTPDinputAudio &v(*(MTPDinputAudio*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -22952,7 +23725,7 @@ inline void MTPinputAudio::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPinputAudio::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputAudio: {
-			const MTPDinputAudio &v(c_inputAudio());
+			const MTPDinputAudio &v(*(const MTPDinputAudio*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -22973,11 +23746,18 @@ inline MTPinputAudio MTP_inputAudioEmpty() {
 inline MTPinputAudio MTP_inputAudio(const MTPlong &_id, const MTPlong &_access_hash) {
 	return MTPinputAudio(new MTPDinputAudio(_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputAudio &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputAudio: visitor(*(const MTPDinputAudio*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPinputDocument::innerLength() const {
 	switch (_type) {
 		case mtpc_inputDocument: {
-			const MTPDinputDocument &v(c_inputDocument());
+			const MTPDinputDocument &v(*(const MTPDinputDocument*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength();
 		}
 	}
@@ -22993,7 +23773,8 @@ inline void MTPinputDocument::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_inputDocumentEmpty: _type = cons; break;
 		case mtpc_inputDocument: _type = cons; {
 			if (!data) setData(new MTPDinputDocument());
-			MTPDinputDocument &v(_inputDocument());
+			split();
+			MTPDinputDocument &v(*(MTPDinputDocument*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 		} break;
@@ -23003,7 +23784,7 @@ inline void MTPinputDocument::read(const mtpPrime *&from, const mtpPrime *end, m
 inline void MTPinputDocument::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputDocument: {
-			const MTPDinputDocument &v(c_inputDocument());
+			const MTPDinputDocument &v(*(const MTPDinputDocument*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 		} break;
@@ -23024,15 +23805,22 @@ inline MTPinputDocument MTP_inputDocumentEmpty() {
 inline MTPinputDocument MTP_inputDocument(const MTPlong &_id, const MTPlong &_access_hash) {
 	return MTPinputDocument(new MTPDinputDocument(_id, _access_hash));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputDocument &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputDocument: visitor(*(const MTPDinputDocument*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPaudio::innerLength() const {
 	switch (_type) {
 		case mtpc_audioEmpty: {
-			const MTPDaudioEmpty &v(c_audioEmpty());
+			const MTPDaudioEmpty &v(*(const MTPDaudioEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_audio: {
-			const MTPDaudio &v(c_audio());
+			const MTPDaudio &v(*(const MTPDaudio*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vuser_id.innerLength() + v.vdate.innerLength() + v.vduration.innerLength() + v.vmime_type.innerLength() + v.vsize.innerLength() + v.vdc_id.innerLength();
 		}
 	}
@@ -23047,12 +23835,14 @@ inline void MTPaudio::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 	switch (cons) {
 		case mtpc_audioEmpty: _type = cons; {
 			if (!data) setData(new MTPDaudioEmpty());
-			MTPDaudioEmpty &v(_audioEmpty());
+			split();
+			MTPDaudioEmpty &v(*(MTPDaudioEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_audio: _type = cons; {
 			if (!data) setData(new MTPDaudio());
-			MTPDaudio &v(_audio());
+			split();
+			MTPDaudio &v(*(MTPDaudio*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vuser_id.read(from, end);
@@ -23068,11 +23858,11 @@ inline void MTPaudio::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId
 inline void MTPaudio::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_audioEmpty: {
-			const MTPDaudioEmpty &v(c_audioEmpty());
+			const MTPDaudioEmpty &v(*(const MTPDaudioEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_audio: {
-			const MTPDaudio &v(c_audio());
+			const MTPDaudio &v(*(const MTPDaudio*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vuser_id.write(to);
@@ -23101,15 +23891,23 @@ inline MTPaudio MTP_audioEmpty(const MTPlong &_id) {
 inline MTPaudio MTP_audio(const MTPlong &_id, const MTPlong &_access_hash, MTPint _user_id, MTPint _date, MTPint _duration, const MTPstring &_mime_type, MTPint _size, MTPint _dc_id) {
 	return MTPaudio(new MTPDaudio(_id, _access_hash, _user_id, _date, _duration, _mime_type, _size, _dc_id));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPaudio &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_audioEmpty: visitor(*(const MTPDaudioEmpty*)value.data); return true;
+	case mtpc_audio: visitor(*(const MTPDaudio*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPdocument::innerLength() const {
 	switch (_type) {
 		case mtpc_documentEmpty: {
-			const MTPDdocumentEmpty &v(c_documentEmpty());
+			const MTPDdocumentEmpty &v(*(const MTPDdocumentEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_document: {
-			const MTPDdocument &v(c_document());
+			const MTPDdocument &v(*(const MTPDdocument*)data);
 			return v.vid.innerLength() + v.vaccess_hash.innerLength() + v.vdate.innerLength() + v.vmime_type.innerLength() + v.vsize.innerLength() + v.vthumb.innerLength() + v.vdc_id.innerLength() + v.vattributes.innerLength();
 		}
 	}
@@ -23124,12 +23922,14 @@ inline void MTPdocument::read(const mtpPrime *&from, const mtpPrime *end, mtpTyp
 	switch (cons) {
 		case mtpc_documentEmpty: _type = cons; {
 			if (!data) setData(new MTPDdocumentEmpty());
-			MTPDdocumentEmpty &v(_documentEmpty());
+			split();
+			MTPDdocumentEmpty &v(*(MTPDdocumentEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_document: _type = cons; {
 			if (!data) setData(new MTPDdocument());
-			MTPDdocument &v(_document());
+			split();
+			MTPDdocument &v(*(MTPDdocument*)data);
 			v.vid.read(from, end);
 			v.vaccess_hash.read(from, end);
 			v.vdate.read(from, end);
@@ -23145,11 +23945,11 @@ inline void MTPdocument::read(const mtpPrime *&from, const mtpPrime *end, mtpTyp
 inline void MTPdocument::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_documentEmpty: {
-			const MTPDdocumentEmpty &v(c_documentEmpty());
+			const MTPDdocumentEmpty &v(*(const MTPDdocumentEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_document: {
-			const MTPDdocument &v(c_document());
+			const MTPDdocument &v(*(const MTPDdocument*)data);
 			v.vid.write(to);
 			v.vaccess_hash.write(to);
 			v.vdate.write(to);
@@ -23178,6 +23978,14 @@ inline MTPdocument MTP_documentEmpty(const MTPlong &_id) {
 inline MTPdocument MTP_document(const MTPlong &_id, const MTPlong &_access_hash, MTPint _date, const MTPstring &_mime_type, MTPint _size, const MTPPhotoSize &_thumb, MTPint _dc_id, const MTPVector<MTPDocumentAttribute> &_attributes) {
 	return MTPdocument(new MTPDdocument(_id, _access_hash, _date, _mime_type, _size, _thumb, _dc_id, _attributes));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPdocument &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_documentEmpty: visitor(*(const MTPDdocumentEmpty*)value.data); return true;
+	case mtpc_document: visitor(*(const MTPDdocument*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPhelp_support::MTPhelp_support() : mtpDataOwner(new MTPDhelp_support()) {
 }
@@ -23211,7 +24019,7 @@ inline MTPhelp_support MTP_help_support(const MTPstring &_phone_number, const MT
 inline uint32 MTPnotifyPeer::innerLength() const {
 	switch (_type) {
 		case mtpc_notifyPeer: {
-			const MTPDnotifyPeer &v(c_notifyPeer());
+			const MTPDnotifyPeer &v(*(const MTPDnotifyPeer*)data);
 			return v.vpeer.innerLength();
 		}
 	}
@@ -23226,7 +24034,8 @@ inline void MTPnotifyPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 	switch (cons) {
 		case mtpc_notifyPeer: _type = cons; {
 			if (!data) setData(new MTPDnotifyPeer());
-			MTPDnotifyPeer &v(_notifyPeer());
+			split();
+			MTPDnotifyPeer &v(*(MTPDnotifyPeer*)data);
 			v.vpeer.read(from, end);
 		} break;
 		case mtpc_notifyUsers: _type = cons; break;
@@ -23238,7 +24047,7 @@ inline void MTPnotifyPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpT
 inline void MTPnotifyPeer::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_notifyPeer: {
-			const MTPDnotifyPeer &v(c_notifyPeer());
+			const MTPDnotifyPeer &v(*(const MTPDnotifyPeer*)data);
 			v.vpeer.write(to);
 		} break;
 	}
@@ -23266,6 +24075,13 @@ inline MTPnotifyPeer MTP_notifyChats() {
 inline MTPnotifyPeer MTP_notifyAll() {
 	return MTPnotifyPeer(mtpc_notifyAll);
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPnotifyPeer &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_notifyPeer: visitor(*(const MTPDnotifyPeer*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPsendMessageAction::innerLength() const {
 	return 0;
@@ -23426,11 +24242,11 @@ inline MTPprivacyKey MTP_privacyKeyStatusTimestamp() {
 inline uint32 MTPinputPrivacyRule::innerLength() const {
 	switch (_type) {
 		case mtpc_inputPrivacyValueAllowUsers: {
-			const MTPDinputPrivacyValueAllowUsers &v(c_inputPrivacyValueAllowUsers());
+			const MTPDinputPrivacyValueAllowUsers &v(*(const MTPDinputPrivacyValueAllowUsers*)data);
 			return v.vusers.innerLength();
 		}
 		case mtpc_inputPrivacyValueDisallowUsers: {
-			const MTPDinputPrivacyValueDisallowUsers &v(c_inputPrivacyValueDisallowUsers());
+			const MTPDinputPrivacyValueDisallowUsers &v(*(const MTPDinputPrivacyValueDisallowUsers*)data);
 			return v.vusers.innerLength();
 		}
 	}
@@ -23447,14 +24263,16 @@ inline void MTPinputPrivacyRule::read(const mtpPrime *&from, const mtpPrime *end
 		case mtpc_inputPrivacyValueAllowAll: _type = cons; break;
 		case mtpc_inputPrivacyValueAllowUsers: _type = cons; {
 			if (!data) setData(new MTPDinputPrivacyValueAllowUsers());
-			MTPDinputPrivacyValueAllowUsers &v(_inputPrivacyValueAllowUsers());
+			split();
+			MTPDinputPrivacyValueAllowUsers &v(*(MTPDinputPrivacyValueAllowUsers*)data);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_inputPrivacyValueDisallowContacts: _type = cons; break;
 		case mtpc_inputPrivacyValueDisallowAll: _type = cons; break;
 		case mtpc_inputPrivacyValueDisallowUsers: _type = cons; {
 			if (!data) setData(new MTPDinputPrivacyValueDisallowUsers());
-			MTPDinputPrivacyValueDisallowUsers &v(_inputPrivacyValueDisallowUsers());
+			split();
+			MTPDinputPrivacyValueDisallowUsers &v(*(MTPDinputPrivacyValueDisallowUsers*)data);
 			v.vusers.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPinputPrivacyRule");
@@ -23463,11 +24281,11 @@ inline void MTPinputPrivacyRule::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPinputPrivacyRule::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_inputPrivacyValueAllowUsers: {
-			const MTPDinputPrivacyValueAllowUsers &v(c_inputPrivacyValueAllowUsers());
+			const MTPDinputPrivacyValueAllowUsers &v(*(const MTPDinputPrivacyValueAllowUsers*)data);
 			v.vusers.write(to);
 		} break;
 		case mtpc_inputPrivacyValueDisallowUsers: {
-			const MTPDinputPrivacyValueDisallowUsers &v(c_inputPrivacyValueDisallowUsers());
+			const MTPDinputPrivacyValueDisallowUsers &v(*(const MTPDinputPrivacyValueDisallowUsers*)data);
 			v.vusers.write(to);
 		} break;
 	}
@@ -23505,15 +24323,23 @@ inline MTPinputPrivacyRule MTP_inputPrivacyValueDisallowAll() {
 inline MTPinputPrivacyRule MTP_inputPrivacyValueDisallowUsers(const MTPVector<MTPInputUser> &_users) {
 	return MTPinputPrivacyRule(new MTPDinputPrivacyValueDisallowUsers(_users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPinputPrivacyRule &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_inputPrivacyValueAllowUsers: visitor(*(const MTPDinputPrivacyValueAllowUsers*)value.data); return true;
+	case mtpc_inputPrivacyValueDisallowUsers: visitor(*(const MTPDinputPrivacyValueDisallowUsers*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPprivacyRule::innerLength() const {
 	switch (_type) {
 		case mtpc_privacyValueAllowUsers: {
-			const MTPDprivacyValueAllowUsers &v(c_privacyValueAllowUsers());
+			const MTPDprivacyValueAllowUsers &v(*(const MTPDprivacyValueAllowUsers*)data);
 			return v.vusers.innerLength();
 		}
 		case mtpc_privacyValueDisallowUsers: {
-			const MTPDprivacyValueDisallowUsers &v(c_privacyValueDisallowUsers());
+			const MTPDprivacyValueDisallowUsers &v(*(const MTPDprivacyValueDisallowUsers*)data);
 			return v.vusers.innerLength();
 		}
 	}
@@ -23530,14 +24356,16 @@ inline void MTPprivacyRule::read(const mtpPrime *&from, const mtpPrime *end, mtp
 		case mtpc_privacyValueAllowAll: _type = cons; break;
 		case mtpc_privacyValueAllowUsers: _type = cons; {
 			if (!data) setData(new MTPDprivacyValueAllowUsers());
-			MTPDprivacyValueAllowUsers &v(_privacyValueAllowUsers());
+			split();
+			MTPDprivacyValueAllowUsers &v(*(MTPDprivacyValueAllowUsers*)data);
 			v.vusers.read(from, end);
 		} break;
 		case mtpc_privacyValueDisallowContacts: _type = cons; break;
 		case mtpc_privacyValueDisallowAll: _type = cons; break;
 		case mtpc_privacyValueDisallowUsers: _type = cons; {
 			if (!data) setData(new MTPDprivacyValueDisallowUsers());
-			MTPDprivacyValueDisallowUsers &v(_privacyValueDisallowUsers());
+			split();
+			MTPDprivacyValueDisallowUsers &v(*(MTPDprivacyValueDisallowUsers*)data);
 			v.vusers.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPprivacyRule");
@@ -23546,11 +24374,11 @@ inline void MTPprivacyRule::read(const mtpPrime *&from, const mtpPrime *end, mtp
 inline void MTPprivacyRule::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_privacyValueAllowUsers: {
-			const MTPDprivacyValueAllowUsers &v(c_privacyValueAllowUsers());
+			const MTPDprivacyValueAllowUsers &v(*(const MTPDprivacyValueAllowUsers*)data);
 			v.vusers.write(to);
 		} break;
 		case mtpc_privacyValueDisallowUsers: {
-			const MTPDprivacyValueDisallowUsers &v(c_privacyValueDisallowUsers());
+			const MTPDprivacyValueDisallowUsers &v(*(const MTPDprivacyValueDisallowUsers*)data);
 			v.vusers.write(to);
 		} break;
 	}
@@ -23588,6 +24416,14 @@ inline MTPprivacyRule MTP_privacyValueDisallowAll() {
 inline MTPprivacyRule MTP_privacyValueDisallowUsers(const MTPVector<MTPint> &_users) {
 	return MTPprivacyRule(new MTPDprivacyValueDisallowUsers(_users));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPprivacyRule &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_privacyValueAllowUsers: visitor(*(const MTPDprivacyValueAllowUsers*)value.data); return true;
+	case mtpc_privacyValueDisallowUsers: visitor(*(const MTPDprivacyValueDisallowUsers*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPaccount_privacyRules::MTPaccount_privacyRules() : mtpDataOwner(new MTPDaccount_privacyRules()) {
 }
@@ -23677,23 +24513,23 @@ inline MTPaccount_sentChangePhoneCode MTP_account_sentChangePhoneCode(const MTPs
 inline uint32 MTPdocumentAttribute::innerLength() const {
 	switch (_type) {
 		case mtpc_documentAttributeImageSize: {
-			const MTPDdocumentAttributeImageSize &v(c_documentAttributeImageSize());
+			const MTPDdocumentAttributeImageSize &v(*(const MTPDdocumentAttributeImageSize*)data);
 			return v.vw.innerLength() + v.vh.innerLength();
 		}
 		case mtpc_documentAttributeSticker: {
-			const MTPDdocumentAttributeSticker &v(c_documentAttributeSticker());
+			const MTPDdocumentAttributeSticker &v(*(const MTPDdocumentAttributeSticker*)data);
 			return v.valt.innerLength();
 		}
 		case mtpc_documentAttributeVideo: {
-			const MTPDdocumentAttributeVideo &v(c_documentAttributeVideo());
+			const MTPDdocumentAttributeVideo &v(*(const MTPDdocumentAttributeVideo*)data);
 			return v.vduration.innerLength() + v.vw.innerLength() + v.vh.innerLength();
 		}
 		case mtpc_documentAttributeAudio: {
-			const MTPDdocumentAttributeAudio &v(c_documentAttributeAudio());
+			const MTPDdocumentAttributeAudio &v(*(const MTPDdocumentAttributeAudio*)data);
 			return v.vduration.innerLength();
 		}
 		case mtpc_documentAttributeFilename: {
-			const MTPDdocumentAttributeFilename &v(c_documentAttributeFilename());
+			const MTPDdocumentAttributeFilename &v(*(const MTPDdocumentAttributeFilename*)data);
 			return v.vfile_name.innerLength();
 		}
 	}
@@ -23708,31 +24544,36 @@ inline void MTPdocumentAttribute::read(const mtpPrime *&from, const mtpPrime *en
 	switch (cons) {
 		case mtpc_documentAttributeImageSize: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeImageSize());
-			MTPDdocumentAttributeImageSize &v(_documentAttributeImageSize());
+			split();
+			MTPDdocumentAttributeImageSize &v(*(MTPDdocumentAttributeImageSize*)data);
 			v.vw.read(from, end);
 			v.vh.read(from, end);
 		} break;
 		case mtpc_documentAttributeAnimated: _type = cons; break;
 		case mtpc_documentAttributeSticker: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeSticker());
-			MTPDdocumentAttributeSticker &v(_documentAttributeSticker());
+			split();
+			MTPDdocumentAttributeSticker &v(*(MTPDdocumentAttributeSticker*)data);
 			v.valt.read(from, end);
 		} break;
 		case mtpc_documentAttributeVideo: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeVideo());
-			MTPDdocumentAttributeVideo &v(_documentAttributeVideo());
+			split();
+			MTPDdocumentAttributeVideo &v(*(MTPDdocumentAttributeVideo*)data);
 			v.vduration.read(from, end);
 			v.vw.read(from, end);
 			v.vh.read(from, end);
 		} break;
 		case mtpc_documentAttributeAudio: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeAudio());
-			MTPDdocumentAttributeAudio &v(_documentAttributeAudio());
+			split();
+			MTPDdocumentAttributeAudio &v(*(MTPDdocumentAttributeAudio*)data);
 			v.vduration.read(from, end);
 		} break;
 		case mtpc_documentAttributeFilename: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeFilename());
-			MTPDdocumentAttributeFilename &v(_documentAttributeFilename());
+			split();
+			MTPDdocumentAttributeFilename &v(*(MTPDdocumentAttributeFilename*)data);
 			v.vfile_name.read(from, end);
 		} break;
 		default: throw mtpErrorUnexpected(cons, "MTPdocumentAttribute");
@@ -23741,26 +24582,26 @@ inline void MTPdocumentAttribute::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPdocumentAttribute::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_documentAttributeImageSize: {
-			const MTPDdocumentAttributeImageSize &v(c_documentAttributeImageSize());
+			const MTPDdocumentAttributeImageSize &v(*(const MTPDdocumentAttributeImageSize*)data);
 			v.vw.write(to);
 			v.vh.write(to);
 		} break;
 		case mtpc_documentAttributeSticker: {
-			const MTPDdocumentAttributeSticker &v(c_documentAttributeSticker());
+			const MTPDdocumentAttributeSticker &v(*(const MTPDdocumentAttributeSticker*)data);
 			v.valt.write(to);
 		} break;
 		case mtpc_documentAttributeVideo: {
-			const MTPDdocumentAttributeVideo &v(c_documentAttributeVideo());
+			const MTPDdocumentAttributeVideo &v(*(const MTPDdocumentAttributeVideo*)data);
 			v.vduration.write(to);
 			v.vw.write(to);
 			v.vh.write(to);
 		} break;
 		case mtpc_documentAttributeAudio: {
-			const MTPDdocumentAttributeAudio &v(c_documentAttributeAudio());
+			const MTPDdocumentAttributeAudio &v(*(const MTPDdocumentAttributeAudio*)data);
 			v.vduration.write(to);
 		} break;
 		case mtpc_documentAttributeFilename: {
-			const MTPDdocumentAttributeFilename &v(c_documentAttributeFilename());
+			const MTPDdocumentAttributeFilename &v(*(const MTPDdocumentAttributeFilename*)data);
 			v.vfile_name.write(to);
 		} break;
 	}
@@ -23804,11 +24645,22 @@ inline MTPdocumentAttribute MTP_documentAttributeAudio(MTPint _duration) {
 inline MTPdocumentAttribute MTP_documentAttributeFilename(const MTPstring &_file_name) {
 	return MTPdocumentAttribute(new MTPDdocumentAttributeFilename(_file_name));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPdocumentAttribute &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_documentAttributeImageSize: visitor(*(const MTPDdocumentAttributeImageSize*)value.data); return true;
+	case mtpc_documentAttributeSticker: visitor(*(const MTPDdocumentAttributeSticker*)value.data); return true;
+	case mtpc_documentAttributeVideo: visitor(*(const MTPDdocumentAttributeVideo*)value.data); return true;
+	case mtpc_documentAttributeAudio: visitor(*(const MTPDdocumentAttributeAudio*)value.data); return true;
+	case mtpc_documentAttributeFilename: visitor(*(const MTPDdocumentAttributeFilename*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline uint32 MTPmessages_stickers::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_stickers: {
-			const MTPDmessages_stickers &v(c_messages_stickers());
+			const MTPDmessages_stickers &v(*(const MTPDmessages_stickers*)data);
 			return v.vhash.innerLength() + v.vstickers.innerLength();
 		}
 	}
@@ -23824,7 +24676,8 @@ inline void MTPmessages_stickers::read(const mtpPrime *&from, const mtpPrime *en
 		case mtpc_messages_stickersNotModified: _type = cons; break;
 		case mtpc_messages_stickers: _type = cons; {
 			if (!data) setData(new MTPDmessages_stickers());
-			MTPDmessages_stickers &v(_messages_stickers());
+			split();
+			MTPDmessages_stickers &v(*(MTPDmessages_stickers*)data);
 			v.vhash.read(from, end);
 			v.vstickers.read(from, end);
 		} break;
@@ -23834,7 +24687,7 @@ inline void MTPmessages_stickers::read(const mtpPrime *&from, const mtpPrime *en
 inline void MTPmessages_stickers::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_stickers: {
-			const MTPDmessages_stickers &v(c_messages_stickers());
+			const MTPDmessages_stickers &v(*(const MTPDmessages_stickers*)data);
 			v.vhash.write(to);
 			v.vstickers.write(to);
 		} break;
@@ -23855,6 +24708,13 @@ inline MTPmessages_stickers MTP_messages_stickersNotModified() {
 inline MTPmessages_stickers MTP_messages_stickers(const MTPstring &_hash, const MTPVector<MTPDocument> &_stickers) {
 	return MTPmessages_stickers(new MTPDmessages_stickers(_hash, _stickers));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_stickers &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_stickers: visitor(*(const MTPDmessages_stickers*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPstickerPack::MTPstickerPack() : mtpDataOwner(new MTPDstickerPack()) {
 }
@@ -23888,7 +24748,7 @@ inline MTPstickerPack MTP_stickerPack(const MTPstring &_emoticon, const MTPVecto
 inline uint32 MTPmessages_allStickers::innerLength() const {
 	switch (_type) {
 		case mtpc_messages_allStickers: {
-			const MTPDmessages_allStickers &v(c_messages_allStickers());
+			const MTPDmessages_allStickers &v(*(const MTPDmessages_allStickers*)data);
 			return v.vhash.innerLength() + v.vpacks.innerLength() + v.vdocuments.innerLength();
 		}
 	}
@@ -23904,7 +24764,8 @@ inline void MTPmessages_allStickers::read(const mtpPrime *&from, const mtpPrime
 		case mtpc_messages_allStickersNotModified: _type = cons; break;
 		case mtpc_messages_allStickers: _type = cons; {
 			if (!data) setData(new MTPDmessages_allStickers());
-			MTPDmessages_allStickers &v(_messages_allStickers());
+			split();
+			MTPDmessages_allStickers &v(*(MTPDmessages_allStickers*)data);
 			v.vhash.read(from, end);
 			v.vpacks.read(from, end);
 			v.vdocuments.read(from, end);
@@ -23915,7 +24776,7 @@ inline void MTPmessages_allStickers::read(const mtpPrime *&from, const mtpPrime
 inline void MTPmessages_allStickers::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_messages_allStickers: {
-			const MTPDmessages_allStickers &v(c_messages_allStickers());
+			const MTPDmessages_allStickers &v(*(const MTPDmessages_allStickers*)data);
 			v.vhash.write(to);
 			v.vpacks.write(to);
 			v.vdocuments.write(to);
@@ -23937,6 +24798,13 @@ inline MTPmessages_allStickers MTP_messages_allStickersNotModified() {
 inline MTPmessages_allStickers MTP_messages_allStickers(const MTPstring &_hash, const MTPVector<MTPStickerPack> &_packs, const MTPVector<MTPDocument> &_documents) {
 	return MTPmessages_allStickers(new MTPDmessages_allStickers(_hash, _packs, _documents));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPmessages_allStickers &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_messages_allStickers: visitor(*(const MTPDmessages_allStickers*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPdisabledFeature::MTPdisabledFeature() : mtpDataOwner(new MTPDdisabledFeature()) {
 }
@@ -24041,15 +24909,15 @@ inline MTPcontactLink MTP_contactLinkContact() {
 inline uint32 MTPwebPage::innerLength() const {
 	switch (_type) {
 		case mtpc_webPageEmpty: {
-			const MTPDwebPageEmpty &v(c_webPageEmpty());
+			const MTPDwebPageEmpty &v(*(const MTPDwebPageEmpty*)data);
 			return v.vid.innerLength();
 		}
 		case mtpc_webPagePending: {
-			const MTPDwebPagePending &v(c_webPagePending());
+			const MTPDwebPagePending &v(*(const MTPDwebPagePending*)data);
 			return v.vid.innerLength() + v.vdate.innerLength();
 		}
 		case mtpc_webPage: {
-			const MTPDwebPage &v(c_webPage());
+			const MTPDwebPage &v(*(const MTPDwebPage*)data);
 			return v.vflags.innerLength() + v.vid.innerLength() + v.vurl.innerLength() + v.vdisplay_url.innerLength() + (v.has_type() ? v.vtype.innerLength() : 0) + (v.has_site_name() ? v.vsite_name.innerLength() : 0) + (v.has_title() ? v.vtitle.innerLength() : 0) + (v.has_description() ? v.vdescription.innerLength() : 0) + (v.has_photo() ? v.vphoto.innerLength() : 0) + (v.has_embed_url() ? v.vembed_url.innerLength() : 0) + (v.has_embed_type() ? v.vembed_type.innerLength() : 0) + (v.has_embed_width() ? v.vembed_width.innerLength() : 0) + (v.has_embed_height() ? v.vembed_height.innerLength() : 0) + (v.has_duration() ? v.vduration.innerLength() : 0) + (v.has_author() ? v.vauthor.innerLength() : 0);
 		}
 	}
@@ -24064,18 +24932,21 @@ inline void MTPwebPage::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 	switch (cons) {
 		case mtpc_webPageEmpty: _type = cons; {
 			if (!data) setData(new MTPDwebPageEmpty());
-			MTPDwebPageEmpty &v(_webPageEmpty());
+			split();
+			MTPDwebPageEmpty &v(*(MTPDwebPageEmpty*)data);
 			v.vid.read(from, end);
 		} break;
 		case mtpc_webPagePending: _type = cons; {
 			if (!data) setData(new MTPDwebPagePending());
-			MTPDwebPagePending &v(_webPagePending());
+			split();
+			MTPDwebPagePending &v(*(MTPDwebPagePending*)data);
 			v.vid.read(from, end);
 			v.vdate.read(from, end);
 		} break;
 		case mtpc_webPage: _type = cons; {
 			if (!data) setData(new MTPDwebPage());
-			MTPDwebPage &v(_webPage());
+			split();
+			MTPDwebPage &v(*(MTPDwebPage*)data);
 			v.vflags.read(from, end);
 			v.vid.read(from, end);
 			v.vurl.read(from, end);
@@ -24098,16 +24969,16 @@ inline void MTPwebPage::read(const mtpPrime *&from, const mtpPrime *end, mtpType
 inline void MTPwebPage::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_webPageEmpty: {
-			const MTPDwebPageEmpty &v(c_webPageEmpty());
+			const MTPDwebPageEmpty &v(*(const MTPDwebPageEmpty*)data);
 			v.vid.write(to);
 		} break;
 		case mtpc_webPagePending: {
-			const MTPDwebPagePending &v(c_webPagePending());
+			const MTPDwebPagePending &v(*(const MTPDwebPagePending*)data);
 			v.vid.write(to);
 			v.vdate.write(to);
 		} break;
 		case mtpc_webPage: {
-			const MTPDwebPage &v(c_webPage());
+			const MTPDwebPage &v(*(const MTPDwebPage*)data);
 			v.vflags.write(to);
 			v.vid.write(to);
 			v.vurl.write(to);
@@ -24149,6 +25020,15 @@ inline MTPwebPage MTP_webPagePending(const MTPlong &_id, MTPint _date) {
 inline MTPwebPage MTP_webPage(MTPint _flags, const MTPlong &_id, const MTPstring &_url, const MTPstring &_display_url, const MTPstring &_type, const MTPstring &_site_name, const MTPstring &_title, const MTPstring &_description, const MTPPhoto &_photo, const MTPstring &_embed_url, const MTPstring &_embed_type, MTPint _embed_width, MTPint _embed_height, MTPint _duration, const MTPstring &_author) {
 	return MTPwebPage(new MTPDwebPage(_flags, _id, _url, _display_url, _type, _site_name, _title, _description, _photo, _embed_url, _embed_type, _embed_width, _embed_height, _duration, _author));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPwebPage &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_webPageEmpty: visitor(*(const MTPDwebPageEmpty*)value.data); return true;
+	case mtpc_webPagePending: visitor(*(const MTPDwebPagePending*)value.data); return true;
+	case mtpc_webPage: visitor(*(const MTPDwebPage*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPauthorization::MTPauthorization() : mtpDataOwner(new MTPDauthorization()) {
 }
@@ -24231,11 +25111,11 @@ inline MTPaccount_authorizations MTP_account_authorizations(const MTPVector<MTPA
 inline uint32 MTPaccount_password::innerLength() const {
 	switch (_type) {
 		case mtpc_account_noPassword: {
-			const MTPDaccount_noPassword &v(c_account_noPassword());
+			const MTPDaccount_noPassword &v(*(const MTPDaccount_noPassword*)data);
 			return v.vnew_salt.innerLength() + v.vemail_unconfirmed_pattern.innerLength();
 		}
 		case mtpc_account_password: {
-			const MTPDaccount_password &v(c_account_password());
+			const MTPDaccount_password &v(*(const MTPDaccount_password*)data);
 			return v.vcurrent_salt.innerLength() + v.vnew_salt.innerLength() + v.vhint.innerLength() + v.vhas_recovery.innerLength() + v.vemail_unconfirmed_pattern.innerLength();
 		}
 	}
@@ -24250,13 +25130,15 @@ inline void MTPaccount_password::read(const mtpPrime *&from, const mtpPrime *end
 	switch (cons) {
 		case mtpc_account_noPassword: _type = cons; {
 			if (!data) setData(new MTPDaccount_noPassword());
-			MTPDaccount_noPassword &v(_account_noPassword());
+			split();
+			MTPDaccount_noPassword &v(*(MTPDaccount_noPassword*)data);
 			v.vnew_salt.read(from, end);
 			v.vemail_unconfirmed_pattern.read(from, end);
 		} break;
 		case mtpc_account_password: _type = cons; {
 			if (!data) setData(new MTPDaccount_password());
-			MTPDaccount_password &v(_account_password());
+			split();
+			MTPDaccount_password &v(*(MTPDaccount_password*)data);
 			v.vcurrent_salt.read(from, end);
 			v.vnew_salt.read(from, end);
 			v.vhint.read(from, end);
@@ -24269,12 +25151,12 @@ inline void MTPaccount_password::read(const mtpPrime *&from, const mtpPrime *end
 inline void MTPaccount_password::write(mtpBuffer &to) const {
 	switch (_type) {
 		case mtpc_account_noPassword: {
-			const MTPDaccount_noPassword &v(c_account_noPassword());
+			const MTPDaccount_noPassword &v(*(const MTPDaccount_noPassword*)data);
 			v.vnew_salt.write(to);
 			v.vemail_unconfirmed_pattern.write(to);
 		} break;
 		case mtpc_account_password: {
-			const MTPDaccount_password &v(c_account_password());
+			const MTPDaccount_password &v(*(const MTPDaccount_password*)data);
 			v.vcurrent_salt.write(to);
 			v.vnew_salt.write(to);
 			v.vhint.write(to);
@@ -24300,6 +25182,14 @@ inline MTPaccount_password MTP_account_noPassword(const MTPbytes &_new_salt, con
 inline MTPaccount_password MTP_account_password(const MTPbytes &_current_salt, const MTPbytes &_new_salt, const MTPstring &_hint, MTPBool _has_recovery, const MTPstring &_email_unconfirmed_pattern) {
 	return MTPaccount_password(new MTPDaccount_password(_current_salt, _new_salt, _hint, _has_recovery, _email_unconfirmed_pattern));
 }
+template <typename Visitor>
+inline bool mtpVisit(const MTPaccount_password &value, Visitor &visitor) {
+	switch (value._type) {
+	case mtpc_account_noPassword: visitor(*(const MTPDaccount_noPassword*)value.data); return true;
+	case mtpc_account_password: visitor(*(const MTPDaccount_password*)value.data); return true;
+	}
+	return false; // constructor without data
+}
 
 inline MTPaccount_passwordSettings::MTPaccount_passwordSettings() : mtpDataOwner(new MTPDaccount_passwordSettings()) {
 }
@@ -46,6 +46,7 @@ void MTPSessionData::clear() {
 	{
 		QWriteLocker locker(haveSentMutex());
 		haveSent.clear();
+		haveSentTimes.clear();
 	}
 	{
 		QWriteLocker locker(toResendMutex());
@@ -63,7 +64,9 @@ void MTPSessionData::clear() {
 }
 
 
-MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0), msSendCall(0), msWait(0), _ping(false) {
+MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0)
+, _metricToSend(0), _metricRequests(0), _metricRequestsResent(0), _metricStateRequests(0), _metricResendTimeout(0)
+, msSendCall(0), msWait(0), _ping(false) {
 }
 
 void MTProtoSession::start(int32 dcenter) {
@@ -75,7 +78,7 @@ void MTProtoSession::start(int32 dcenter) {
 	msSendCall = msWait = 0;
 
 	connect(&timeouter, SIGNAL(timeout()), this, SLOT(checkRequestsByTimer()));
-	timeouter.start(1000);
+	timeouter.start(MTPCheckResendPeriod);
 
 	connect(&sender, SIGNAL(timeout()), this, SLOT(needToResumeAndSend()));
 
@@ -95,6 +98,11 @@ void MTProtoSession::start(int32 dcenter) {
 		}
 		if (!dc) {
 			dcenter = dcId;
+			_metricToSend = metricGauge(qsl("mtp.dc%1.to_send").arg(dcId));
+			_metricRequests = metricCounter(qsl("mtp.dc%1.requests").arg(dcId));
+			_metricRequestsResent = metricCounter(qsl("mtp.dc%1.requests_resent").arg(dcId));
+			_metricStateRequests = metricCounter(qsl("mtp.dc%1.state_requests").arg(dcId));
+			_metricResendTimeout = metricGauge(qsl("mtp.dc%1.resend_timeout_ms").arg(dcId));
 			MTProtoDCMap::const_iterator dcIndex = dcs.constFind(dcId % _mtp_internal::dcShift);
 			if (dcIndex == dcs.cend()) {
 				dc = MTProtoDCPtr(new MTProtoDC(dcId % _mtp_internal::dcShift, mtpAuthKeyPtr()));
@@ -199,32 +207,46 @@ void MTProtoSession::checkRequestsByTimer() {
 	QVector<mtpMsgId> stateRequestIds;
 
 	{
-		QReadLocker locker(data.haveSentMutex());
+		QWriteLocker locker(data.haveSentMutex());
 		mtpRequestMap &haveSent(data.haveSentMap());
-		uint32 haveSentCount(haveSent.size());
-		uint64 ms = getms(true);
-		for (mtpRequestMap::iterator i = haveSent.begin(), e = haveSent.end(); i != e; ++i) {
+		mtpMsgIdsByTime &haveSentTimes(data.haveSentTimesMap());
+		uint64 ms = getms(true), timeout = data.resendTimeout();
+		while (!haveSentTimes.isEmpty() && haveSentTimes.cbegin().key() <= ms) {
+			mtpMsgId msgId = haveSentTimes.cbegin().value();
+			haveSentTimes.erase(haveSentTimes.begin());
+
+			mtpRequestMap::iterator i = haveSent.find(msgId);
+			if (i == haveSent.end()) continue; // acked or replaced already
+
 			mtpRequest &req(i.value());
 			if (req->msDate > 0) {
-				if (req->msDate + MTPCheckResendTimeout < ms) { // need to resend or check state
-					if (mtpRequestData::messageSize(req) < MTPResendThreshold) { // resend
-						resendingIds.reserve(haveSentCount);
-						resendingIds.push_back(i.key());
-					} else {
-						req->msDate = ms;
-						stateRequestIds.reserve(haveSentCount);
-						stateRequestIds.push_back(i.key());
-					}
+				if (req->msDate + timeout > ms) { // timeout has grown since the check was planned
+					haveSentTimes.insert(req->msDate + timeout, msgId);
+				} else if (mtpRequestData::messageSize(req) < MTPResendThreshold) { // resend
+					resendingIds.push_back(msgId);
+				} else {
+					req->msDate = ms;
+					req->rttSkip = true;
+					stateRequestIds.push_back(msgId);
 				}
-			} else if (unixtime() > (int32)(i.key() >> 32) + MTPContainerLives) {
-				removingIds.reserve(haveSentCount);
-				removingIds.push_back(i.key());
+			} else { // very old container or state request
+				removingIds.push_back(msgId);
+			}
+		}
+
+		if (!resendingIds.isEmpty() || !stateRequestIds.isEmpty()) {
+			data.resendTimedOut();
+			timeout = data.resendTimeout();
+			metricSet(_metricResendTimeout, timeout);
+			for (QVector<mtpMsgId>::const_iterator i = stateRequestIds.cbegin(), e = stateRequestIds.cend(); i != e; ++i) {
+				haveSentTimes.insert(ms + timeout, *i);
 			}
 		}
 	}
 
 	if (stateRequestIds.size()) {
 		DEBUG_LOG(("MTP Info: requesting state of msgs: %1").arg(logVectorLong(stateRequestIds)));
+		metricAdd(_metricStateRequests, stateRequestIds.size());
 		{
 			QWriteLocker locker(data.stateRequestMutex());
 			for (uint32 i = 0, l = stateRequestIds.size(); i < l; ++i) {
@@ -411,12 +433,17 @@ void MTProtoSession::sendPrepared(const mtpRequest &request, uint64 msCanWait, b
 	{
 		QWriteLocker locker(data.toSendMutex());
 		data.toSendMap().insert(request->requestId, request);
+		request->toSendDate = getms(true);
 
 		if (newRequest) {
 			*(mtpMsgId*)(request->data() + 4) = 0;
 			*(request->data() + 6) = 0;
+		} else {
+			request->rttSkip = true;
 		}
+		metricSet(_metricToSend, data.toSendMap().size());
 	}
+	metricAdd(newRequest ? _metricRequests : _metricRequestsResent);
 
 	DEBUG_LOG(("MTP Info: added, requestId %1").arg(request->requestId));
 
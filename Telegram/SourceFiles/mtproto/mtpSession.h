@@ -29,7 +29,8 @@ public:
 	MTPSessionData(MTProtoSession *creator)
 	: _session(0), _salt(0)
 	, _messagesSent(0), _fakeRequestId(-2000000000)
-	, _owner(creator), _keyChecked(false), _layerInited(false) {
+	, _owner(creator), _keyChecked(false), _layerInited(false)
+	, _srtt(0), _rttvar(0), _rtoBackoff(0) {
 	}
 
 	void setSession(uint64 session) {
@@ -82,6 +83,31 @@ public:
 		}
 	}
 
+	void rttSample(uint64 ms) { // smoothed rtt and its variation, like in tcp
+		QWriteLocker locker(&lock);
+		if (!_srtt) {
+			_srtt = ms ? ms : 1;
+			_rttvar = ms / 2;
+		} else {
+			uint64 delta = (_srtt > ms) ? (_srtt - ms) : (ms - _srtt);
+			_rttvar = (3 * _rttvar + delta) / 4;
+			_srtt = (7 * _srtt + ms) / 8;
+			if (!_srtt) _srtt = 1;
+		}
+		_rtoBackoff = 0;
+	}
+	uint64 resendTimeout() const {
+		QReadLocker locker(&lock);
+		if (!_srtt) return MTPCheckResendTimeout;
+
+		uint64 result = (_srtt + qMax(uint64(MTPCheckResendPeriod), 4 * _rttvar)) << _rtoBackoff;
+		return qMin(qMax(result, uint64(MTPCheckResendMinTimeout)), uint64(MTPCheckResendTimeout));
+	}
+	void resendTimedOut() {
+		QWriteLocker locker(&lock);
+		if (_rtoBackoff < MTPCheckResendMaxBackoff) ++_rtoBackoff;
+	}
+
 	bool isCheckedKey() const {
 		QReadLocker locker(&lock);
 		return _keyChecked;
@@ -151,6 +177,13 @@ public:
 	const mtpResponseMap &haveReceivedMap() const {
 		return haveReceived;
 	}
+	mtpMsgIdsByTime &haveSentTimesMap() { // locked by haveSentMutex()
+		return haveSentTimes;
+	}
+	void haveSentCheckAt(mtpMsgId msgId, const mtpRequest &request) { // haveSentMutex() must be locked for write
+		uint64 at = (request->msDate > 0) ? (request->msDate + resendTimeout()) : (getms(true) + MTPContainerLives * 1000ULL);
+		haveSentTimes.insert(at, msgId);
+	}
 	mtpMsgIdsSet &stateRequestMap() {
 		return stateRequest;
 	}
@@ -194,8 +227,12 @@ private:
 	mtpAuthKeyPtr _authKey;
 	bool _keyChecked, _layerInited;
 
+	uint64 _srtt, _rttvar; // in ms
+	int32 _rtoBackoff;
+
 	mtpPreRequestMap toSend; // map of request_id -> request, that is waiting to be sent
 	mtpRequestMap haveSent; // map of msg_id -> request, that was sent, msDate = 0 for msgs_state_req (no resend / state req), msDate = 0, seqNo = 0 for containers
+	mtpMsgIdsByTime haveSentTimes; // map of check time -> msg_id from haveSent, entries of already removed msg_ids are skipped when checked
 	mtpRequestIdsMap toResend; // map of msg_id -> request_id, that request_id -> request lies in toSend and is waiting to be resent
 	mtpMsgIdsMap receivedIds; // set of received msg_id's, for checking new msg_ids
 	mtpRequestIdsMap wereAcked; // map of msg_id -> request_id, this msg_ids already were acked or do not need ack
@@ -234,7 +271,7 @@ public:
 	void notifyLayerInited(bool wasInited);
 
 	template <typename TRequest>
-	mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), uint64 msCanWait = 0, bool needsLayer = false, bool toMainDC = false, mtpRequestId after = 0); // send mtp request
+	mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), uint64 msCanWait = 0, bool needsLayer = false, bool toMainDC = false, mtpRequestId after = 0, MTPRequestPriority priority = MTPRequestNormal); // send mtp request
 
 	void ping();
 	void cancel(mtpRequestId requestId, mtpMsgId msgId);
@@ -281,6 +318,8 @@ private:
 	int32 dcId;
 	MTProtoDCPtr dc;
 
+	MetricHandle _metricToSend, _metricRequests, _metricRequestsResent, _metricStateRequests, _metricResendTimeout; // registered in start()
+
 	uint64 msSendCall, msWait;
 
 	bool _ping;
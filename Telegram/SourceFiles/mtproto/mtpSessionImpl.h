@@ -18,7 +18,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #pragma once
 
 template <typename TRequest>
-mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler callbacks, uint64 msCanWait, bool needsLayer, bool toMainDC, mtpRequestId after) {
+mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler callbacks, uint64 msCanWait, bool needsLayer, bool toMainDC, mtpRequestId after, MTPRequestPriority priority) {
     mtpRequestId requestId = 0;
     try {
 		uint32 requestSize = request.innerLength() >> 2;
@@ -29,6 +29,7 @@ mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler ca
 
         reqSerialized->msDate = getms(true); // > 0 - can send without container
 		reqSerialized->needsLayer = needsLayer;
+		reqSerialized->priority = priority;
 		if (after) reqSerialized->after = _mtp_internal::getRequest(after);
 		requestId = _mtp_internal::storeRequest(reqSerialized, callbacks);
 
@@ -39,6 +39,10 @@ OverviewInner::OverviewInner(OverviewWidget *overview, ScrollArea *scroll, const
 	, _hist(App::history(peer->id))
 	, _photosInRow(1)
 	, _photosToAdd(0)
+	, _vsize(0)
+	, _cachedUsed(0)
+	, _lastScrollTop(0)
+	, _genPixVisible(false)
 	, _selMode(false)
 	, _width(0)
 	, _height(0)
@@ -73,6 +77,9 @@ OverviewInner::OverviewInner(OverviewWidget *overview, ScrollArea *scroll, const
 	setAttribute(Qt::WA_AcceptTouchEvents);
 	connect(&_touchScrollTimer, SIGNAL(timeout()), this, SLOT(onTouchScrollTimer()));
 
+	_genPixTimer.setSingleShot(true);
+	connect(&_genPixTimer, SIGNAL(timeout()), this, SLOT(onGenPix()));
+
 	mediaOverviewUpdated();
 	setMouseTracking(true);
 }
@@ -545,9 +552,24 @@ QPoint OverviewInner::mapMouseToItem(QPoint p, MsgId itemId, int32 itemIndex) {
 
 void OverviewInner::clear() {
 	_cached.clear();
+	_preloadPhotos.clear();
+}
+
+bool OverviewInner::loadPhoto(PhotoData *photo) {
+	bool medium = photo->full->loaded();
+	if (!medium) {
+		if (photo->thumb->loaded()) {
+			photo->medium->load(false, false);
+			medium = photo->medium->loaded();
+		} else {
+			photo->thumb->load();
+		}
+	}
+	return medium;
 }
 
 QPixmap OverviewInner::genPix(PhotoData *photo, int32 size) {
+	uint64 ms = getms(true);
 	size *= cIntRetinaFactor();
 	QImage img = (photo->full->loaded() ? photo->full : (photo->medium->loaded() ? photo->medium : photo->thumb))->pix().toImage();
 	if (!photo->full->loaded() && !photo->medium->loaded()) {
@@ -564,7 +586,105 @@ QPixmap OverviewInner::genPix(PhotoData *photo, int32 size) {
 	}
 	img.setDevicePixelRatio(cRetinaFactor());
 	photo->forget();
-	return QPixmap::fromImage(img, Qt::ColorOnly);
+	QPixmap result(QPixmap::fromImage(img, Qt::ColorOnly));
+	static MetricHandle overviewGenPixMsMetric = metricHistogram(qsl("overview.gen_pix_ms"));
+	metricSample(overviewGenPixMsMetric, getms(true) - ms);
+	return result;
+}
+
+const QPixmap *OverviewInner::cachedPix(PhotoData *photo, bool medium, uint64 genTill) {
+	CachedSizes::iterator it = _cached.find(photo);
+	if (it != _cached.cend() && it->medium == medium && it->vsize == _vsize) {
+		it->used = ++_cachedUsed;
+		return &it->pix;
+	}
+	if (getms(true) >= genTill) { // frame budget is spent, paint what we have and finish in the next frame
+		_genPixVisible = true;
+		if (!_genPixTimer.isActive()) _genPixTimer.start(0);
+		if (it == _cached.cend()) return 0;
+
+		it->used = ++_cachedUsed;
+		return &it->pix;
+	}
+	cachePix(photo, medium);
+	return &_cached[photo].pix;
+}
+
+void OverviewInner::cachePix(PhotoData *photo, bool medium) {
+	CachedSizes::iterator it = _cached.find(photo);
+	if (it == _cached.cend()) {
+		if (_cached.size() >= MediaOverviewPhotosCacheCount) {
+			CachedSizes::iterator oldest = _cached.begin();
+			for (CachedSizes::iterator i = oldest, e = _cached.end(); i != e; ++i) {
+				if (i->used < oldest->used) oldest = i;
+			}
+			_cached.erase(oldest);
+		}
+		it = _cached.insert(photo, CachedSize());
+	}
+	it->medium = medium;
+	it->vsize = _vsize;
+	it->used = ++_cachedUsed;
+	it->pix = genPix(photo, _vsize);
+}
+
+void OverviewInner::preloadPhotos(int32 scrollTop, int32 scrollHeight) {
+	bool down = (scrollTop >= _lastScrollTop);
+	_lastScrollTop = scrollTop;
+	_preloadPhotos.clear();
+	if (_type != OverviewPhotos || _vsize <= 0) return;
+
+	int32 from = down ? (scrollTop + scrollHeight) : (scrollTop - scrollHeight);
+	int32 rowFrom = int32(from - _addToY - st::overviewPhotoSkip) / int32(_vsize + st::overviewPhotoSkip);
+	int32 rowTo = int32(from + scrollHeight - _addToY - st::overviewPhotoSkip) / int32(_vsize + st::overviewPhotoSkip) + 1;
+	if (rowFrom < 0) rowFrom = 0;
+
+	History::MediaOverview &overview(_hist->_overview[_type]);
+	int32 count = overview.size();
+	for (int32 row = rowFrom; row < rowTo; ++row) {
+		if (row * _photosInRow >= _photosToAdd + count) break;
+		for (int32 i = 0; i < _photosInRow; ++i) {
+			int32 index = row * _photosInRow + i - _photosToAdd;
+			if (index < 0) continue;
+			if (index >= count) break;
+
+			HistoryItem *item = App::histItemById(overview[index]);
+			HistoryMedia *m = item ? item->getMedia(true) : 0;
+			if (!m || m->type() != MediaTypePhoto) continue;
+
+			PhotoData *photo = static_cast<HistoryPhoto*>(m)->photo();
+			loadPhoto(photo);
+			_preloadPhotos.push_back(photo);
+		}
+	}
+	if (!_preloadPhotos.isEmpty() && !_genPixTimer.isActive()) {
+		_genPixTimer.start(0);
+	}
+}
+
+void OverviewInner::onGenPix() {
+	if (_genPixVisible) { // visible cells go first, paintEvent will restart the timer for the rest
+		_genPixVisible = false;
+		update();
+		return;
+	}
+
+	uint64 genTill = getms(true) + MediaOverviewGenPixTimeout;
+	while (!_preloadPhotos.isEmpty() && getms(true) < genTill) {
+		PhotoData *photo = _preloadPhotos.front();
+		_preloadPhotos.pop_front();
+
+		bool medium = loadPhoto(photo);
+		if (!medium && !photo->thumb->loaded()) continue;
+
+		CachedSizes::const_iterator it = _cached.constFind(photo);
+		if (it != _cached.cend() && it->medium == medium && it->vsize == _vsize) continue;
+
+		cachePix(photo, medium);
+	}
+	if (!_preloadPhotos.isEmpty()) {
+		_genPixTimer.start(0);
+	}
 }
 
 void OverviewInner::paintEvent(QPaintEvent *e) {
@@ -589,6 +709,7 @@ void OverviewInner::paintEvent(QPaintEvent *e) {
 	bool hasSel = !_selected.isEmpty();
 
 	if (_type == OverviewPhotos) {
+		uint64 ms = getms(true), genTill = ms + MediaOverviewGenPixTimeout;
 		int32 rowFrom = int32(r.top() - _addToY - st::overviewPhotoSkip) / int32(_vsize + st::overviewPhotoSkip);
 		int32 rowTo = int32(r.bottom() - _addToY - st::overviewPhotoSkip) / int32(_vsize + st::overviewPhotoSkip) + 1;
 		History::MediaOverview &overview(_hist->_overview[_type]);
@@ -608,29 +729,16 @@ void OverviewInner::paintEvent(QPaintEvent *e) {
 				switch (m->type()) {
 				case MediaTypePhoto: {
 					PhotoData *photo = static_cast<HistoryPhoto*>(m)->photo();
-					bool quality = photo->full->loaded();
-					if (!quality) {
-						if (photo->thumb->loaded()) {
-							photo->medium->load(false, false);
-							quality = photo->medium->loaded();
-						} else {
-							photo->thumb->load();
+					bool quality = loadPhoto(photo);
+					const QPixmap *pix = cachedPix(photo, quality, genTill);
+					QPoint pos(int32(i * w + st::overviewPhotoSkip), _addToY + row * (_vsize + st::overviewPhotoSkip) + st::overviewPhotoSkip);
+					if (pix) {
+						if (pix->width() == _vsize * cIntRetinaFactor()) {
+							p.drawPixmap(pos, *pix);
+						} else { // stale cell from before resize, regenerated in the next frames
+							p.drawPixmap(QRect(pos.x(), pos.y(), _vsize, _vsize), *pix);
 						}
 					}
-					CachedSizes::iterator it = _cached.find(photo);
-					if (it == _cached.cend()) {
-						CachedSize size;
-						size.medium = quality;
-						size.vsize = _vsize;
-						size.pix = genPix(photo, _vsize);
-						it = _cached.insert(photo, size);
-					} else if (it->medium != quality || it->vsize != _vsize) {
-						it->medium = quality;
-						it->vsize = _vsize;
-						it->pix = genPix(photo, _vsize);
-					}
-					QPoint pos(int32(i * w + st::overviewPhotoSkip), _addToY + row * (_vsize + st::overviewPhotoSkip) + st::overviewPhotoSkip);
-					p.drawPixmap(pos, it->pix);
 					if (!quality) {
 						uint64 dt = itemAnimations().animate(item, getms());
 						int32 cnt = int32(st::photoLoaderCnt), period = int32(st::photoLoaderPeriod), t = dt % period, delta = int32(st::photoLoaderDelta);
@@ -671,6 +779,11 @@ void OverviewInner::paintEvent(QPaintEvent *e) {
 				}
 			}
 		}
+		if (!_genPixVisible && !_preloadPhotos.isEmpty() && !_genPixTimer.isActive()) {
+			_genPixTimer.start(0);
+		}
+		static MetricHandle overviewPaintMsMetric = metricHistogram(qsl("overview.paint_ms"));
+		metricSample(overviewPaintMsMetric, getms(true) - ms);
 	} else {
 		p.translate(0, st::msgMargin.top() + _addToY);
 		int32 y = 0, w = _width - st::msgMargin.left() - st::msgMargin.right();
@@ -688,7 +801,7 @@ void OverviewInner::paintEvent(QPaintEvent *e) {
 						bool out = item->out();
 						int32 mw = media->maxWidth(), left = (out ? st::msgMargin.right() : st::msgMargin.left()) + (out && mw < w ? (w - mw) : 0);
 						if (!out && _hist->peer->chat) {
-							p.drawPixmap(left, media->countHeight(item, w) - st::msgPhotoSize, item->from()->photo->pix(st::msgPhotoSize));
+							item->from()->photo->paintSmall(p, left, media->countHeight(item, w) - st::msgPhotoSize, st::msgPhotoSize);
 							left += st::msgPhotoSkip;
 						}
 
@@ -1152,6 +1265,7 @@ void OverviewInner::switchType(MediaOverviewType type) {
 		_dragItem = _mousedItem = _dragSelFrom = _dragSelTo = 0;
 		_items.clear();
 		_cached.clear();
+		_preloadPhotos.clear();
 		_type = type;
 	}
 	mediaOverviewUpdated();
@@ -1552,6 +1666,7 @@ OverviewWidget::OverviewWidget(QWidget *parent, const PeerData *peer, MediaOverv
 	_scroll.show();
 	connect(&_scroll, SIGNAL(scrolled()), &_inner, SLOT(onUpdateSelected()));
 	connect(&_scroll, SIGNAL(scrolled()), this, SLOT(onScroll()));
+	connect(&_scroll, SIGNAL(scrolledFrame()), this, SLOT(onScrollFrame()));
 
 	connect(&_scrollTimer, SIGNAL(timeout()), this, SLOT(onScrollTimer()));
 	_scrollTimer.setSingleShot(false);
@@ -1564,14 +1679,20 @@ void OverviewWidget::clear() {
 }
 
 void OverviewWidget::onScroll() {
+	if (!_noDropResizeIndex) {
+		_inner.dropResizeIndex();
+	}
+}
+
+void OverviewWidget::onScrollFrame() {
 	MTP::clearLoaderPriorities();
 	if (_scroll.scrollTop() < _scroll.height() * 5) {
 		if (App::main()) {
 			App::main()->loadMediaBack(peer(), type(), true);
 		}
 	}
-	if (!_noDropResizeIndex) {
-		_inner.dropResizeIndex();
+	if (qAbs(_scroll.scrollSpeed()) < ScrollFastSpeed) { // photos a screen ahead are loaded when scrolling slows down
+		_inner.preloadPhotos(_scroll.scrollTop(), _scroll.height());
 	}
 }
 
@@ -1682,6 +1803,7 @@ void OverviewWidget::switchType(MediaOverviewType type) {
 	updateTopBarSelection();
 	_scroll.scrollToY(_scroll.scrollTopMax());
 	onScroll();
+	onScrollFrame();
 }
 
 void OverviewWidget::updateTopBarSelection() {
@@ -1746,6 +1868,7 @@ bool OverviewWidget::animStep(float64 ms) {
 		_scroll.scrollToY(_scrollSetAfterShow);
 		activate();
 		onScroll();
+		onScrollFrame();
 	} else {
 		a_bgCoord.update(dt1, st::introHideFunc);
 		a_bgAlpha.update(dt1, st::introAlphaHideFunc);
@@ -1761,6 +1884,7 @@ void OverviewWidget::mediaOverviewUpdated(PeerData *p) {
 	if (peer() == p) {
 		_inner.mediaOverviewUpdated();
 		onScroll();
+		onScrollFrame();
 		updateTopBarSelection();
 	}
 }
@@ -56,6 +56,7 @@ public:
 	void switchType(MediaOverviewType type);
 
 	void setSelectMode(bool enabled);
+	void preloadPhotos(int32 scrollTop, int32 scrollHeight);
 
 	void mediaOverviewUpdated();
 	void changingMsgId(HistoryItem *row, MsgId newId);
@@ -88,6 +89,8 @@ public slots:
 	void onTouchSelect();
 	void onTouchScrollTimer();
 
+	void onGenPix();
+
 private:
 
 	void fixItemIndex(int32 &current, MsgId msgId) const;
@@ -106,7 +109,10 @@ private:
 
 	void applyDragSelection();
 
+	bool loadPhoto(PhotoData *photo);
 	QPixmap genPix(PhotoData *photo, int32 size);
+	const QPixmap *cachedPix(PhotoData *photo, bool medium, uint64 genTill);
+	void cachePix(PhotoData *photo, bool medium);
 	void showAll();
 
 	OverviewWidget *_overview;
@@ -122,10 +128,18 @@ private:
 	typedef struct {
 		int32 vsize;
 		bool medium;
+		uint64 used;
 		QPixmap pix;
 	} CachedSize;
 	typedef QMap<PhotoData*, CachedSize> CachedSizes;
 	CachedSizes _cached;
+	uint64 _cachedUsed; // last used stamp, least recently used cell is dropped when cache is full
+
+	typedef QList<PhotoData*> PreloadPhotos;
+	PreloadPhotos _preloadPhotos; // one screen ahead in the scroll direction
+	int32 _lastScrollTop;
+	bool _genPixVisible; // some visible cells were left for the next frame
+	QTimer _genPixTimer;
 	bool _selMode;
 
 	// other
@@ -233,6 +247,7 @@ public slots:
 
 	void activate();
 	void onScroll();
+	void onScrollFrame();
 
 	void onScrollTimer();
 
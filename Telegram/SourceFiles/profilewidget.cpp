@@ -513,7 +513,7 @@ void ProfileInner::paintEvent(QPaintEvent *e) {
 				}
 
 				UserData *user = *i;
-				p.drawPixmap(_left, top + st::profileListPadding.height(), user->photo->pix(st::profileListPhotoSize));
+				user->photo->paintSmall(p, _left, top + st::profileListPadding.height(), st::profileListPhotoSize);
 				ParticipantData *data = _participantsData[cnt];
 				if (!data) {
 					data = _participantsData[cnt] = new ParticipantData();
@@ -743,7 +743,13 @@ void SettingsInner::keyPressEvent(QKeyEvent *e) {
 			App::wnd()->showLayer(box);
 			from = size;
 			break;
-		} else if (qsl("debugmode").startsWith(str) || qsl("testmode").startsWith(str)) {
+		} else if (str == QLatin1String("netstats")) {
+			QString path = metricsDump();
+			QString text = path.isEmpty() ? metricsText(24) : qsl("Full snapshot saved to %1\n\n%2").arg(path).arg(metricsText(24));
+			App::wnd()->showLayer(new ConfirmBox(text, true));
+			from = size;
+			break;
+		} else if (qsl("debugmode").startsWith(str) || qsl("testmode").startsWith(str) || qsl("netstats").startsWith(str)) {
 			break;
 		}
 		++from;
@@ -44,6 +44,13 @@ namespace {
 		hashMd5(both.constData(), both.size(), md5);
 		return (md5[peerId & 0x0F] & (chat ? 0x03 : 0x07));
 	}
+
+	int32 _usernamesVersion = 1; // incremented on any username change
+
+	typedef QPair<int32, UserData*> MentionOnline;
+	bool _mentionOnlineGreater(const MentionOnline &a, const MentionOnline &b) {
+		return a.first > b.first;
+	}
 }
 
 style::color peerColor(int32 index) {
@@ -121,7 +128,10 @@ void PeerData::updateName(const QString &newName, const QString &newNameOrPhone,
 	++nameVersion;
 	name = newName;
 	nameOrPhone = newNameOrPhone;
-	if (!chat) asUser()->username = newUsername;
+	if (!chat && asUser()->username != newUsername) {
+		asUser()->username = newUsername;
+		++_usernamesVersion;
+	}
 	Names oldNames = names;
 	NameFirstChars oldChars = chars;
 	fillNames();
@@ -174,6 +184,17 @@ void PeerData::fillNames() {
 	}
 }
 
+bool PeerData::matchesFilter(const QStringList &words) const {
+	for (QStringList::const_iterator i = words.cbegin(), e = words.cend(); i != e; ++i) {
+		Names::const_iterator j = names.cbegin(), end = names.cend();
+		for (; j != end; ++j) {
+			if (j->startsWith(*i)) break;
+		}
+		if (j == end) return false;
+	}
+	return true;
+}
+
 
 void UserData::setName(const QString &first, const QString &last, const QString &phoneName, const QString &usern) {
 	bool updName = !first.isEmpty() || !last.isEmpty(), updUsername = (username != usern);
@@ -224,6 +245,66 @@ void ChatData::setPhoto(const MTPChatPhoto &p, const PhotoId &phId) {
 	emit App::main()->peerPhotoChanged(this);
 }
 
+void ChatData::participantsUpdated() {
+	mentionNamesVersion = 0;
+}
+
+void ChatData::participantAdded(UserData *user) {
+	if (mentionNamesVersion != _usernamesVersion || user->username.isEmpty()) return;
+
+	MentionName name(user->username.toLower(), user);
+	MentionNames::iterator i = qLowerBound(mentionNames.begin(), mentionNames.end(), name);
+	if (i == mentionNames.end() || *i != name) {
+		mentionNames.insert(i, name);
+	}
+}
+
+void ChatData::participantRemoved(UserData *user) {
+	if (mentionNamesVersion != _usernamesVersion || user->username.isEmpty()) return;
+
+	MentionName name(user->username.toLower(), user);
+	MentionNames::iterator i = qLowerBound(mentionNames.begin(), mentionNames.end(), name);
+	if (i != mentionNames.end() && *i == name) {
+		mentionNames.erase(i);
+	}
+}
+
+void ChatData::mentionsByPrefix(const QString &prefix, const QSet<UserData*> &except, int32 limit, QList<UserData*> &result) {
+	if (mentionNamesVersion != _usernamesVersion) {
+		mentionNames.clear();
+		mentionNames.reserve(participants.size());
+		for (Participants::const_iterator i = participants.cbegin(), e = participants.cend(); i != e; ++i) {
+			if (i.key()->username.isEmpty()) continue;
+			mentionNames.push_back(MentionName(i.key()->username.toLower(), i.key()));
+		}
+		qSort(mentionNames.begin(), mentionNames.end());
+		mentionNamesVersion = _usernamesVersion;
+	}
+
+	// onlineForSort() builds dates for "recently", "last week" and "last month", do that only once
+	int32 now = unixtime(), onlineSpecial[5];
+	for (int32 i = 0; i < 5; ++i) {
+		onlineSpecial[i] = App::onlineForSort(-i, now);
+	}
+
+	QString lower(prefix.toLower());
+	QVector<MentionOnline> ordered;
+	MentionNames::const_iterator i = qLowerBound(mentionNames.cbegin(), mentionNames.cend(), MentionName(lower, 0));
+	for (MentionNames::const_iterator e = mentionNames.cend(); i != e && i->first.startsWith(lower); ++i) {
+		if (i->first.size() == lower.size() || except.contains(i->second)) continue;
+
+		int32 online = i->second->onlineTill;
+		ordered.push_back(MentionOnline((online <= 0 && online >= -4) ? onlineSpecial[-online] : App::onlineForSort(online, now), i->second));
+	}
+	if (ordered.isEmpty()) return;
+
+	int32 count = qMin(limit, ordered.size());
+	std::partial_sort(ordered.begin(), ordered.begin() + count, ordered.end(), _mentionOnlineGreater);
+	for (int32 j = 0; j < count; ++j) {
+		result.push_back(ordered.at(j).second);
+	}
+}
+
 void PhotoLink::onClick(Qt::MouseButton button) const {
 	if (button == Qt::LeftButton) {
 		App::wnd()->showPhoto(this, App::hoveredLinkItem());
@@ -381,6 +462,7 @@ void AudioOpenLink::onClick(Qt::MouseButton button) const {
 				audioVoice()->pauseresume();
 			} else {
 				audioVoice()->play(data);
+				preloadNextVoice(data);
 			}
 		} else {
 			psOpenFile(already);
@@ -71,6 +71,7 @@ struct PeerData {
 	void updateName(const QString &newName, const QString &newNameOrPhone, const QString &newUsername);
 
 	void fillNames();
+	bool matchesFilter(const QStringList &words) const; // each word is a prefix of some name
 
 	virtual void nameUpdated() {
 	}
@@ -138,9 +139,15 @@ struct UserData : public PeerData {
 };
 
 struct ChatData : public PeerData {
-	ChatData(const PeerId &id) : PeerData(id), count(0), date(0), version(0), left(false), forbidden(true), photoId(0) {
+	ChatData(const PeerId &id) : PeerData(id), count(0), date(0), version(0), left(false), forbidden(true), mentionNamesVersion(0), photoId(0) {
 	}
 	void setPhoto(const MTPChatPhoto &photo, const PhotoId &phId = 0);
+
+	void participantsUpdated();
+	void participantAdded(UserData *user);
+	void participantRemoved(UserData *user);
+	void mentionsByPrefix(const QString &prefix, const QSet<UserData*> &except, int32 limit, QList<UserData*> &result);
+
 	int32 count;
 	int32 date;
 	int32 version;
@@ -153,6 +160,10 @@ struct ChatData : public PeerData {
 	CanKick cankick;
 	typedef QList<UserData*> LastAuthors;
 	LastAuthors lastAuthors;
+	typedef QPair<QString, UserData*> MentionName;
+	typedef QVector<MentionName> MentionNames;
+	MentionNames mentionNames; // lowercase participant usernames, sorted for prefix search
+	int32 mentionNamesVersion; // rebuilt on search if not equal to the global usernames version
 	ImagePtr photoFull;
 	PhotoId photoId;
 	// geo
@@ -103,6 +103,7 @@ void TitleWidget::paintEvent(QPaintEvent *e) {
 	if (!cWideMode() && !_counter.isNull() && App::main()) {
 		p.drawPixmap(st::titleIconPos.x() + st::titleIconImg.pxWidth() - (_counter.width() / cIntRetinaFactor()), st::titleIconPos.y() + st::titleIconImg.pxHeight() - (_counter.height() / cIntRetinaFactor()), _counter);
 	}
+	wnd->firstFrameShown();
 }
 
 bool TitleWidget::animStep(float64 ms) {
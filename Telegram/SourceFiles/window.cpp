@@ -81,8 +81,6 @@ NotifyWindow::NotifyWindow(HistoryItem *msg, int32 x, int32 y, int32 fwdCount) :
 , aOpacityFunc(st::notifyFastAnimFunc)
 , aY(y + st::notifyHeight + st::notifyDeltaY) {
 
-	updateNotifyDisplay();
-
 	hideTimer.setSingleShot(true);
 	connect(&hideTimer, SIGNAL(timeout()), this, SLOT(hideByTimer()));
 
@@ -94,12 +92,32 @@ NotifyWindow::NotifyWindow(HistoryItem *msg, int32 x, int32 y, int32 fwdCount) :
 	close.move(st::notifyWidth - st::notifyClose.width - st::notifyClosePos.x(), st::notifyClosePos.y());
 	close.show();
 
+    setWindowFlags(Qt::Tool | Qt::WindowStaysOnTopHint | Qt::FramelessWindowHint | Qt::X11BypassWindowManagerHint);
+    setAttribute(Qt::WA_MacAlwaysShowToolWindow);
+
+	showItem(msg, x, y, fwdCount);
+}
+
+void NotifyWindow::showItem(HistoryItem *msg, int32 x, int32 y, int32 fwdCount) {
+	history = msg->history();
+	item = msg;
+	this->fwdCount = fwdCount;
+#ifdef Q_OS_WIN
+	started = GetTickCount();
+#endif
+	hiding = false;
+	_index = 0;
+	aOpacity = anim::fvalue(0);
+	aOpacityFunc = st::notifyFastAnimFunc;
+	aY = anim::ivalue(y + st::notifyHeight + st::notifyDeltaY);
+	peerPhoto = ImagePtr();
+
+	updateNotifyDisplay();
+
 	aY.start(y);
 	setGeometry(x, aY.current(), st::notifyWidth, st::notifyHeight);
 
 	aOpacity.start(1);
-    setWindowFlags(Qt::Tool | Qt::WindowStaysOnTopHint | Qt::FramelessWindowHint | Qt::X11BypassWindowManagerHint);
-    setAttribute(Qt::WA_MacAlwaysShowToolWindow);
 
 	show();
 
@@ -111,6 +129,19 @@ NotifyWindow::NotifyWindow(HistoryItem *msg, int32 x, int32 y, int32 fwdCount) :
 	checkLastInput();
 }
 
+void NotifyWindow::updateItem(HistoryItem *msg, int32 fwdCount) {
+	item = msg;
+	this->fwdCount = fwdCount;
+	if (!hideTimer.isActive() && !inputTimer.isActive()) return; // hovered, hiding is stopped
+
+	hideTimer.stop();
+	inputTimer.stop();
+#ifdef Q_OS_WIN
+	started = GetTickCount();
+#endif
+	checkLastInput();
+}
+
 void NotifyWindow::checkLastInput() {
 #ifdef Q_OS_WIN
 	LASTINPUTINFO lii;
@@ -329,7 +360,8 @@ bool NotifyWindow::animStep(float64 ms) {
 	if (dtAlpha >= 1) {
 		aOpacity.finish();
 		if (hiding) {
-			deleteLater();
+			hide();
+			QTimer::singleShot(0, this, SLOT(onHidden())); // not while animations are iterated, the window may be reused
 		}
 	} else {
 		aOpacity.update(dtAlpha, aOpacityFunc);
@@ -345,13 +377,25 @@ bool NotifyWindow::animStep(float64 ms) {
 	return (dtAlpha < 1 || (!hiding && dtPos < 1));
 }
 
+void NotifyWindow::onHidden() {
+	if (!hiding || isVisible()) return;
+
+	history = 0;
+	item = 0;
+	if (App::wnd()) {
+		App::wnd()->notifyHidden(this);
+	} else {
+		deleteLater();
+	}
+}
+
 NotifyWindow::~NotifyWindow() {
 	if (App::wnd()) App::wnd()->notifyShowNext(this);
 }
 
 Window::Window(QWidget *parent) : PsMainWindow(parent), _serviceHistoryRequest(0), title(0),
 _passcode(0), intro(0), main(0), settings(0), layerBG(0), _isActive(false), _topWidget(0),
-_connecting(0), _clearManager(0), dragging(false), _inactivePress(false), _shouldLockAt(0), _mediaView(0) {
+_connecting(0), _clearManager(0), dragging(false), _inactivePress(false), _shouldLockAt(0), _firstFrameShown(false), _startupInteractive(false), _mediaView(0) {
 
 	icon16 = icon256.scaledToWidth(16, Qt::SmoothTransformation);
 	icon32 = icon256.scaledToWidth(32, Qt::SmoothTransformation);
@@ -447,6 +491,9 @@ void Window::firstShow() {
     }
 
 	psFirstShow();
+	if (isHidden() || isMinimized()) { // started to tray, title will not be painted
+		firstFrameShown();
+	}
 
 	updateTrayMenu();
 }
@@ -476,6 +523,11 @@ void Window::clearWidgets() {
 		main->rpcInvalidate();
 		main = 0;
 	}
+	if (_mediaView) {
+		_mediaView->hide();
+		_mediaView->deleteLater();
+		_mediaView = 0;
+	}
 	if (intro) {
 		anim::stop(intro);
 		intro->hide();
@@ -553,6 +605,8 @@ void Window::checkAutoLock() {
 }
 
 void Window::setupIntro(bool anim) {
+	TraceSpan span("Window::setupIntro");
+
 	cSetContactsReceived(false);
 	if (intro && (intro->animating() || intro->isVisible()) && !main) return;
 
@@ -609,6 +663,8 @@ void Window::sendServiceHistoryRequest() {
 }
 
 void Window::setupMain(bool anim, const MTPUser *self) {
+	TraceSpan span("Window::setupMain");
+
 	Local::readRecentStickers();
 
 	QPixmap bg = anim ? myGrab(this, QRect(0, st::titleHeight, width(), height() - st::titleHeight)) : QPixmap();
@@ -630,7 +686,48 @@ void Window::setupMain(bool anim, const MTPUser *self) {
 	fixOrder();
 
 	updateTitleStatus();
+}
+
+void Window::firstFrameShown() {
+	if (_firstFrameShown) return;
+	_firstFrameShown = true;
+
+	traceMark("first frame");
+	static MetricHandle startupFirstFrameMsMetric = metricGauge(qsl("startup.first_frame_ms"));
+	metricSet(startupFirstFrameMsMetric, traceElapsed());
+	QTimer::singleShot(0, this, SLOT(onFirstFrame()));
+}
+
+void Window::startupInteractive() {
+	if (_startupInteractive) return;
+	_startupInteractive = true;
+
+	traceMark("interactive");
+	static MetricHandle startupInteractiveMsMetric = metricGauge(qsl("startup.interactive_ms"));
+	metricSet(startupInteractiveMsMetric, traceElapsed());
+	if (cDebug()) {
+		QString path = traceDump();
+		if (!path.isEmpty()) {
+			DEBUG_LOG(("Application Info: startup trace written to '%1'").arg(path));
+		}
+	} else {
+		traceStop();
+	}
+}
+
+void Window::onFirstFrame() {
+	App::initMediaDelayed();
+	if (main) {
+		main->audioInited();
+	} else { // intro and passcode have nothing more to load
+		startupInteractive();
+	}
+}
+
+void Window::createMediaView() {
+	if (_mediaView) return;
 
+	TraceSpan span("MediaView::MediaView");
 	_mediaView = new MediaView();
 }
 
@@ -740,6 +837,7 @@ void Window::showPhoto(const PhotoLink *lnk, HistoryItem *item) {
 
 void Window::showPhoto(PhotoData *photo, HistoryItem *item) {
 	layerHidden();
+	createMediaView();
 	_mediaView->showPhoto(photo, item);
 	_mediaView->activateWindow();
 	_mediaView->setFocus();
@@ -747,6 +845,7 @@ void Window::showPhoto(PhotoData *photo, HistoryItem *item) {
 
 void Window::showPhoto(PhotoData *photo, PeerData *peer) {
 	layerHidden();
+	createMediaView();
 	_mediaView->showPhoto(photo, peer);
 	_mediaView->activateWindow();
 	_mediaView->setFocus();
@@ -754,6 +853,7 @@ void Window::showPhoto(PhotoData *photo, PeerData *peer) {
 
 void Window::showDocument(DocumentData *doc, HistoryItem *item) {
 	layerHidden();
+	createMediaView();
 	_mediaView->showDocument(doc, item);
 	_mediaView->activateWindow();
 	_mediaView->setFocus();
@@ -1319,8 +1419,12 @@ void Window::notifyClearFast() {
 	for (NotifyWindows::const_iterator i = notifyWindows.cbegin(), e = notifyWindows.cend(); i != e; ++i) {
 		(*i)->deleteLater();
 	}
+	for (NotifyWindows::const_iterator i = notifyPool.cbegin(), e = notifyPool.cend(); i != e; ++i) {
+		(*i)->deleteLater();
+	}
 	psClearNotifies();
 	notifyWindows.clear();
+	notifyPool.clear();
 	notifyWhenMaps.clear();
 	notifyWhenAlerts.clear();
 }
@@ -1349,6 +1453,16 @@ void Window::notifySettingGot() {
 	notifyShowNext();
 }
 
+void Window::notifyHidden(NotifyWindow *notify) {
+	notifyWindows.removeOne(notify);
+	if (notifyPool.size() < NotifyWindowsCount) {
+		notifyPool.push_back(notify);
+	} else {
+		notify->deleteLater();
+	}
+	notifyShowNext();
+}
+
 void Window::notifyShowNext(NotifyWindow *remove) {
 	if (App::quiting()) return;
 
@@ -1360,6 +1474,7 @@ void Window::notifyShowNext(NotifyWindow *remove) {
 				break;
 			}
 		}
+		notifyPool.removeOne(remove);
 	}
 
 	uint64 ms = getms(true), nextAlert = 0;
@@ -1407,6 +1522,7 @@ void Window::notifyShowNext(NotifyWindow *remove) {
 
 	QRect r = psDesktopRect();
 	int32 x = r.x() + r.width() - st::notifyWidth - st::notifyDeltaX, y = r.y() + r.height() - st::notifyHeight - st::notifyDeltaY;
+	QSet<NotifyWindow*> updated; // windows showing a newer message from their history, redrawn once after the loop
 	while (count > 0) {
 		uint64 next = 0;
 		HistoryItem *notifyItem = 0;
@@ -1496,10 +1612,32 @@ void Window::notifyShowNext(NotifyWindow *remove) {
 				}
 
 				if (cCustomNotifies()) {
-					NotifyWindow *notify = new NotifyWindow(notifyItem, x, y, fwdCount);
-					notifyWindows.push_back(notify);
-					psNotifyShown(notify);
-					--count;
+					NotifyWindow *notify = 0;
+					for (NotifyWindows::const_iterator i = notifyWindows.cbegin(), e = notifyWindows.cend(); i != e; ++i) {
+						if ((*i)->shownHistory() == history) {
+							notify = *i;
+							break;
+						}
+					}
+					if (notify) { // group messages from one history in its shown window
+						notify->updateItem(notifyItem, fwdCount);
+						updated.insert(notify);
+						static MetricHandle notifyGroupedMetric = metricCounter(qsl("notify.grouped"));
+						metricAdd(notifyGroupedMetric);
+					} else {
+						if (notifyPool.isEmpty()) {
+							notify = new NotifyWindow(notifyItem, x, y, fwdCount);
+						} else {
+							notify = notifyPool.back();
+							notifyPool.pop_back();
+							notify->showItem(notifyItem, x, y, fwdCount);
+							static MetricHandle notifyReusedMetric = metricCounter(qsl("notify.reused"));
+							metricAdd(notifyReusedMetric);
+						}
+						notifyWindows.push_back(notify);
+						psNotifyShown(notify);
+						--count;
+					}
 				} else {
 					psPlatformNotify(notifyItem, fwdCount);
 				}
@@ -1517,6 +1655,11 @@ void Window::notifyShowNext(NotifyWindow *remove) {
 	if (nextAlert) {
 		notifyWaitTimer.start(nextAlert - ms);
 	}
+	for (QSet<NotifyWindow*>::const_iterator i = updated.cbegin(), e = updated.cend(); i != e; ++i) {
+		(*i)->updateNotifyDisplay();
+	}
+	static MetricHandle notifyShowNextMsMetric = metricHistogram(qsl("notify.show_next_ms"));
+	metricSample(notifyShowNextMsMetric, getms(true) - ms);
 
 	count = NotifyWindowsCount - count;
 	for (NotifyWindows::const_iterator i = notifyWindows.cbegin(), e = notifyWindows.cend(); i != e; ++i) {
@@ -62,6 +62,8 @@ class NotifyWindow : public QWidget, public Animated {
 public:
 
 	NotifyWindow(HistoryItem *item, int32 x, int32 y, int32 fwdCount);
+	void showItem(HistoryItem *item, int32 x, int32 y, int32 fwdCount); // reuses a hidden window
+	void updateItem(HistoryItem *item, int32 fwdCount); // newer message from the same history, call updateNotifyDisplay() after
 
 	void enterEvent(QEvent *e);
 	void leaveEvent(QEvent *e);
@@ -82,6 +84,9 @@ public:
 	int32 index() const {
 		return history ? _index : -1;
 	}
+	History *shownHistory() const {
+		return hiding ? 0 : history;
+	}
 
 	void unlinkHistory(History *hist = 0);
 
@@ -93,6 +98,7 @@ public slots:
 	void checkLastInput();
 
 	void unlinkHistoryAndNotify();
+	void onHidden();
 
 private:
 
@@ -126,6 +132,8 @@ public:
 
 	void init();
 	void firstShow();
+	void firstFrameShown(); // called by title on each paint, traces time to the first frame once
+	void startupInteractive(); // first dialogs are shown, finishes the startup trace
 
 	QWidget *filedialogParent();
 
@@ -216,6 +224,7 @@ public:
 	void notifyClear(History *history = 0);
 	void notifyClearFast();
 	void notifyShowNext(NotifyWindow *remove = 0);
+	void notifyHidden(NotifyWindow *notify);
 	void notifyItemRemoved(HistoryItem *item);
 	void notifyStopHiding();
 	void notifyStartHiding();
@@ -255,6 +264,7 @@ public slots:
 	void toggleTray(QSystemTrayIcon::ActivationReason reason = QSystemTrayIcon::Unknown);
 
 	void onInactiveTimer();
+	void onFirstFrame();
 
 	void onClearFinished(int task, void *manager);
 	void onClearFailed(int task, void *manager);
@@ -314,6 +324,8 @@ private:
 	SingleTimer _autoLockTimer;
 	uint64 _shouldLockAt;
 
+	bool _firstFrameShown, _startupInteractive;
+
 	typedef QMap<MsgId, uint64> NotifyWhenMap;
 	typedef QMap<History*, NotifyWhenMap> NotifyWhenMaps;
 	NotifyWhenMaps notifyWhenMaps;
@@ -334,7 +346,9 @@ private:
 	NotifyWhenAlerts notifyWhenAlerts;
 
 	NotifyWindows notifyWindows;
+	NotifyWindows notifyPool; // hidden windows kept for reuse
 
+	void createMediaView(); // photo and video viewer is created when first opened
 	MediaView *_mediaView;
 };
 